@@ -480,6 +480,22 @@ function refreshOldTimeline () {
 	}
 }
 
+// Automatic refresh of the status of a job executed in background using AJAX. This function must be called from time to time
+var objXMLHttpReqJob = false;
+function refreshJob () {
+	objXMLHttpReqJob = AJAXCreateObject();
+	if (objXMLHttpReqJob) {
+		var RefreshParams = RefreshParamNxtActJob + '&' +
+							RefreshParamIdSes + '&' +
+							RefreshParamJobCod;
+
+		objXMLHttpReqJob.onreadystatechange = readJobData;	// onreadystatechange must be lowercase
+		objXMLHttpReqJob.open('POST',ActionAJAX,true);
+		objXMLHttpReqJob.setRequestHeader('Content-Type', 'application/x-www-form-urlencoded');
+		objXMLHttpReqJob.send(RefreshParams);
+	}
+}
+
 // Create AJAX object	(try is unknown in earlier versions of Netscape, but works in IE5)
 function AJAXCreateObject () {
 	var obj = false;
@@ -605,6 +621,24 @@ function readNewTimelineData () {
 	}
 }
 
+// Receives and show status of a job executed in background
+function readJobData () {
+	if (objXMLHttpReqJob.readyState == 4) {	// Check if data have been received
+		if (objXMLHttpReqJob.status == 200) {
+			var endOfDelay = objXMLHttpReqJob.responseText.indexOf('|',0);	// Get separator position
+
+			var delay = parseInt(objXMLHttpReqJob.responseText.substring(0,endOfDelay));	// Get refresh delay
+			var htmlJobStatus = objXMLHttpReqJob.responseText.substring(endOfDelay + 1);	// Get HTML code for job status
+
+			var divJobStatus = document.getElementById('job_status');		// Access to job status DIV
+			if (divJobStatus)
+				divJobStatus.innerHTML = htmlJobStatus;				// Update job status DIV
+			if (delay > 200)	// If refresh slower than 1 time each 0.2 seconds, do refresh; else the job is finished
+				setTimeout('refreshJob()',delay);
+		}
+	}
+}
+
 // Receives and show old social timeline data
 function readOldTimelineData () {
 	if (objXMLHttpReqSoc.readyState == 4) {	// Check if data have been received
@@ -169,7 +169,8 @@ CREATE TABLE IF NOT EXISTS centres (
 	UNIQUE INDEX(CtrCod),
 	INDEX(InsCod),
 	INDEX(PlcCod),
-	INDEX(Status));
+	INDEX(Status),
+	FULLTEXT(FullName)) ENGINE = MYISAM;
 --
 -- Table chat: stored number of users in each chat room (this table is not used now)
 --
@@ -210,6 +211,17 @@ CREATE TABLE IF NOT EXISTS connected (
 	INDEX(RoleInLastCrs),
 	INDEX(LastCrsCod));
 --
+-- Table connected_counts: stores a recent snapshot of the number of connected users in each location
+--
+CREATE TABLE IF NOT EXISTS connected_counts (
+	Scope ENUM('Sys','Cty','Ins','Ctr','Deg','Crs') NOT NULL DEFAULT 'Sys',
+	Cod INT NOT NULL DEFAULT -1,
+	Role TINYINT NOT NULL DEFAULT 0,
+	NumUsrs INT NOT NULL DEFAULT 0,
+	Sex ENUM ('unknown','female','male','all') NOT NULL DEFAULT 'all',
+	ComputedTime DATETIME NOT NULL,
+	UNIQUE INDEX(Scope,Cod,Role));
+--
 -- Table countries: stores the countries
 --
 CREATE TABLE IF NOT EXISTS countries (
@@ -260,7 +272,8 @@ CREATE TABLE IF NOT EXISTS courses (
 	NumIndicators INT NOT NULL DEFAULT -1,
 	UNIQUE INDEX(CrsCod),
 	INDEX(DegCod,Year),
-	INDEX(Status));
+	INDEX(Status),
+	FULLTEXT(FullName)) ENGINE = MYISAM;
 --
 -- Table crs_grp: stores the groups in courses
 --
@@ -410,7 +423,8 @@ CREATE TABLE IF NOT EXISTS degrees (
 	UNIQUE INDEX(DegCod),
 	INDEX(CtrCod),
 	INDEX(DegTypCod),
-	INDEX(Status));
+	INDEX(Status),
+	FULLTEXT(FullName)) ENGINE = MYISAM;
 --
 -- Table departments: stores the departments
 --
@@ -500,13 +514,15 @@ CREATE TABLE IF NOT EXISTS files (
 	PublisherUsrCod INT NOT NULL,
 	FileType TINYINT NOT NULL DEFAULT 0,
 	Path TEXT COLLATE latin1_bin NOT NULL,
+	Name VARCHAR(255) COLLATE latin1_spanish_ci NOT NULL DEFAULT '',
         Hidden ENUM('N','Y') NOT NULL DEFAULT 'N',
 	Public ENUM('N','Y') NOT NULL DEFAULT 'N',
         License TINYINT NOT NULL DEFAULT 0,
 	UNIQUE INDEX(FilCod),
 	INDEX(FileBrowser,Cod,ZoneUsrCod),
 	INDEX(ZoneUsrCod),
-	INDEX(PublisherUsrCod));
+	INDEX(PublisherUsrCod),
+	FULLTEXT(Name)) ENGINE = MYISAM;
 --
 -- Table forum_disabled_post: stores the forum post that have been disabled
 --
@@ -532,6 +548,7 @@ CREATE TABLE IF NOT EXISTS forum_post (
         ImageURL VARCHAR(255) NOT NULL,
 	UNIQUE INDEX(PstCod),
 	INDEX(ThrCod),
+	INDEX(ThrCod,UsrCod),
 	INDEX(UsrCod),
 	INDEX(CreatTime),
 	INDEX(ModifTime));
@@ -561,9 +578,11 @@ CREATE TABLE IF NOT EXISTS forum_thread (
 	Location INT NOT NULL DEFAULT -1,
 	FirstPstCod INT NOT NULL,
 	LastPstCod INT NOT NULL,
+	NumPsts INT NOT NULL DEFAULT 0,
 	UNIQUE INDEX(ThrCod),
 	INDEX(ForumType),
 	INDEX(Location),
+	INDEX(ForumType,Location),
 	UNIQUE INDEX(FirstPstCod),
 	UNIQUE INDEX(LastPstCod));
 --
@@ -651,7 +670,25 @@ CREATE TABLE IF NOT EXISTS institutions (
 	WWW VARCHAR(255) NOT NULL,
 	UNIQUE INDEX(InsCod),
 	INDEX(CtyCod),
-	INDEX(Status));
+	INDEX(Status),
+	FULLTEXT(FullName)) ENGINE = MYISAM;
+--
+-- Table jobs: stores the actions executed in background
+--
+CREATE TABLE IF NOT EXISTS jobs (
+	JobCod INT NOT NULL AUTO_INCREMENT,
+	UsrCod INT NOT NULL,
+	ActCod INT NOT NULL,
+	Params TEXT NOT NULL,
+	Status TINYINT NOT NULL DEFAULT 0,
+	Progress TINYINT NOT NULL DEFAULT 0,
+	RequestTime DATETIME NOT NULL,
+	StartTime DATETIME NOT NULL,
+	EndTime DATETIME NOT NULL,
+	UNIQUE INDEX(JobCod),
+	INDEX(UsrCod,ActCod),
+	INDEX(Status),
+	INDEX(RequestTime));
 --
 -- Table links: stores the global institutional links shown on right part of page
 --
@@ -692,7 +729,7 @@ CREATE TABLE IF NOT EXISTS log_full (
 	TimeToGenerate INT NOT NULL,
 	TimeToSend INT NOT NULL,
 	IP CHAR(15) NOT NULL,
-	UNIQUE INDEX(LogCod),
+	UNIQUE INDEX(LogCod,ClickTime),
 	INDEX(ActCod),
 	INDEX(CtyCod),
 	INDEX(InsCod),
@@ -700,7 +737,9 @@ CREATE TABLE IF NOT EXISTS log_full (
 	INDEX(DegCod),
 	INDEX(CrsCod),
 	INDEX(UsrCod),
-	INDEX(ClickTime,Role));
+	INDEX(ClickTime,Role))
+	PARTITION BY RANGE (TO_DAYS(ClickTime))
+	(PARTITION pmax VALUES LESS THAN MAXVALUE);
 --
 -- Table log_recent: stores the log of the most recent clicks, used to speed up queries related to log
 --
@@ -718,6 +757,46 @@ CREATE TABLE IF NOT EXISTS log_recent (
 	TimeToGenerate INT NOT NULL,
 	TimeToSend INT NOT NULL,
 	IP CHAR(15) NOT NULL,
+	UNIQUE INDEX(LogCod,ClickTime),
+	INDEX(ActCod),
+	INDEX(CtyCod),
+	INDEX(InsCod),
+	INDEX(CtrCod),
+	INDEX(DegCod),
+	INDEX(CrsCod),
+	INDEX(UsrCod),
+	INDEX(ClickTime,Role))
+	PARTITION BY RANGE (TO_DAYS(ClickTime))
+	(PARTITION pmax VALUES LESS THAN MAXVALUE);
+--
+-- Table log_refresh: stores a sample of automatic refreshes (one of every 100), accumulated by action and day, used to get the times to generate and send them
+--
+CREATE TABLE IF NOT EXISTS log_refresh (
+	ActCod INT NOT NULL,
+	ClickDay DATE NOT NULL,
+	NumRefreshes INT NOT NULL DEFAULT 0,
+	TimeToGenerate BIGINT NOT NULL DEFAULT 0,
+	TimeToSend BIGINT NOT NULL DEFAULT 0,
+	UNIQUE INDEX(ActCod,ClickDay));
+--
+-- Table log_sample: stores a sample of the log (one of every 100 clicks), used to get fast approximate statistics
+--
+CREATE TABLE IF NOT EXISTS log_sample (
+	LogCod INT NOT NULL,
+	ActCod INT NOT NULL DEFAULT -1,
+	CtyCod INT NOT NULL DEFAULT -1,
+	InsCod INT NOT NULL DEFAULT -1,
+	CtrCod INT NOT NULL DEFAULT -1,
+	DegCod INT NOT NULL DEFAULT -1,
+	CrsCod INT NOT NULL DEFAULT -1,
+	UsrCod INT NOT NULL DEFAULT -1,
+	Role TINYINT NOT NULL,
+	ClickTime DATETIME NOT NULL,
+	TimeToGenerate INT NOT NULL,
+	TimeToSend INT NOT NULL,
+	PageBytes INT NOT NULL DEFAULT 0,
+	SentBytes INT NOT NULL DEFAULT 0,
+	IP CHAR(15) NOT NULL,
 	UNIQUE INDEX(LogCod),
 	INDEX(ActCod),
 	INDEX(CtyCod),
@@ -745,6 +824,14 @@ CREATE TABLE IF NOT EXISTS log_ws (
 	INDEX(PlgCod),
 	INDEX(FunCod));
 --
+-- Table logos: stores which institutions, centres and degrees have a logo
+--
+CREATE TABLE IF NOT EXISTS logos (
+	Scope ENUM('Ins','Ctr','Deg') NOT NULL,
+	Cod INT NOT NULL,
+	LogoExists ENUM('N','Y') NOT NULL DEFAULT 'N',
+	UNIQUE INDEX(Scope,Cod));
+--
 -- Table mail_domains: stores e-mail domains to which sending of notifications is allowed
 --
 CREATE TABLE IF NOT EXISTS mail_domains (
@@ -762,6 +849,17 @@ CREATE TABLE IF NOT EXISTS marks_properties (
 	Footer INT NOT NULL,
 	UNIQUE INDEX(FilCod));
 --
+-- Table marks_rows: stores the index of the rows of files of marks (range of bytes of each row and users' IDs in it)
+--
+CREATE TABLE IF NOT EXISTS marks_rows (
+	FilCod INT NOT NULL,
+	NumRow INT NOT NULL,
+	UsrID CHAR(16) NOT NULL,
+	StartPos INT NOT NULL,
+	EndPos INT NOT NULL,
+	UNIQUE INDEX(FilCod,NumRow,UsrID),
+	INDEX(FilCod,UsrID));
+--
 -- Table msg_banned: stores the users whose messages are banned (FromUsrCod is a recipien banned from ToUsrCod)
 --
 CREATE TABLE IF NOT EXISTS msg_banned (
@@ -803,6 +901,7 @@ CREATE TABLE IF NOT EXISTS msg_rcv (
 	Replied ENUM('N','Y') NOT NULL DEFAULT 'N',
 	Expanded ENUM('N','Y') NOT NULL DEFAULT 'N',
 	UNIQUE INDEX(UsrCod,MsgCod),
+	INDEX(UsrCod,Open,MsgCod),
 	INDEX(MsgCod),
 	INDEX(Notified));
 --
@@ -888,6 +987,7 @@ CREATE TABLE IF NOT EXISTS notif (
 	UNIQUE INDEX(NtfCod),
 	INDEX(NotifyEvent),
 	INDEX(ToUsrCod),
+	INDEX(ToUsrCod,Status,TimeNotif),
 	INDEX(TimeNotif));
 --
 -- Table pending_emails: stores the emails pending of confirmation
@@ -1313,7 +1413,8 @@ CREATE TABLE IF NOT EXISTS usr_data (
 	INDEX(DptCod),
 	INDEX(CtrCod),
 	INDEX(Menu),
-	INDEX(SideCols));
+	INDEX(SideCols),
+	FULLTEXT(FirstName,Surname1,Surname2)) ENGINE = MYISAM;
 --
 -- Table usr_duplicated: stores informs of users possibly duplicated
 --
@@ -52,10 +52,27 @@
 #define MFU_MAX_CHARS_MENU	(128 - 1)	// 127
 #define MFU_MAX_BYTES_MENU	((MFU_MAX_CHARS_MENU + 1) * Str_MAX_BYTES_PER_CHAR - 1)	// 2047
 
+#define MFU_MAX_PENDING_CLICKS	10	// Clicks stored in session before adding them to database
+
+#define MFU_MAX_BYTES_CLICK	(10 + 1 + 20 + 1)	// "ActCod:Time,"
+
 /*****************************************************************************/
 /****************************** Internal types *******************************/
 /*****************************************************************************/
 
+struct MFU_Click
+  {
+   long ActCod;
+   time_t Time;
+  };
+
+struct MFU_Score
+  {
+   long ActCod;
+   float Score;
+   time_t LastClick;
+  };
+
 /*****************************************************************************/
 /************** External global variables from others modules ****************/
 /*****************************************************************************/
@@ -70,6 +87,10 @@ extern struct Globals Gbl;
 /***************************** Private prototypes ****************************/
 /*****************************************************************************/
 
+static Act_Action_t MFU_GetActionInCurrentTab (long ActCod);
+static unsigned MFU_GetPendingClicks (const char *StrClicks,
+                                      struct MFU_Click Clicks[MFU_MAX_PENDING_CLICKS]);
+
 /*****************************************************************************/
 /************** Allocate list of most frequently used actions ****************/
 /*****************************************************************************/
@@ -137,18 +158,25 @@ void MFU_GetMFUActions (struct MFU_ListMFUActions *ListMFUActions,unsigned MaxAc
 
 Act_Action_t MFU_GetMyLastActionInCurrentTab (void)
   {
-   extern Act_Action_t Act_FromActCodToAction[1 + Act_MAX_ACTION_COD];
    char Query[512];
    MYSQL_RES *mysql_res;
    MYSQL_ROW row;
+   struct MFU_Click Clicks[MFU_MAX_PENDING_CLICKS];
+   unsigned NumClicks;
    unsigned NumActions;
    unsigned NumAct;
-   long ActCod;
    Act_Action_t Action;
    Act_Action_t MoreRecentActionInCurrentTab = ActUnk;
 
    if (Gbl.Usrs.Me.UsrDat.UsrCod > 0)
      {
+      /***** Most recent clicks are pending in session *****/
+      for (NumClicks = MFU_GetPendingClicks (Gbl.Session.MFUClicks,Clicks);
+	   NumClicks;
+	   NumClicks--)
+	 if ((Action = MFU_GetActionInCurrentTab (Clicks[NumClicks - 1].ActCod)) != ActUnk)
+	    return Action;
+
       /***** Get my most frequently used actions *****/
       sprintf (Query,"SELECT ActCod FROM actions_MFU"
                      " WHERE UsrCod=%ld"
@@ -164,15 +192,8 @@ Act_Action_t MFU_GetMyLastActionInCurrentTab (void)
          row = mysql_fetch_row (mysql_res);
 
          /* Get action code (row[0]) */
-         ActCod = Str_ConvertStrCodToLongCod (row[0]);
-         if (ActCod >= 0 && ActCod <= Act_MAX_ACTION_COD)
-            if ((Action = Act_FromActCodToAction[ActCod]) >= 0)
-               if (Act_GetTab (Act_GetSuperAction (Action)) == Gbl.Action.Tab)
-                  if (Act_CheckIfIHavePermissionToExecuteAction (Action))
-                    {
-                     MoreRecentActionInCurrentTab = Action;
-                     break;
-                    }
+         if ((MoreRecentActionInCurrentTab = MFU_GetActionInCurrentTab (Str_ConvertStrCodToLongCod (row[0]))) != ActUnk)
+            break;
         }
 
       /***** Free structure that stores the query result *****/
@@ -182,6 +203,25 @@ Act_Action_t MFU_GetMyLastActionInCurrentTab (void)
    return MoreRecentActionInCurrentTab;
   }
 
+/*****************************************************************************/
+/********** Get action from its code if it is in the current tab *************/
+/*****************************************************************************/
+// Return ActUnk if the action is not in the current tab or I can not execute it
+
+static Act_Action_t MFU_GetActionInCurrentTab (long ActCod)
+  {
+   extern Act_Action_t Act_FromActCodToAction[1 + Act_MAX_ACTION_COD];
+   Act_Action_t Action;
+
+   if (ActCod >= 0 && ActCod <= Act_MAX_ACTION_COD)
+      if ((Action = Act_FromActCodToAction[ActCod]) >= 0)
+         if (Act_GetTab (Act_GetSuperAction (Action)) == Gbl.Action.Tab)
+            if (Act_CheckIfIHavePermissionToExecuteAction (Action))
+               return Action;
+
+   return ActUnk;
+  }
+
 /*****************************************************************************/
 /************* Show a list of my most frequently used actions ****************/
 /*****************************************************************************/
@@ -320,6 +360,10 @@ void MFU_WriteSmallMFUActions (struct MFU_ListMFUActions *ListMFUActions)
 /*****************************************************************************/
 /******************** Update most frequently used actions ********************/
 /*****************************************************************************/
+// The click is stored in session, and pending clicks
+// are added to database only every MFU_MAX_PENDING_CLICKS clicks.
+// The session is written to database later (see Ses_UpdateSessionDataInDB),
+// so the click does not need an additional query
 
 #define MFU_MIN_SCORE		  0.5
 #define MFU_MAX_SCORE		100.0
@@ -328,11 +372,8 @@ void MFU_WriteSmallMFUActions (struct MFU_ListMFUActions *ListMFUActions)
 
 void MFU_UpdateMFUActions (void)
   {
-   char Query[1024];
-   MYSQL_RES *mysql_res;
-   MYSQL_ROW row;
-   float Score;
-   long ActCod;
+   struct MFU_Click Clicks[MFU_MAX_PENDING_CLICKS];
+   char StrClick[MFU_MAX_BYTES_CLICK + 1];
    Act_Action_t SuperAction;
 
    /***** In some cases, don't register action *****/
@@ -340,47 +381,177 @@ void MFU_UpdateMFUActions (void)
       return;
    if (Act_GetIndexInMenu (Gbl.Action.Act) < 0)
       return;
+   if (!Act_CheckIfIHavePermissionToExecuteAction (Gbl.Action.Act))
+      return;
    SuperAction = Act_GetSuperAction (Gbl.Action.Act);
    if (SuperAction == ActMFUAct)
       return;
 
-   ActCod = Act_GetActCod (SuperAction);
+   /***** If there is no room for this click,
+          add pending clicks to database *****/
+   if (MFU_GetPendingClicks (Gbl.Session.MFUClicks,Clicks) >= MFU_MAX_PENDING_CLICKS ||
+       strlen (Gbl.Session.MFUClicks) + MFU_MAX_BYTES_CLICK > Ses_MAX_BYTES_MFU_CLICKS)
+     {
+      MFU_FlushMFUClicks (Gbl.Usrs.Me.UsrDat.UsrCod,Gbl.Session.MFUClicks);
+      Gbl.Session.MFUClicks[0] = '\0';
+     }
+
+   /***** Add this click to pending clicks in session *****/
+   snprintf (StrClick,sizeof (StrClick),
+	     "%ld:%ld,",
+	     Act_GetActCod (SuperAction),
+	     (long) Gbl.StartExecutionTimeUTC);
+   Str_Concat (Gbl.Session.MFUClicks,StrClick,
+	       Ses_MAX_BYTES_MFU_CLICKS);
+  }
 
-   Str_SetDecimalPointToUS ();	// To get the decimal point as a dot
+/*****************************************************************************/
+/********** Add pending clicks to most frequently used actions ***************/
+/*****************************************************************************/
+// Scores are got, updated in memory click by click,
+// and written back with only one query
 
-   /***** Get current score *****/
-   sprintf (Query,"SELECT Score FROM actions_MFU"
-                  " WHERE UsrCod=%ld AND ActCod=%ld",
-            Gbl.Usrs.Me.UsrDat.UsrCod,ActCod);
-   if (DB_QuerySELECT (Query,&mysql_res,"can not get score for current action"))
+void MFU_FlushMFUClicks (long UsrCod,const char *StrClicks)
+  {
+   char Query[256];
+   char *QueryReplace;
+   MYSQL_RES *mysql_res;
+   MYSQL_ROW row;
+   struct MFU_Click Clicks[MFU_MAX_PENDING_CLICKS];
+   unsigned NumClicks;
+   unsigned NumClick;
+   struct MFU_Score *Scores;
+   unsigned NumActions;
+   unsigned NumAct;
+   unsigned NumActClicked;
+   size_t Length;
+
+   /***** Get pending clicks *****/
+   if ((NumClicks = MFU_GetPendingClicks (StrClicks,Clicks)) == 0)
+      return;
+
+   Str_SetDecimalPointToUS ();	// To get and write the decimal point as a dot
+
+   /***** Get current scores *****/
+   sprintf (Query,"SELECT ActCod,Score,UNIX_TIMESTAMP(LastClick)"
+		  " FROM actions_MFU WHERE UsrCod=%ld",
+            UsrCod);
+   NumActions = (unsigned) DB_QuerySELECT (Query,&mysql_res,"can not get most frequently used actions");
+
+   /***** Allocate memory for current scores and new actions *****/
+   if ((Scores = (struct MFU_Score *) malloc (sizeof (struct MFU_Score) *
+                                              (NumActions + NumClicks))) == NULL)
+      Lay_ShowErrorAndExit ("Not enough memory to store most frequently used actions.");
+
+   for (NumAct = 0;
+	NumAct < NumActions;
+	NumAct++)
      {
       row = mysql_fetch_row (mysql_res);
-      if (sscanf (row[0],"%f",&Score) != 1)
-         Lay_ShowErrorAndExit ("Error when getting score for current action.");
-      Score *= MFU_INCREASE_FACTOR;
-      if (Score > MFU_MAX_SCORE)
-         Score = MFU_MAX_SCORE;
+
+      /* Get action code (row[0]), score (row[1]) and last click (row[2]) */
+      Scores[NumAct].ActCod = Str_ConvertStrCodToLongCod (row[0]);
+      if (sscanf (row[1],"%f",&Scores[NumAct].Score) != 1)
+         Lay_ShowErrorAndExit ("Error when getting score for an action.");
+      Scores[NumAct].LastClick = Dat_GetUNIXTimeFromStr (row[2]);
      }
-   else
-      Score = MFU_MIN_SCORE;	// Initial score for a new action not present in MFU table
 
-   /* Free structure that stores the query result */
+   /***** Free structure that stores the query result *****/
    DB_FreeMySQLResult (&mysql_res);
 
-   /***** Update score for the current action *****/
-   sprintf (Query,"REPLACE INTO actions_MFU"
-                  " (UsrCod,ActCod,Score,LastClick)"
-                  " VALUES"
-                  " (%ld,%ld,'%f',NOW())",
-	    Gbl.Usrs.Me.UsrDat.UsrCod,ActCod,Score);
-   DB_QueryREPLACE (Query,"can not update most frequently used actions");
-
-   /***** Update score for other actions *****/
-   sprintf (Query,"UPDATE actions_MFU SET Score=GREATEST(Score*'%f','%f')"
-                  " WHERE UsrCod=%ld AND ActCod<>%ld",
-            MFU_DECREASE_FACTOR,MFU_MIN_SCORE,
-            Gbl.Usrs.Me.UsrDat.UsrCod,ActCod);
-   DB_QueryUPDATE (Query,"can not update most frequently used actions");
+   /***** Update scores click by click *****/
+   for (NumClick = 0;
+	NumClick < NumClicks;
+	NumClick++)
+     {
+      /* Search the action clicked */
+      for (NumActClicked = 0;
+	   NumActClicked < NumActions;
+	   NumActClicked++)
+	 if (Scores[NumActClicked].ActCod == Clicks[NumClick].ActCod)
+	    break;
+
+      /* Update score for the action clicked */
+      if (NumActClicked < NumActions)
+	{
+	 Scores[NumActClicked].Score *= MFU_INCREASE_FACTOR;
+	 if (Scores[NumActClicked].Score > MFU_MAX_SCORE)
+	    Scores[NumActClicked].Score = MFU_MAX_SCORE;
+	}
+      else	// New action not present in MFU table
+	{
+	 Scores[NumActClicked].ActCod = Clicks[NumClick].ActCod;
+	 Scores[NumActClicked].Score = MFU_MIN_SCORE;
+	 NumActions++;
+	}
+      Scores[NumActClicked].LastClick = Clicks[NumClick].Time;
+
+      /* Update score for other actions */
+      for (NumAct = 0;
+	   NumAct < NumActions;
+	   NumAct++)
+	 if (NumAct != NumActClicked)
+	   {
+	    Scores[NumAct].Score *= MFU_DECREASE_FACTOR;
+	    if (Scores[NumAct].Score < MFU_MIN_SCORE)
+	       Scores[NumAct].Score = MFU_MIN_SCORE;
+	   }
+     }
+
+   /***** Allocate space for query *****/
+   if ((QueryReplace = (char *) malloc (256 + NumActions * 128)) == NULL)
+      Lay_ShowErrorAndExit ("Not enough memory for query.");
+
+   /***** Write all the scores in only one query *****/
+   Length = sprintf (QueryReplace,"REPLACE INTO actions_MFU"
+				  " (UsrCod,ActCod,Score,LastClick)"
+				  " VALUES");
+   for (NumAct = 0;
+	NumAct < NumActions;
+	NumAct++)
+      Length += sprintf (QueryReplace + Length,
+			 "%s(%ld,%ld,'%f',FROM_UNIXTIME(%ld))",
+			 NumAct ? "," :
+				  " ",
+			 UsrCod,
+			 Scores[NumAct].ActCod,
+			 Scores[NumAct].Score,
+			 (long) Scores[NumAct].LastClick);
+   DB_QueryREPLACE (QueryReplace,"can not update most frequently used actions");
+
+   /***** Free memory used for query and scores *****/
+   free ((void *) QueryReplace);
+   free ((void *) Scores);
 
    Str_SetDecimalPointToLocal ();	// Return to local system
   }
+
+/*****************************************************************************/
+/********************* Get pending clicks from a string **********************/
+/*****************************************************************************/
+// StrClicks is a list of "ActCod:Time," from the oldest click to the newest
+// Return the number of clicks
+
+static unsigned MFU_GetPendingClicks (const char *StrClicks,
+                                      struct MFU_Click Clicks[MFU_MAX_PENDING_CLICKS])
+  {
+   unsigned NumClicks = 0;
+   long ActCod;
+   long Time;
+   int NumChars;
+
+   while (NumClicks < MFU_MAX_PENDING_CLICKS)
+     {
+      NumChars = 0;
+      if (sscanf (StrClicks,"%ld:%ld,%n",&ActCod,&Time,&NumChars) != 2 ||
+	  NumChars == 0)
+	 break;
+      StrClicks += NumChars;
+
+      Clicks[NumClicks].ActCod = ActCod;
+      Clicks[NumClicks].Time   = (time_t) Time;
+      NumClicks++;
+     }
+
+   return NumClicks;
+  }
@@ -53,5 +53,6 @@ void MFU_ShowMyMFUActions (void);
 void MFU_WriteBigMFUActions (struct MFU_ListMFUActions *ListMFUActions);
 void MFU_WriteSmallMFUActions (struct MFU_ListMFUActions *ListMFUActions);
 void MFU_UpdateMFUActions (void);
+void MFU_FlushMFUClicks (long UsrCod,const char *StrClicks);
 
 #endif
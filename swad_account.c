@@ -89,6 +89,11 @@ static void Acc_AskIfRemoveOtherUsrAccount (void);
 
 static void Acc_RemoveUsrBriefcase (struct UsrData *UsrDat);
 static void Acc_RemoveUsr (struct UsrData *UsrDat);
+static void Acc_RemoveOldUsrsFromTable (const char *Table,const char *UsrCodField);
+static void Acc_RemoveOldUsrsFromTableUsingTable (const char *Table,
+                                                  const char *JoinTable,
+                                                  const char *JoinCondition,
+                                                  const char *UsrCodField);
 
 /*****************************************************************************/
 /******************** Put link to create a new account ***********************/
@@ -1127,6 +1132,205 @@ void Acc_CompletelyEliminateAccount (struct UsrData *UsrDat,
      }
   }
 
+/*****************************************************************************/
+/**** Completely eliminate the accounts of the users in table usr_old_tmp ****/
+/*****************************************************************************/
+// Temporary table usr_old_tmp must be filled with the codes
+// of the users to be eliminated.
+// Only the contents that need to be removed user by user
+// (files, messages, social content) are removed for each user.
+// The rest of tables are cleaned with one query per table for all the users.
+// If the process is interrupted, it can be run again with the same users.
+// Returns the number of users eliminated
+
+unsigned Acc_CompletelyEliminateOldAccounts (void)
+  {
+   char Query[1024];
+   MYSQL_RES *mysql_res;
+   MYSQL_ROW row;
+   unsigned long NumUsr;
+   unsigned long NumUsrs;
+   struct UsrData UsrDat;
+
+   /***** Get old users and whether they have contents
+          that must be removed user by user *****/
+   sprintf (Query,"SELECT usr_old_tmp.UsrCod,"			// row[0]
+	          "usr_data.Photo,"				// row[1]
+	          "EXISTS (SELECT * FROM msg_rcv"
+	          " WHERE msg_rcv.UsrCod=usr_old_tmp.UsrCod)"
+	          " OR EXISTS (SELECT * FROM msg_snt"
+	          " WHERE msg_snt.UsrCod=usr_old_tmp.UsrCod),"	// row[2]
+	          "EXISTS (SELECT * FROM social_notes"
+	          " WHERE social_notes.UsrCod=usr_old_tmp.UsrCod)"
+	          " OR EXISTS (SELECT * FROM social_pubs"
+	          " WHERE social_pubs.PublisherCod=usr_old_tmp.UsrCod),"	// row[3]
+	          "EXISTS (SELECT * FROM usr_report"
+	          " WHERE usr_report.UsrCod=usr_old_tmp.UsrCod)"	// row[4]
+	          " FROM usr_old_tmp,usr_data"
+	          " WHERE usr_old_tmp.UsrCod=usr_data.UsrCod");
+   NumUsrs = DB_QuerySELECT (Query,&mysql_res,"can not get old users");
+
+   /***** Initialize structure with user's data *****/
+   Usr_UsrDataConstructor (&UsrDat);
+
+   /***** Remove files and contents of each user *****/
+   for (NumUsr = 0;
+	NumUsr < NumUsrs;
+	NumUsr++)
+     {
+      /* Update progress when eliminating in background */
+      Job_UpdateProgress (NumUsr,NumUsrs);
+
+      row = mysql_fetch_row (mysql_res);
+
+      /* Get user's code (row[0]) and photo (row[1]) */
+      UsrDat.UsrCod = Str_ConvertStrCodToLongCod (row[0]);
+      Str_Copy (UsrDat.Photo,row[1],
+                Cry_BYTES_ENCRYPTED_STR_SHA256_BASE64);
+
+      /* Remove the file tree of the user */
+      Acc_RemoveUsrBriefcase (&UsrDat);
+
+      /* Remove user's photo */
+      if (UsrDat.Photo[0])
+	 Pho_RemovePhoto (&UsrDat);
+
+      /* Delete user's messages sent and received (row[2]) */
+      if (row[2][0] == '1')
+	{
+	 Gbl.Msg.FilterContent[0] = '\0';
+	 Msg_DelAllRecAndSntMsgsUsr (UsrDat.UsrCod);
+	}
+
+      /* Remove social content associated to the user (row[3]) */
+      if (row[3][0] == '1')
+	 Soc_RemoveUsrSocialContent (UsrDat.UsrCod);
+
+      /* Remove user's usage reports (row[4]) */
+      if (row[4][0] == '1')
+	 Rep_RemoveUsrUsageReports (UsrDat.UsrCod);
+     }
+
+   /***** Free memory used for user's data *****/
+   Usr_UsrDataDestructor (&UsrDat);
+
+   /***** Free structure that stores the query result *****/
+   DB_FreeMySQLResult (&mysql_res);
+
+   /***** Remove users from courses, groups, projects and attendance events *****/
+   Acc_RemoveOldUsrsFromTable ("crs_records","UsrCod");
+   Acc_RemoveOldUsrsFromTable ("prj_usr","UsrCod");
+   Acc_RemoveOldUsrsFromTable ("att_usr","UsrCod");
+   Acc_RemoveOldUsrsFromTable ("crs_grp_usr","UsrCod");
+   Acc_RemoveOldUsrsFromTable ("crs_usr_requests","UsrCod");
+   Acc_RemoveOldUsrsFromTable ("usr_duplicated","UsrCod");
+   Acc_RemoveOldUsrsFromTable ("crs_usr","UsrCod");
+   Acc_RemoveOldUsrsFromTable ("admin","UsrCod");
+
+   /***** Remove users' clipboard in forums *****/
+   Acc_RemoveOldUsrsFromTable ("forum_thr_clip","UsrCod");
+
+   /***** Remove some files of the users from database *****/
+   Acc_RemoveOldUsrsFromTableUsingTable ("file_view","files",
+                                         "files.FilCod=file_view.FilCod",
+                                         "files.ZoneUsrCod");
+   Acc_RemoveOldUsrsFromTable ("expanded_folders","UsrCod");
+   Acc_RemoveOldUsrsFromTable ("clipboard","UsrCod");
+   Acc_RemoveOldUsrsFromTable ("file_browser_last","UsrCod");
+   Acc_RemoveOldUsrsFromTable ("file_browser_size","ZoneUsrCod");
+   Acc_RemoveOldUsrsFromTable ("files","ZoneUsrCod");
+
+   /***** Remove test results made by users in all courses *****/
+   Acc_RemoveOldUsrsFromTableUsingTable ("tst_exam_questions","tst_exams",
+                                         "tst_exams.TstCod=tst_exam_questions.TstCod",
+                                         "tst_exams.UsrCod");
+   Acc_RemoveOldUsrsFromTable ("tst_exams","UsrCod");
+
+   /***** Remove users' notifications *****/
+   Acc_RemoveOldUsrsFromTable ("notif","ToUsrCod");
+
+   /***** Remove users from tables of banned users *****/
+   Acc_RemoveOldUsrsFromTable ("usr_banned","UsrCod");
+   Acc_RemoveOldUsrsFromTable ("msg_banned","FromUsrCod");
+   Acc_RemoveOldUsrsFromTable ("msg_banned","ToUsrCod");
+
+   /***** Delete thread read status for these users *****/
+   Acc_RemoveOldUsrsFromTable ("forum_thr_read","UsrCod");
+
+   /***** Remove users from table of seen announcements *****/
+   Acc_RemoveOldUsrsFromTable ("ann_seen","UsrCod");
+
+   /***** Remove users from table of connected users and their sessions *****/
+   Acc_RemoveOldUsrsFromTable ("connected","UsrCod");
+   Acc_RemoveOldUsrsFromTable ("sessions","UsrCod");
+
+   /***** Remove favs made by users in social contents of other users *****/
+   Acc_RemoveOldUsrsFromTable ("social_comments_fav","UsrCod");
+   Acc_RemoveOldUsrsFromTable ("social_notes_fav","UsrCod");
+
+   /***** Remove users' figures *****/
+   Acc_RemoveOldUsrsFromTable ("usr_figures","UsrCod");
+
+   /***** Remove users from table of followers *****/
+   Acc_RemoveOldUsrsFromTable ("usr_follow","FollowerCod");
+   Acc_RemoveOldUsrsFromTable ("usr_follow","FollowedCod");
+
+   /***** Remove users' agendas *****/
+   Acc_RemoveOldUsrsFromTable ("agendas","UsrCod");
+
+   /***** Remove users from the list of users without photo *****/
+   Acc_RemoveOldUsrsFromTable ("clicks_without_photo","UsrCod");
+
+   /***** Remove users *****/
+   Acc_RemoveOldUsrsFromTable ("usr_webs","UsrCod");
+   Acc_RemoveOldUsrsFromTable ("usr_nicknames","UsrCod");
+   Acc_RemoveOldUsrsFromTable ("pending_emails","UsrCod");
+   Acc_RemoveOldUsrsFromTable ("usr_emails","UsrCod");
+   Acc_RemoveOldUsrsFromTable ("usr_IDs","UsrCod");
+   Acc_RemoveOldUsrsFromTable ("usr_last","UsrCod");
+   Acc_RemoveOldUsrsFromTable ("usr_data","UsrCod");
+
+   /***** Flush caches *****/
+   Usr_FlushCachesUsr ();
+
+   return (unsigned) NumUsrs;
+  }
+
+/*****************************************************************************/
+/*********** Remove the users in table usr_old_tmp from a table **************/
+/*****************************************************************************/
+
+static void Acc_RemoveOldUsrsFromTable (const char *Table,const char *UsrCodField)
+  {
+   char Query[256];
+
+   sprintf (Query,"DELETE FROM %s USING %s,usr_old_tmp"
+	          " WHERE %s.%s=usr_old_tmp.UsrCod",
+	    Table,Table,
+	    Table,UsrCodField);
+   DB_QueryDELETE (Query,"can not remove old users");
+  }
+
+/*****************************************************************************/
+/** Remove from a table rows related to users in usr_old_tmp by other table **/
+/*****************************************************************************/
+
+static void Acc_RemoveOldUsrsFromTableUsingTable (const char *Table,
+                                                  const char *JoinTable,
+                                                  const char *JoinCondition,
+                                                  const char *UsrCodField)
+  {
+   char Query[512];
+
+   sprintf (Query,"DELETE FROM %s USING %s,%s,usr_old_tmp"
+	          " WHERE %s=usr_old_tmp.UsrCod"
+	          " AND %s",
+	    Table,JoinTable,Table,
+	    UsrCodField,
+	    JoinCondition);
+   DB_QueryDELETE (Query,"can not remove old users");
+  }
+
 /*****************************************************************************/
 /********************** Remove the briefcase of a user ***********************/
 /*****************************************************************************/
@@ -69,5 +69,6 @@ void Acc_AskIfRemoveMyAccount (void);
 void Acc_RemoveMyAccount (void);
 void Acc_CompletelyEliminateAccount (struct UsrData *UsrDat,
                                      Cns_QuietOrVerbose_t QuietOrVerbose);
+unsigned Acc_CompletelyEliminateOldAccounts (void);
 
 #endif
@@ -60,9 +60,9 @@ typedef enum
 
 typedef signed int Act_Action_t;	// Must be a signed type, because -1 is used to indicate obsolete action
 
-#define Act_NUM_ACTIONS	(1 + 9 + 43 + 17 + 47 + 33 + 24 + 115 + 157 + 437 + 165 + 172 + 42 + 14 + 76)
+#define Act_NUM_ACTIONS	(1 + 11 + 43 + 17 + 47 + 33 + 24 + 115 + 157 + 437 + 165 + 172 + 42 + 14 + 76)
 
-#define Act_MAX_ACTION_COD 1734
+#define Act_MAX_ACTION_COD 1736
 
 #define Act_MAX_OPTIONS_IN_MENU_PER_TAB 13
 
@@ -77,14 +77,17 @@ typedef signed int Act_Action_t;	// Must be a signed type, because -1 is used to
 #define ActHom			 2
 #define ActMnu			 3
 
-// The following 5 actions use AJAX to refresh only a part of the page
+// The following 6 actions use AJAX to refresh only a part of the page
 #define ActRefCon		 4
 #define ActRefLstClk		 5
 #define ActRefNewSocPubGbl	 6
 #define ActRefOldSocPubGbl	 7
 #define ActRefOldSocPubUsr	 8
+#define ActRefJob		 9
 
-#define ActWebSvc		 9
+#define ActSeeJob		10
+
+#define ActWebSvc		11
 
 /*****************************************************************************/
 /******************************** System tab *********************************/
@@ -1639,6 +1642,7 @@ struct Act_Actions
    void (*FunctionPriori) ();
    void (*FunctionPosteriori) ();
    const char *Icon;
+   bool (*FunctionValidator) (void);	// Build validators of a page that can be cached by the client
   };
 
 /*****************************************************************************/
@@ -1655,6 +1659,7 @@ Act_Content_t Act_GetContentType (Act_Action_t Action);
 Act_BrowserTab_t Act_GetBrowserTab (Act_Action_t Action);
 void (*Act_GetFunctionPriori (Act_Action_t Action)) (void);
 void (*Act_GetFunctionPosteriori (Act_Action_t Action)) (void);
+bool (*Act_GetFunctionValidator (Act_Action_t Action)) (void);
 const char *Act_GetIcon (Act_Action_t Action);
 
 const char *Act_GetTitleAction (Act_Action_t Action);
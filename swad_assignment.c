@@ -1752,20 +1752,6 @@ static bool Asg_CheckIfIBelongToCrsOrGrpsThisAssignment (long AsgCod)
      }
   }
 
-/*****************************************************************************/
-/****************** Get number of assignments in a course ********************/
-/*****************************************************************************/
-
-unsigned Asg_GetNumAssignmentsInCrs (long CrsCod)
-  {
-   char Query[256];
-
-   /***** Get number of assignments in a course from database *****/
-   sprintf (Query,"SELECT COUNT(*) FROM assignments WHERE CrsCod=%ld",
-            CrsCod);
-   return (unsigned) DB_QueryCOUNT (Query,"can not get number of assignments in course");
-  }
-
 /*****************************************************************************/
 /****************** Get number of courses with assignments *******************/
 /*****************************************************************************/
@@ -92,7 +92,6 @@ bool Asg_CheckIfAsgIsAssociatedToGrp (long AsgCod,long GrpCod);
 void Asg_RemoveGroup (long GrpCod);
 void Asg_RemoveGroupsOfType (long GrpTypCod);
 void Asg_RemoveCrsAssignments (long CrsCod);
-unsigned Asg_GetNumAssignmentsInCrs(long CrsCod);
 
 unsigned Asg_GetNumCoursesWithAssignments (Sco_Scope_t Scope);
 unsigned Asg_GetNumAssignments (Sco_Scope_t Scope,unsigned *NumNotif);
@@ -28,7 +28,7 @@
 #include <linux/limits.h>	// For PATH_MAX
 #include <linux/stddef.h>	// For NULL
 #include <mysql/mysql.h>	// To access MySQL databases
-#include <stdlib.h>		// For calloc
+#include <stdlib.h>		// For calloc, free, qsort, bsearch
 #include <string.h>		// For string functions
 
 #include "swad_attendance.h"
@@ -53,6 +53,8 @@ extern struct Globals Gbl;
 /****************************** Private constants ****************************/
 /*****************************************************************************/
 
+#define Att_MAX_BYTES_ROLL_CALL_QUERY (512 * 1024)	// Flush the batched query when it reaches this size
+
 /*****************************************************************************/
 /******************************** Private types ******************************/
 /*****************************************************************************/
@@ -64,10 +66,34 @@ typedef enum
    Att_PRINT_VIEW,
   } Att_TypeOfView_t;
 
+struct Att_CodAndIndex
+  {
+   long Cod;		// Code of student or attendance event
+   unsigned Index;	// Index in list of students or events
+  };
+
+struct Att_Comments
+  {
+   long AttCod;
+   long UsrCod;
+   char *CommentStd;
+   char *CommentTch;
+  };
+
 /*****************************************************************************/
 /****************************** Private variables ****************************/
 /*****************************************************************************/
 
+// Attendance of the students in a list to the attendance events of the course
+static struct
+  {
+   unsigned NumStds;			// Number of students (rows)
+   unsigned NumAttEvents;		// Number of attendance events (columns)
+   unsigned char *Present;		// Bitmap with NumStds x NumAttEvents bits
+   unsigned NumComments;
+   struct Att_Comments *Comments;	// Only non-empty comments, sorted by event and student
+  } Att_Matrix;
+
 /*****************************************************************************/
 /****************************** Private prototypes ***************************/
 /*****************************************************************************/
@@ -107,10 +133,11 @@ static void Att_WriteRowStdToCallTheRoll (unsigned NumStd,
                                           struct UsrData *UsrDat,
                                           struct AttendanceEvent *Att);
 static void Att_PutParamsCodGrps (long AttCod);
+static int Att_CompareEncryptedUsrCods (const void *p1,const void *p2);
+static void Att_StoreRollCallInDB (long AttCod,char *Query,size_t *Length,bool Flush,
+                                   long UsrCod,bool Present,const char *CommentTch);
 static void Att_GetNumStdsTotalWhoAreInAttEvent (struct AttendanceEvent *Att);
-static unsigned Att_GetNumStdsFromAListWhoAreInAttEvent (long AttCod,long LstSelectedUsrCods[],unsigned NumStdsInList);
 static bool Att_CheckIfUsrIsInTableAttUsr (long AttCod,long UsrCod,bool *Present);
-static bool Att_CheckIfUsrIsPresentInAttEvent (long AttCod,long UsrCod);
 static bool Att_CheckIfUsrIsPresentInAttEventAndGetComments (long AttCod,long UsrCod,
                                                              char CommentStd[Cns_MAX_BYTES_TEXT + 1],
                                                              char CommentTch[Cns_MAX_BYTES_TEXT + 1]);
@@ -124,6 +151,16 @@ static void Usr_ListOrPrintStdsAttendanceCrs (Att_TypeOfView_t TypeOfView);
 static void Att_GetListSelectedUsrCods (unsigned NumStdsInList,long **LstSelectedUsrCods);
 static void Att_GetListSelectedAttCods (char **StrAttCodsSelected);
 
+static void Att_GetMatrixOfAttendance (unsigned NumStdsInList,long *LstSelectedUsrCods);
+static int Att_CompareCodsAndIndexes (const void *p1,const void *p2);
+static int Att_CompareComments (const void *p1,const void *p2);
+static char *Att_DuplicateComment (const char *Comment);
+static bool Att_CheckIfStdIsPresentInMatrix (unsigned NumStd,unsigned NumAttEvent);
+static void Att_GetCommentsFromMatrix (long AttCod,long UsrCod,
+                                       char CommentStd[Cns_MAX_BYTES_TEXT + 1],
+                                       char CommentTch[Cns_MAX_BYTES_TEXT + 1]);
+static void Att_FreeMatrixOfAttendance (void);
+
 static void Att_PutIconToPrintMyList (void);
 static void Att_PutFormToPrintMyListParams (void);
 static void Att_PutIconToPrintStdsList (void);
@@ -2283,11 +2320,12 @@ void Att_RegisterMeAsStdInAttEvent (void)
    1. Get list of students in the groups selected: Gbl.Usrs.LstUsrs[Rol_STD]
    2. Mark all students in the groups selected setting Remove=true
    3. Get list of students marked as present by me: Gbl.Usrs.Select[Rol_STD]
-   4. Loop over the list Gbl.Usrs.Select[Rol_STD],
+   4. Sort Gbl.Usrs.LstUsrs[Rol_STD] by encrypted code and loop over the list Gbl.Usrs.Select[Rol_STD],
       that holds the list of the students marked as present,
-      marking the students in Gbl.Usrs.LstUsrs[Rol_STD].Lst as Remove=false
-   5. Delete from att_usr all the students marked as Remove=true
-   6. Replace (insert without duplicated) into att_usr all the students marked as Remove=false
+      marking the students found in Gbl.Usrs.LstUsrs[Rol_STD].Lst as Remove=false
+   5. Insert or update into att_usr all the students in the groups selected,
+      using a few batched queries and keeping the comments of the students
+   6. Delete from att_usr all the students absent and without comments
  */
 void Att_RegisterStudentsInAttEvent (void)
   {
@@ -2297,13 +2335,15 @@ void Att_RegisterStudentsInAttEvent (void)
    char Format[256];
    unsigned NumStd;
    const char *Ptr;
+   struct UsrInList Key;
+   struct UsrInList *Std;
    bool Present;
    unsigned NumStdsPresent;
    unsigned NumStdsAbsent;
-   struct UsrData UsrData;
    char CommentParamName[10 + 10 + 1];
-   char CommentStd[Cns_MAX_BYTES_TEXT + 1];
    char CommentTch[Cns_MAX_BYTES_TEXT + 1];
+   char *Query;
+   size_t Length;
 
    /***** Get attendance event code *****/
    if ((Att.AttCod = Att_GetParamAttCod ()) == -1L)
@@ -2328,59 +2368,54 @@ void Att_RegisterStudentsInAttEvent (void)
       /***** 3. Get list of students marked as present by me: Gbl.Usrs.Select[Rol_STD] *****/
       Usr_GetListsSelectedUsrsCods ();
 
-      /***** Initialize structure with user's data *****/
-      Usr_UsrDataConstructor (&UsrData);
-
       /***** 4. Loop over the list Gbl.Usrs.Select[Rol_STD],
                 that holds the list of the students marked as present,
                 marking the students in Gbl.Usrs.LstUsrs[Rol_STD].Lst as Remove=false *****/
+      /* Sort students by encrypted code to find them quickly
+         (the order of the list is not used after this point) */
+      qsort ((void *) Gbl.Usrs.LstUsrs[Rol_STD].Lst,
+             (size_t) Gbl.Usrs.LstUsrs[Rol_STD].NumUsrs,
+             sizeof (struct UsrInList),
+             Att_CompareEncryptedUsrCods);
+
       Ptr = Gbl.Usrs.Select[Rol_STD];
       while (*Ptr)
 	{
-	 Par_GetNextStrUntilSeparParamMult (&Ptr,UsrData.EncryptedUsrCod,
+	 Par_GetNextStrUntilSeparParamMult (&Ptr,Key.EncryptedUsrCod,
 	                                    Cry_BYTES_ENCRYPTED_STR_SHA256_BASE64);
-	 Usr_GetUsrCodFromEncryptedUsrCod (&UsrData);
-	 if (UsrData.UsrCod > 0)	// Student exists in database
+	 if ((Std = (struct UsrInList *) bsearch ((const void *) &Key,
+	                                          (const void *) Gbl.Usrs.LstUsrs[Rol_STD].Lst,
+	                                          (size_t) Gbl.Usrs.LstUsrs[Rol_STD].NumUsrs,
+	                                          sizeof (struct UsrInList),
+	                                          Att_CompareEncryptedUsrCods)))
 	    /***** Mark student to not be removed *****/
-	    for (NumStd = 0;
-		 NumStd < Gbl.Usrs.LstUsrs[Rol_STD].NumUsrs;
-		 NumStd++)
-	       if (Gbl.Usrs.LstUsrs[Rol_STD].Lst[NumStd].UsrCod == UsrData.UsrCod)
-		 {
-		  Gbl.Usrs.LstUsrs[Rol_STD].Lst[NumStd].Remove = false;
-	          break;	// Found! Exit loop
-	         }
+	    Std->Remove = false;
 	}
 
-      /***** Free memory used for user's data *****/
-      Usr_UsrDataDestructor (&UsrData);
-
       /***** Free memory *****/
       /* Free memory used by list of selected students' codes */
       Usr_FreeListsSelectedUsrsCods ();
 
-      // 5. Delete from att_usr all the students marked as Remove=true
-      // 6. Replace (insert without duplicated) into att_usr all the students marked as Remove=false
-      for (NumStd = 0, NumStdsAbsent = NumStdsPresent = 0;
+      /***** Allocate space for batched query *****/
+      if ((Query = (char *) malloc (Att_MAX_BYTES_ROLL_CALL_QUERY + 256 + Cns_MAX_BYTES_TEXT + 1)) == NULL)
+         Lay_ShowErrorAndExit ("Not enough memory for query.");
+
+      // 5. Insert or update into att_usr all the students in the groups selected
+      for (NumStd = 0, NumStdsAbsent = NumStdsPresent = 0, Length = 0;
 	   NumStd < Gbl.Usrs.LstUsrs[Rol_STD].NumUsrs;
 	   NumStd++)
 	{
-	 /***** Get comments for this student *****/
-	 Att_CheckIfUsrIsPresentInAttEventAndGetComments (Att.AttCod,Gbl.Usrs.LstUsrs[Rol_STD].Lst[NumStd].UsrCod,CommentStd,CommentTch);
+	 /***** Get teacher's comment for this student *****/
 	 sprintf (CommentParamName,"CommentTch%ld",Gbl.Usrs.LstUsrs[Rol_STD].Lst[NumStd].UsrCod);
 	 Par_GetParToHTML (CommentParamName,CommentTch,Cns_MAX_BYTES_TEXT);
 
 	 Present = !Gbl.Usrs.LstUsrs[Rol_STD].Lst[NumStd].Remove;
 
-	 if (Present ||
-	     CommentStd[0] ||
-	     CommentTch[0])
-	    /***** Register student *****/
-	    Att_RegUsrInAttEventChangingComments (Att.AttCod,Gbl.Usrs.LstUsrs[Rol_STD].Lst[NumStd].UsrCod,
-					          Present,CommentStd,CommentTch);
-	 else
-	    /***** Remove student *****/
-	    Att_RemoveUsrFromAttEvent (Att.AttCod,Gbl.Usrs.LstUsrs[Rol_STD].Lst[NumStd].UsrCod);
+	 /***** Register student *****/
+	 Att_StoreRollCallInDB (Att.AttCod,Query,&Length,
+	                        NumStd == Gbl.Usrs.LstUsrs[Rol_STD].NumUsrs - 1,	// Last student?
+	                        Gbl.Usrs.LstUsrs[Rol_STD].Lst[NumStd].UsrCod,
+	                        Present,CommentTch);
 
 	 if (Present)
             NumStdsPresent++;
@@ -2388,6 +2423,12 @@ void Att_RegisterStudentsInAttEvent (void)
 	    NumStdsAbsent++;
 	}
 
+      /***** Free query *****/
+      free ((void *) Query);
+
+      // 6. Delete from att_usr all the students absent and without comments
+      Att_RemoveUsrsAbsentWithoutCommentsFromAttEvent (Att.AttCod);
+
       /***** Free memory for students list *****/
       Usr_FreeUsrsList (Rol_STD);
 
@@ -2410,64 +2451,63 @@ void Att_RegisterStudentsInAttEvent (void)
   }
 
 /*****************************************************************************/
-/******* Get number of students from a list who attended to an event *********/
+/********************** Compare two users' encrypted codes *******************/
 /*****************************************************************************/
 
-static void Att_GetNumStdsTotalWhoAreInAttEvent (struct AttendanceEvent *Att)
+static int Att_CompareEncryptedUsrCods (const void *p1,const void *p2)
   {
-   char Query[128];
-
-   /***** Count number of students registered in an event in database *****/
-   sprintf (Query,"SELECT COUNT(*) FROM att_usr"
-                  " WHERE AttCod=%ld AND Present='Y'",
-            Att->AttCod);
-   Att->NumStdsTotal = (unsigned) DB_QueryCOUNT (Query,"can not get number of students who are registered in an event");
+   return strcmp (((const struct UsrInList *) p1)->EncryptedUsrCod,
+                  ((const struct UsrInList *) p2)->EncryptedUsrCod);
   }
 
 /*****************************************************************************/
-/******* Get number of students from a list who attended to an event *********/
+/*********** Add a student to the batched query to save a roll call **********/
 /*****************************************************************************/
+// The query is sent when it reaches Att_MAX_BYTES_ROLL_CALL_QUERY or Flush is true
+// Comments of the student already stored in database are not changed
 
-static unsigned Att_GetNumStdsFromAListWhoAreInAttEvent (long AttCod,long LstSelectedUsrCods[],unsigned NumStdsInList)
+static void Att_StoreRollCallInDB (long AttCod,char *Query,size_t *Length,bool Flush,
+                                   long UsrCod,bool Present,const char *CommentTch)
   {
-   char *Query;
-   char SubQuery[1 + 1 + 10 + 1];
-   unsigned NumStd;
-   unsigned NumStdsInAttEvent = 0;
-   size_t MaxLength;
+   /***** Start a new query or add a separator *****/
+   if (*Length == 0)
+      *Length = (size_t) sprintf (Query,"INSERT INTO att_usr"
+	                                " (AttCod,UsrCod,Present,CommentStd,CommentTch)"
+	                                " VALUES ");
+   else
+      Query[(*Length)++] = ',';
+
+   /***** Add this student *****/
+   *Length += (size_t) sprintf (Query + *Length,"(%ld,%ld,'%c','','%s')",
+                                AttCod,UsrCod,
+                                Present ? 'Y' :
+                        	          'N',
+                                CommentTch);
 
-   if (NumStdsInList)
+   /***** Send query to database *****/
+   if (Flush || *Length >= Att_MAX_BYTES_ROLL_CALL_QUERY)
      {
-      /***** Allocate space for query *****/
-      MaxLength = 256 + NumStdsInList * (1 + 1 + 10);
-      if ((Query = (char *) malloc (MaxLength + 1)) == NULL)
-         Lay_ShowErrorAndExit ("Not enough memory for query.");
+      sprintf (Query + *Length," ON DUPLICATE KEY UPDATE"
+	                       " Present=VALUES(Present),"
+	                       "CommentTch=VALUES(CommentTch)");
+      DB_QueryINSERT (Query,"can not register students in an event");
+      *Length = 0;
+     }
+  }
 
-      /***** Count number of students registered in an event in database *****/
-      sprintf (Query,"SELECT COUNT(*) FROM att_usr"
-                     " WHERE AttCod=%ld"
-	             " AND UsrCod IN (",
-               AttCod);
-      for (NumStd = 0;
-	   NumStd < NumStdsInList;
-	   NumStd++)
-	{
-         sprintf (SubQuery,
-                  NumStd ? ",%ld" :
-                	   "%ld",
-                  LstSelectedUsrCods[NumStd]);
-	 Str_Concat (Query,SubQuery,
-	             MaxLength);
-	}
-      Str_Concat (Query,") AND Present='Y'",
-                  MaxLength);
+/*****************************************************************************/
+/******* Get number of students from a list who attended to an event *********/
+/*****************************************************************************/
 
-      NumStdsInAttEvent = (unsigned) DB_QueryCOUNT (Query,"can not get number of students from a list who are registered in an event");
+static void Att_GetNumStdsTotalWhoAreInAttEvent (struct AttendanceEvent *Att)
+  {
+   char Query[128];
 
-      /***** Free query *****/
-      free ((void *) Query);
-     }
-   return NumStdsInAttEvent;
+   /***** Count number of students registered in an event in database *****/
+   sprintf (Query,"SELECT COUNT(*) FROM att_usr"
+                  " WHERE AttCod=%ld AND Present='Y'",
+            Att->AttCod);
+   Att->NumStdsTotal = (unsigned) DB_QueryCOUNT (Query,"can not get number of students who are registered in an event");
   }
 
 /*****************************************************************************/
@@ -2512,19 +2552,6 @@ static bool Att_CheckIfUsrIsInTableAttUsr (long AttCod,long UsrCod,bool *Present
 /***************** Check if a student attended to an event *******************/
 /*****************************************************************************/
 
-static bool Att_CheckIfUsrIsPresentInAttEvent (long AttCod,long UsrCod)
-  {
-   bool Present;
-
-   Att_CheckIfUsrIsInTableAttUsr (AttCod,UsrCod,&Present);
-
-   return Present;
-  }
-
-/*****************************************************************************/
-/***************** Check if a student attended to an event *******************/
-/*****************************************************************************/
-
 static bool Att_CheckIfUsrIsPresentInAttEventAndGetComments (long AttCod,long UsrCod,
                                                              char CommentStd[Cns_MAX_BYTES_TEXT + 1],
                                                              char CommentTch[Cns_MAX_BYTES_TEXT + 1])
@@ -2747,8 +2774,6 @@ void Usr_PrintMyAttendanceCrs (void)
 
 static void Usr_ListOrPrintMyAttendanceCrs (Att_TypeOfView_t TypeOfView)
   {
-   unsigned NumAttEvent;
-
    /***** Get list of attendance events *****/
    Att_GetListAttEvents (Att_OLDEST_FIRST);
 
@@ -2758,13 +2783,9 @@ static void Usr_ListOrPrintMyAttendanceCrs (Att_TypeOfView_t TypeOfView)
    /***** Get list of groups selected ******/
    Grp_GetParCodsSeveralGrpsToShowUsrs ();
 
-   /***** Get number of students in each event *****/
-   for (NumAttEvent = 0;
-	NumAttEvent < Gbl.AttEvents.Num;
-	NumAttEvent++)
-      /* Get number of students in this event */
-      Gbl.AttEvents.Lst[NumAttEvent].NumStdsFromList = Att_GetNumStdsFromAListWhoAreInAttEvent (Gbl.AttEvents.Lst[NumAttEvent].AttCod,
-												&Gbl.Usrs.Me.UsrDat.UsrCod,1);
+   /***** Get my attendance to all the events
+          and number of students (me) in each event *****/
+   Att_GetMatrixOfAttendance (1,&Gbl.Usrs.Me.UsrDat.UsrCod);
 
    /***** Get list of attendance events selected *****/
    Att_GetListSelectedAttCods (&Gbl.AttEvents.StrAttCodsSelected);
@@ -2785,6 +2806,9 @@ static void Usr_ListOrPrintMyAttendanceCrs (Att_TypeOfView_t TypeOfView)
    /***** Free memory for list of attendance events selected *****/
    free ((void *) Gbl.AttEvents.StrAttCodsSelected);
 
+   /***** Free matrix of attendance *****/
+   Att_FreeMatrixOfAttendance ();
+
    /***** Free list of groups selected *****/
    Grp_FreeListCodSelectedGrps ();
 
@@ -2811,7 +2835,6 @@ static void Usr_ListOrPrintStdsAttendanceCrs (Att_TypeOfView_t TypeOfView)
    extern const char *Txt_You_must_select_one_ore_more_students;
    unsigned NumStdsInList;
    long *LstSelectedUsrCods;
-   unsigned NumAttEvent;
 
    /***** Get list of attendance events *****/
    Att_GetListAttEvents (Att_OLDEST_FIRST);
@@ -2831,13 +2854,9 @@ static void Usr_ListOrPrintStdsAttendanceCrs (Att_TypeOfView_t TypeOfView)
       /***** Get list of students selected to show their attendances *****/
       Att_GetListSelectedUsrCods (NumStdsInList,&LstSelectedUsrCods);
 
-      /***** Get number of students in each event *****/
-      for (NumAttEvent = 0;
-	   NumAttEvent < Gbl.AttEvents.Num;
-	   NumAttEvent++)
-	 /* Get number of students in this event */
-	 Gbl.AttEvents.Lst[NumAttEvent].NumStdsFromList = Att_GetNumStdsFromAListWhoAreInAttEvent (Gbl.AttEvents.Lst[NumAttEvent].AttCod,
-												   LstSelectedUsrCods,NumStdsInList);
+      /***** Get attendance of the students to all the events
+             and number of students from the list in each event *****/
+      Att_GetMatrixOfAttendance (NumStdsInList,LstSelectedUsrCods);
 
       /***** Get list of attendance events selected *****/
       Att_GetListSelectedAttCods (&Gbl.AttEvents.StrAttCodsSelected);
@@ -2858,6 +2877,9 @@ static void Usr_ListOrPrintStdsAttendanceCrs (Att_TypeOfView_t TypeOfView)
       /***** Free memory for list of attendance events selected *****/
       free ((void *) Gbl.AttEvents.StrAttCodsSelected);
 
+      /***** Free matrix of attendance *****/
+      Att_FreeMatrixOfAttendance ();
+
       /***** Free list of user codes *****/
       free ((void *) LstSelectedUsrCods);
 
@@ -3019,6 +3041,327 @@ static void Att_GetListSelectedAttCods (char **StrAttCodsSelected)
      }
   }
 
+/*****************************************************************************/
+/***** Get attendance of a list of students to all the attendance events *****/
+/*****************************************************************************/
+// Only one query is made for all the students and events
+// Comments are got only if details must be shown
+
+static void Att_GetMatrixOfAttendance (unsigned NumStdsInList,long *LstSelectedUsrCods)
+  {
+   struct Att_CodAndIndex *Stds;
+   struct Att_CodAndIndex *AttEvents;
+   struct Att_CodAndIndex Key;
+   struct Att_CodAndIndex *Std;
+   struct Att_CodAndIndex *AttEvent;
+   struct Att_CodAndIndex *LastStd;
+   char *Query;
+   char SubQuery[1 + 1 + 10 + 1];
+   size_t MaxLength;
+   MYSQL_RES *mysql_res;
+   MYSQL_ROW row;
+   unsigned long NumRows;
+   unsigned long NumRow;
+   unsigned NumStd;
+   unsigned NumAttEvent;
+   long UsrCod;
+   size_t NumBit;
+   struct Att_Comments *Comments;
+
+   /***** Reset matrix and number of students in each event *****/
+   Att_FreeMatrixOfAttendance ();
+   for (NumAttEvent = 0;
+	NumAttEvent < Gbl.AttEvents.Num;
+	NumAttEvent++)
+      Gbl.AttEvents.Lst[NumAttEvent].NumStdsFromList = 0;
+   if (!NumStdsInList || !Gbl.AttEvents.Num)
+      return;
+   Att_Matrix.NumStds = NumStdsInList;
+   Att_Matrix.NumAttEvents = Gbl.AttEvents.Num;
+
+   /***** Allocate bitmap with all the students absent *****/
+   if ((Att_Matrix.Present = (unsigned char *) calloc (((size_t) NumStdsInList * Gbl.AttEvents.Num + 7) / 8,
+                                                       sizeof (unsigned char))) == NULL)
+      Lay_ShowErrorAndExit ("Not enough memory to store attendance of students.");
+
+   /***** Sort codes of students and events to find them quickly *****/
+   if ((Stds = (struct Att_CodAndIndex *) malloc ((size_t) NumStdsInList *
+                                                  sizeof (struct Att_CodAndIndex))) == NULL)
+      Lay_ShowErrorAndExit ("Not enough memory to store list of students.");
+   for (NumStd = 0;
+	NumStd < NumStdsInList;
+	NumStd++)
+     {
+      Stds[NumStd].Cod   = LstSelectedUsrCods[NumStd];
+      Stds[NumStd].Index = NumStd;
+     }
+   qsort ((void *) Stds,(size_t) NumStdsInList,sizeof (struct Att_CodAndIndex),
+          Att_CompareCodsAndIndexes);
+
+   if ((AttEvents = (struct Att_CodAndIndex *) malloc ((size_t) Gbl.AttEvents.Num *
+                                                       sizeof (struct Att_CodAndIndex))) == NULL)
+      Lay_ShowErrorAndExit ("Not enough memory to store list of attendance events.");
+   for (NumAttEvent = 0;
+	NumAttEvent < Gbl.AttEvents.Num;
+	NumAttEvent++)
+     {
+      AttEvents[NumAttEvent].Cod   = Gbl.AttEvents.Lst[NumAttEvent].AttCod;
+      AttEvents[NumAttEvent].Index = NumAttEvent;
+     }
+   qsort ((void *) AttEvents,(size_t) Gbl.AttEvents.Num,sizeof (struct Att_CodAndIndex),
+          Att_CompareCodsAndIndexes);
+
+   /***** Allocate space for query *****/
+   MaxLength = 512 + NumStdsInList * (1 + 10);
+   if ((Query = (char *) malloc (MaxLength + 1)) == NULL)
+      Lay_ShowErrorAndExit ("Not enough memory for query.");
+
+   /***** Get attendance of the students in the list to the events of the course *****/
+   sprintf (Query,"SELECT att_usr.AttCod,att_usr.UsrCod,att_usr.Present%s"
+		  " FROM att_events,att_usr"
+		  " WHERE att_events.CrsCod=%ld"
+		  " AND att_events.AttCod=att_usr.AttCod"
+		  " AND att_usr.UsrCod IN (",
+	    Gbl.AttEvents.ShowDetails ? ",att_usr.CommentStd,att_usr.CommentTch" :
+		                        "",
+	    Gbl.CurrentCrs.Crs.CrsCod);
+   for (NumStd = 0;
+	NumStd < NumStdsInList;
+	NumStd++)
+     {
+      sprintf (SubQuery,
+	       NumStd ? ",%ld" :
+			"%ld",
+	       LstSelectedUsrCods[NumStd]);
+      Str_Concat (Query,SubQuery,
+		  MaxLength);
+     }
+   Str_Concat (Query,Gbl.AttEvents.ShowDetails ? ")" :
+	                                         ") AND att_usr.Present='Y'",	// Absent students are not needed
+	       MaxLength);
+   NumRows = DB_QuerySELECT (Query,&mysql_res,"can not get attendance of students");
+
+   /***** Free query *****/
+   free ((void *) Query);
+
+   /***** Allocate space for comments *****/
+   if (Gbl.AttEvents.ShowDetails && NumRows)
+      if ((Att_Matrix.Comments = (struct Att_Comments *) malloc ((size_t) NumRows *
+                                                                 sizeof (struct Att_Comments))) == NULL)
+         Lay_ShowErrorAndExit ("Not enough memory to store comments of students.");
+
+   /***** Fill matrix *****/
+   for (NumRow = 0;
+	NumRow < NumRows;
+	NumRow++)
+     {
+      row = mysql_fetch_row (mysql_res);
+
+      /* Get attendance event code (row[0]) */
+      Key.Cod = Str_ConvertStrCodToLongCod (row[0]);
+      if ((AttEvent = (struct Att_CodAndIndex *) bsearch ((const void *) &Key,
+                                                          (const void *) AttEvents,
+                                                          (size_t) Gbl.AttEvents.Num,
+                                                          sizeof (struct Att_CodAndIndex),
+                                                          Att_CompareCodsAndIndexes)) == NULL)
+	 continue;	// Event not listed
+
+      /* Get user's code (row[1]) */
+      UsrCod = Str_ConvertStrCodToLongCod (row[1]);
+
+      /* Get if present (row[2]) */
+      if (row[2][0] == 'Y')
+	{
+	 Gbl.AttEvents.Lst[AttEvent->Index].NumStdsFromList++;
+
+	 /* Set the student as present in this event
+	    (a student may appear several times in the list) */
+	 Key.Cod = UsrCod;
+	 if ((Std = (struct Att_CodAndIndex *) bsearch ((const void *) &Key,
+	                                                (const void *) Stds,
+	                                                (size_t) NumStdsInList,
+	                                                sizeof (struct Att_CodAndIndex),
+	                                                Att_CompareCodsAndIndexes)))
+	   {
+	    LastStd = &Stds[NumStdsInList - 1];
+	    while (Std > Stds && (Std - 1)->Cod == UsrCod)
+	       Std--;
+	    for (;
+		 Std <= LastStd && Std->Cod == UsrCod;
+		 Std++)
+	      {
+	       NumBit = (size_t) Std->Index * Att_Matrix.NumAttEvents + AttEvent->Index;
+	       Att_Matrix.Present[NumBit >> 3] |= (unsigned char) (1 << (NumBit & 7));
+	      }
+	   }
+	}
+
+      /* Get student's comment (row[3]) and teacher's comment (row[4]) */
+      if (Gbl.AttEvents.ShowDetails)
+	 if (row[3][0] || row[4][0])
+	   {
+	    Comments = &Att_Matrix.Comments[Att_Matrix.NumComments++];
+	    Comments->AttCod = Gbl.AttEvents.Lst[AttEvent->Index].AttCod;
+	    Comments->UsrCod = UsrCod;
+	    Comments->CommentStd = Att_DuplicateComment (row[3]);
+	    Comments->CommentTch = Att_DuplicateComment (row[4]);
+	   }
+     }
+
+   /***** Free structure that stores the query result *****/
+   DB_FreeMySQLResult (&mysql_res);
+
+   /***** Sort comments to find them quickly *****/
+   if (Att_Matrix.NumComments)
+      qsort ((void *) Att_Matrix.Comments,(size_t) Att_Matrix.NumComments,sizeof (struct Att_Comments),
+	     Att_CompareComments);
+
+   /***** Free sorted lists of codes *****/
+   free ((void *) AttEvents);
+   free ((void *) Stds);
+  }
+
+/*****************************************************************************/
+/******************* Compare two codes of students or events *****************/
+/*****************************************************************************/
+
+static int Att_CompareCodsAndIndexes (const void *p1,const void *p2)
+  {
+   long Cod1 = ((const struct Att_CodAndIndex *) p1)->Cod;
+   long Cod2 = ((const struct Att_CodAndIndex *) p2)->Cod;
+
+   return (Cod1 < Cod2) ? -1 :
+	  ((Cod1 > Cod2) ? 1 :
+		           0);
+  }
+
+/*****************************************************************************/
+/************* Compare comments by attendance event and student **************/
+/*****************************************************************************/
+
+static int Att_CompareComments (const void *p1,const void *p2)
+  {
+   const struct Att_Comments *Comments1 = (const struct Att_Comments *) p1;
+   const struct Att_Comments *Comments2 = (const struct Att_Comments *) p2;
+
+   if (Comments1->AttCod != Comments2->AttCod)
+      return (Comments1->AttCod < Comments2->AttCod) ? -1 :
+	                                               1;
+   return (Comments1->UsrCod < Comments2->UsrCod) ? -1 :
+	  ((Comments1->UsrCod > Comments2->UsrCod) ? 1 :
+		                                     0);
+  }
+
+/*****************************************************************************/
+/****************** Allocate a copy of a comment if not empty ****************/
+/*****************************************************************************/
+// Returns NULL if the comment is empty
+
+static char *Att_DuplicateComment (const char *Comment)
+  {
+   size_t Length;
+   char *Copy;
+
+   if (!Comment[0])
+      return NULL;
+
+   Length = strlen (Comment);
+   if (Length > Cns_MAX_BYTES_TEXT)
+      Length = Cns_MAX_BYTES_TEXT;
+   if ((Copy = (char *) malloc (Length + 1)) == NULL)
+      Lay_ShowErrorAndExit ("Not enough memory to store comments of students.");
+   Str_Copy (Copy,Comment,
+             Length);
+
+   return Copy;
+  }
+
+/*****************************************************************************/
+/******* Check if a student in the list attended to an attendance event ******/
+/*****************************************************************************/
+
+static bool Att_CheckIfStdIsPresentInMatrix (unsigned NumStd,unsigned NumAttEvent)
+  {
+   size_t NumBit;
+
+   if (!Att_Matrix.Present ||
+       NumStd >= Att_Matrix.NumStds ||
+       NumAttEvent >= Att_Matrix.NumAttEvents)
+      return false;
+
+   NumBit = (size_t) NumStd * Att_Matrix.NumAttEvents + NumAttEvent;
+   return (Att_Matrix.Present[NumBit >> 3] & (1 << (NumBit & 7))) != 0;
+  }
+
+/*****************************************************************************/
+/********** Get the comments of a student about an attendance event **********/
+/*****************************************************************************/
+
+static void Att_GetCommentsFromMatrix (long AttCod,long UsrCod,
+                                       char CommentStd[Cns_MAX_BYTES_TEXT + 1],
+                                       char CommentTch[Cns_MAX_BYTES_TEXT + 1])
+  {
+   struct Att_Comments Key;
+   struct Att_Comments *Comments = NULL;
+
+   if (Att_Matrix.NumComments)
+     {
+      Key.AttCod = AttCod;
+      Key.UsrCod = UsrCod;
+      Comments = (struct Att_Comments *) bsearch ((const void *) &Key,
+                                                  (const void *) Att_Matrix.Comments,
+                                                  (size_t) Att_Matrix.NumComments,
+                                                  sizeof (struct Att_Comments),
+                                                  Att_CompareComments);
+     }
+
+   if (Comments && Comments->CommentStd)
+      Str_Copy (CommentStd,Comments->CommentStd,
+                Cns_MAX_BYTES_TEXT);
+   else
+      CommentStd[0] = '\0';
+
+   if (Comments && Comments->CommentTch)
+      Str_Copy (CommentTch,Comments->CommentTch,
+                Cns_MAX_BYTES_TEXT);
+   else
+      CommentTch[0] = '\0';
+  }
+
+/*****************************************************************************/
+/******************** Free the matrix of attendance **************************/
+/*****************************************************************************/
+
+static void Att_FreeMatrixOfAttendance (void)
+  {
+   unsigned NumComment;
+
+   if (Att_Matrix.Present)
+     {
+      free ((void *) Att_Matrix.Present);
+      Att_Matrix.Present = NULL;
+     }
+
+   if (Att_Matrix.Comments)
+     {
+      for (NumComment = 0;
+	   NumComment < Att_Matrix.NumComments;
+	   NumComment++)
+	{
+	 if (Att_Matrix.Comments[NumComment].CommentStd)
+	    free ((void *) Att_Matrix.Comments[NumComment].CommentStd);
+	 if (Att_Matrix.Comments[NumComment].CommentTch)
+	    free ((void *) Att_Matrix.Comments[NumComment].CommentTch);
+	}
+      free ((void *) Att_Matrix.Comments);
+      Att_Matrix.Comments = NULL;
+     }
+
+   Att_Matrix.NumStds =
+   Att_Matrix.NumAttEvents =
+   Att_Matrix.NumComments = 0;
+  }
+
 /*****************************************************************************/
 /****** Put icon to print my assistance (as student) to several events *******/
 /*****************************************************************************/
@@ -3388,8 +3731,7 @@ static void Att_WriteRowStdSeveralAttEvents (unsigned NumStd,struct UsrData *Usr
       if (Gbl.AttEvents.Lst[NumAttEvent].Selected)
 	{
 	 /***** Check if this student is already registered in the current event *****/
-	 // Here it is not necessary to get comments
-	 Present = Att_CheckIfUsrIsPresentInAttEvent (Gbl.AttEvents.Lst[NumAttEvent].AttCod,UsrDat->UsrCod);
+	 Present = Att_CheckIfStdIsPresentInMatrix (NumStd,NumAttEvent);
 
 	 fprintf (Gbl.F.Out,"<td class=\"BM%u\">"
 	                    "<img src=\"%s/%s16x16.gif\""
@@ -3534,12 +3876,11 @@ static void Att_ListAttEventsForAStd (unsigned NumStd,struct UsrData *UsrDat)
 	NumAttEvent++, UniqueId++)
       if (Gbl.AttEvents.Lst[NumAttEvent].Selected)
 	{
-	 /***** Get data of the attendance event from database *****/
-	 Att_GetDataOfAttEventByCodAndCheckCrs (&Gbl.AttEvents.Lst[NumAttEvent]);
-         Att_GetNumStdsTotalWhoAreInAttEvent (&Gbl.AttEvents.Lst[NumAttEvent]);
-
 	 /***** Get comments for this student *****/
-	 Present = Att_CheckIfUsrIsPresentInAttEventAndGetComments (Gbl.AttEvents.Lst[NumAttEvent].AttCod,UsrDat->UsrCod,CommentStd,CommentTch);
+	 // Data of the attendance event were already got when listing events to select
+	 Present = Att_CheckIfStdIsPresentInMatrix (NumStd,NumAttEvent);
+	 Att_GetCommentsFromMatrix (Gbl.AttEvents.Lst[NumAttEvent].AttCod,UsrDat->UsrCod,
+	                            CommentStd,CommentTch);
          ShowCommentStd = CommentStd[0];
 	 ShowCommentTch = CommentTch[0] &&
 	                  (Gbl.Usrs.Me.Role.Logged == Rol_TCH ||
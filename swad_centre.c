@@ -1184,30 +1184,8 @@ bool Ctr_GetDataOfCentreByCod (struct Centre *Ctr)
          /* Get row */
          row = mysql_fetch_row (mysql_res);
 
-         /* Get the code of the institution (row[0]) */
-         Ctr->InsCod = Str_ConvertStrCodToLongCod (row[0]);
-
-         /* Get the code of the place (row[1]) */
-         Ctr->PlcCod = Str_ConvertStrCodToLongCod (row[1]);
-
-	 /* Get centre status (row[2]) */
-	 if (sscanf (row[2],"%u",&(Ctr->Status)) != 1)
-	    Lay_ShowErrorAndExit ("Wrong centre status.");
-
-	 /* Get requester user's code (row[3]) */
-	 Ctr->RequesterUsrCod = Str_ConvertStrCodToLongCod (row[3]);
-
-         /* Get the short name of the centre (row[4]) */
-         Str_Copy (Ctr->ShrtName,row[4],
-                   Hie_MAX_BYTES_SHRT_NAME);
-
-         /* Get the full name of the centre (row[5]) */
-         Str_Copy (Ctr->FullName,row[5],
-                   Hie_MAX_BYTES_FULL_NAME);
-
-         /* Get the URL of the centre (row[6]) */
-         Str_Copy (Ctr->WWW,row[6],
-                   Cns_MAX_BYTES_WWW);
+         /* Get basic data of the centre (row[0]...row[6]) */
+         Ctr_GetBasicDataOfCentreFromRow (Ctr,row);
 
          /* Get number of users who claim to belong to this centre (row[7]) */
          if (sscanf (row[7],"%u",&Ctr->NumUsrsWhoClaimToBelongToCtr) != 1)
@@ -1233,6 +1211,39 @@ bool Ctr_GetDataOfCentreByCod (struct Centre *Ctr)
    return CtrFound;
   }
 
+/*****************************************************************************/
+/****** Get basic data of a centre from a row resulting of a query ***********/
+/*****************************************************************************/
+// Row must contain InsCod,PlcCod,Status,RequesterUsrCod,ShortName,FullName,WWW
+
+void Ctr_GetBasicDataOfCentreFromRow (struct Centre *Ctr,MYSQL_ROW row)
+  {
+   /***** Get the code of the institution (row[0]) *****/
+   Ctr->InsCod = Str_ConvertStrCodToLongCod (row[0]);
+
+   /***** Get the code of the place (row[1]) *****/
+   Ctr->PlcCod = Str_ConvertStrCodToLongCod (row[1]);
+
+   /***** Get centre status (row[2]) *****/
+   if (sscanf (row[2],"%u",&(Ctr->Status)) != 1)
+      Lay_ShowErrorAndExit ("Wrong centre status.");
+
+   /***** Get requester user's code (row[3]) *****/
+   Ctr->RequesterUsrCod = Str_ConvertStrCodToLongCod (row[3]);
+
+   /***** Get the short name of the centre (row[4]) *****/
+   Str_Copy (Ctr->ShrtName,row[4],
+             Hie_MAX_BYTES_SHRT_NAME);
+
+   /***** Get the full name of the centre (row[5]) *****/
+   Str_Copy (Ctr->FullName,row[5],
+             Hie_MAX_BYTES_FULL_NAME);
+
+   /***** Get the URL of the centre (row[6]) *****/
+   Str_Copy (Ctr->WWW,row[6],
+             Cns_MAX_BYTES_WWW);
+  }
+
 /*****************************************************************************/
 /*********** Get the institution code of a centre from its code **************/
 /*****************************************************************************/
@@ -1769,6 +1780,9 @@ void Ctr_RemoveCentre (void)
 	       (unsigned) Ctr.CtrCod);
       Fil_RemoveTree (PathCtr);
 
+      /***** Remove logo from manifest *****/
+      Log_RemoveLogoFromManifest (Sco_SCOPE_CTR,Ctr.CtrCod);
+
       /***** Remove centre *****/
       sprintf (Query,"DELETE FROM centres WHERE CtrCod=%ld",
 	       Ctr.CtrCod);
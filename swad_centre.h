@@ -27,6 +27,8 @@
 /********************************* Headers ***********************************/
 /*****************************************************************************/
 
+#include <mysql/mysql.h>	// To access MySQL databases
+
 #include "swad_action.h"
 #include "swad_constant.h"
 #include "swad_degree.h"
@@ -97,6 +99,7 @@ void Ctr_ShowCtrsOfCurrentIns (void);
 void Ctr_EditCentres (void);
 void Ctr_GetListCentres (long InsCod);
 bool Ctr_GetDataOfCentreByCod (struct Centre *Ctr);
+void Ctr_GetBasicDataOfCentreFromRow (struct Centre *Ctr,MYSQL_ROW row);
 long Ctr_GetInsCodOfCentreByCod (long CtrCod);
 void Ctr_GetShortNameOfCentreByCod (struct Centre *Ctr);
 void Ctr_FreeListCentres (void);
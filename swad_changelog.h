@@ -327,9 +327,9 @@ Hola Antonio, he ampliado el evento y nos deja comentar. El problema es que el p
 /****************************** Public constants *****************************/
 /*****************************************************************************/
 
-#define Log_PLATFORM_VERSION	"SWAD 17.27.1 (2017-12-20)"
+#define Log_PLATFORM_VERSION	"SWAD 17.54.17 (2018-05-20)"
 #define CSS_FILE		"swad17.25.4.css"
-#define JS_FILE			"swad17.17.1.js"
+#define JS_FILE			"swad17.40.js"
 
 // Number of lines (includes comments but not blank lines) has been got with the following command:
 // nl swad*.c swad*.h css/swad*.css py/swad*.py js/swad*.js soap/swad*?.h sql/swad*.sql | tail -1
@@ -343,6 +343,127 @@ En OpenSWAD:
 ps2pdf source.ps destination.pdf
 */
 /*
+        Version 17.54.17: May 20, 2018  The list of old users being removed is stored in a temporary table, so concurrent purges do not overwrite each other's list. (240333 lines)
+					1 change necessary in database:
+DROP TABLE IF EXISTS usr_old;
+
+        Version 17.54.16: May 20, 2018  Downloads with too long paths are rejected. Fixed possible truncation of dates in HTTP headers. (240344 lines)
+        Version 17.54.15: May 20, 2018  Fixed possible overflow in path to result of job. (240334 lines)
+        Version 17.54.14: May 20, 2018  Fixed possible overflow in name of partition of log. (240333 lines)
+        Version 17.54.13: May 20, 2018  Alerts for each user registered in groups are shown again when registering a list of users. (240329 lines)
+        Version 17.54.12: May 20, 2018  Times to generate and send automatic refreshes are stored in a sample accumulated by action and day.
+					Code to get user data from a row of usr_data is shared. (240255 lines)
+					1 change necessary in database:
+CREATE TABLE IF NOT EXISTS log_refresh (ActCod INT NOT NULL,ClickDay DATE NOT NULL,NumRefreshes INT NOT NULL DEFAULT 0,TimeToGenerate BIGINT NOT NULL DEFAULT 0,TimeToSend BIGINT NOT NULL DEFAULT 0,UNIQUE INDEX(ActCod,ClickDay));
+
+        Version 17.54.11: May 20, 2018  Pages with side columns are not cached. Actions declare a validator function in table of actions. Information of institution and degree can be cached. (240234 lines)
+        Version 17.54.10: May 20, 2018  Expired sessions with pending clicks in most frequently used actions are removed in every request, adding their clicks only once. (240152 lines)
+        Version 17.54.9:  May 20, 2018  Users and documents are selected with full-text indexes. LIKE is used only for words not in full-text indexes. (240164 lines)
+					4 changes necessary in database:
+ALTER TABLE usr_data ENGINE=MyISAM;
+ALTER TABLE usr_data ADD FULLTEXT(FirstName,Surname1,Surname2);
+ALTER TABLE files ENGINE=MyISAM;
+ALTER TABLE files ADD FULLTEXT(Name);
+
+        Version 17.54.8:  May 20, 2018  Fixed bug: pages cached by the client could show outdated side columns. Cached pages are shown without side columns. (240108 lines)
+        Version 17.54.7:  May 20, 2018  Fixed bug: two processes rotating log tables at the same time made one of them fail. (240095 lines)
+        Version 17.54.6:  May 20, 2018  Fixed bug: a file part without Content-Type stopped the parsing of the rest of parameters. (240083 lines)
+        Version 17.54.5:  May 20, 2018  Pages are compressed only if they are big enough. Content encoding is decided when the page is sent. Bytes before and after compression are stored in log_sample. (240077 lines)
+					1 change necessary in database:
+ALTER TABLE log_sample ADD COLUMN PageBytes INT NOT NULL DEFAULT 0 AFTER TimeToSend,ADD COLUMN SentBytes INT NOT NULL DEFAULT 0 AFTER PageBytes;
+
+        Version 17.54.4:  May 20, 2018  Search uses LIKE conditions to select results, as before full-text indexes. Full-text indexes only rank institutions, centres, degrees and courses found. (240021 lines)
+					6 changes necessary in database:
+ALTER TABLE usr_data DROP INDEX FirstName;
+ALTER TABLE files DROP INDEX Name;
+ALTER TABLE institutions ENGINE=MyISAM;
+ALTER TABLE centres ENGINE=MyISAM;
+ALTER TABLE degrees ENGINE=MyISAM;
+ALTER TABLE courses ENGINE=MyISAM;
+
+        Version 17.54.3:  May 20, 2018  Expired sessions with pending clicks in most frequently used actions removed from time to time, adding their clicks only once. (239997 lines)
+        Version 17.54.2:  May 20, 2018  Pending clicks in most frequently used actions written in the same query that updates session, only when session needs to be updated. (239942 lines)
+        Version 17.54.1:  May 20, 2018  Public link to user's photo is created when the photo is updated and not checked when the photo is shown. New tool swad_convert_photo_links to create links of existing photos. (239935 lines)
+        Version 17.54:    May 19, 2018  Log tables partitioned by date (daily partitions in log_recent, monthly partitions in log_full) and rotated adding and dropping partitions. New tool swad_convert_log to partition existing log tables. (239942 lines)
+        Version 17.53:    May 18, 2018  Fast approximate statistics of accesses, estimated from a sample of the log (new table log_sample with one of every 100 clicks). (239538 lines)
+					2 changes necessary in database:
+CREATE TABLE IF NOT EXISTS log_sample (LogCod INT NOT NULL,ActCod INT NOT NULL DEFAULT -1,CtyCod INT NOT NULL DEFAULT -1,InsCod INT NOT NULL DEFAULT -1,CtrCod INT NOT NULL DEFAULT -1,DegCod INT NOT NULL DEFAULT -1,CrsCod INT NOT NULL DEFAULT -1,UsrCod INT NOT NULL DEFAULT -1,Role TINYINT NOT NULL,ClickTime DATETIME NOT NULL,TimeToGenerate INT NOT NULL,TimeToSend INT NOT NULL,IP CHAR(15) NOT NULL,UNIQUE INDEX(LogCod),INDEX(ActCod),INDEX(CtyCod),INDEX(InsCod),INDEX(CtrCod),INDEX(DegCod),INDEX(CrsCod),INDEX(UsrCod),INDEX(ClickTime,Role));
+INSERT INTO log_sample (LogCod,ActCod,CtyCod,InsCod,CtrCod,DegCod,CrsCod,UsrCod,Role,ClickTime,TimeToGenerate,TimeToSend,IP) SELECT LogCod,ActCod,CtyCod,InsCod,CtrCod,DegCod,CrsCod,UsrCod,Role,ClickTime,TimeToGenerate,TimeToSend,IP FROM log_full WHERE LogCod MOD 100=0;
+
+        Version 17.52:    May 17, 2018  Clicks on most frequently used actions are stored in session and added to database in batches (every 10 clicks, on logout or when session expires). (239267 lines)
+					1 change necessary in database:
+ALTER TABLE sessions ADD COLUMN MFUClicks VARCHAR(255) NOT NULL DEFAULT '' AFTER SideCols;
+
+        Version 17.51:    May 16, 2018  In automatic refreshes via AJAX, my data are checked and got with only one query, and expensive initializations not needed are skipped. (239072 lines)
+        Version 17.50:    May 15, 2018  Pages sent compressed with gzip to clients that accept it (level set in Cfg_OUTPUT_COMPRESSION_LEVEL). (238922 lines)
+        Version 17.49:    May 14, 2018  Pages of course info shown to users not logged are sent with validators (ETag) and answered with HTTP 304 Not Modified when the client has an up-to-date copy. (238767 lines)
+        Version 17.48:    May 13, 2018  Files in file browsers sent by download actions using X-Sendfile, X-Accel-Redirect or sendfile, with support for ranges and conditional requests, instead of temporary public links. (238604 lines)
+        Version 17.47:    May 12, 2018  Attendance of students to several events got with one query. Roll call saved with batched queries. (238248 lines)
+        Version 17.46:    May 11, 2018  Files of marks indexed when uploaded. Marks of a user read directly from the rows in the index. (237953 lines)
+					1 change necessary in database:
+CREATE TABLE IF NOT EXISTS marks_rows (FilCod INT NOT NULL,NumRow INT NOT NULL,UsrID CHAR(16) NOT NULL,StartPos INT NOT NULL,EndPos INT NOT NULL,UNIQUE INDEX(FilCod,NumRow,UsrID),INDEX(FilCod,UsrID));
+
+        Version 17.45:    May 10, 2018  Files uploaded are read from stdin by blocks and parsed in memory. File content copied to destination inside the kernel. (237515 lines)
+        Version 17.44:    May 09, 2018  IDs of all the users in lists got in a single query. Fast check of privacy for users in current course. (237501 lines)
+        Version 17.43:    May 08, 2018  Manifest of logos in database and cache of logos and links to photos known in each request. (237257 lines)
+					1 change necessary in database:
+CREATE TABLE IF NOT EXISTS logos (Scope ENUM('Ins','Ctr','Deg') NOT NULL,Cod INT NOT NULL,LogoExists ENUM('N','Y') NOT NULL DEFAULT 'N',UNIQUE INDEX(Scope,Cod));
+
+        Version 17.42:    May 07, 2018  Faces in received photos detected by a local service through a UNIX socket, falling back to the command. (237045 lines)
+        Version 17.41:    May 06, 2018  Average photos of a degree computed from lists built once per sex and programs run in parallel. (236866 lines)
+        Version 17.40:    May 05, 2018  Background actions run by a worker process with progress refreshed via AJAX. (236748 lines)
+					3 changes necessary in database:
+CREATE TABLE IF NOT EXISTS jobs (JobCod INT NOT NULL AUTO_INCREMENT,UsrCod INT NOT NULL,ActCod INT NOT NULL,Params TEXT NOT NULL,Status TINYINT NOT NULL DEFAULT 0,Progress TINYINT NOT NULL DEFAULT 0,RequestTime DATETIME NOT NULL,StartTime DATETIME NOT NULL,EndTime DATETIME NOT NULL,UNIQUE INDEX(JobCod),INDEX(UsrCod,ActCod),INDEX(Status),INDEX(RequestTime));
+INSERT INTO actions (ActCod,Language,Obsolete,Txt) VALUES ('1735','es','N','Refrescar tarea en segundo plano');
+INSERT INTO actions (ActCod,Language,Obsolete,Txt) VALUES ('1736','es','N','Ver tarea en segundo plano');
+
+        Version 17.39:    May 04, 2018  Old users are eliminated with set-wise queries using a temporary table usr_old. (235872 lines)
+					1 change necessary in database:
+CREATE TABLE IF NOT EXISTS usr_old (UsrCod INT NOT NULL,UNIQUE INDEX(UsrCod));
+
+        Version 17.38:    May 03, 2018  Several users are registered in a course from a list of IDs, nicknames or emails with a few queries in a transaction, instead of several queries per user. (235694 lines)
+        Version 17.37:    May 02, 2018  Indicators of courses are computed for all the listed courses with one query per number, instead of several queries per course. (235398 lines)
+        Version 17.36:    May 01, 2018  Search of institutions, centres, degrees, courses, users and documents uses full-text indexes. (235091 lines)
+					8 changes necessary in database:
+ALTER TABLE files ADD COLUMN Name VARCHAR(255) COLLATE latin1_spanish_ci NOT NULL DEFAULT '' AFTER Path;
+UPDATE files SET Name=SUBSTRING_INDEX(Path,'/',-1);
+ALTER TABLE files ADD FULLTEXT(Name);
+ALTER TABLE institutions ADD FULLTEXT(FullName);
+ALTER TABLE centres ADD FULLTEXT(FullName);
+ALTER TABLE degrees ADD FULLTEXT(FullName);
+ALTER TABLE courses ADD FULLTEXT(FullName);
+ALTER TABLE usr_data ADD FULLTEXT(FirstName,Surname1,Surname2);
+
+        Version 17.35:    Apr 30, 2018  Number of posts is stored in each forum thread.
+					Numbers of threads and posts in a forum are got in one query.
+					Data of a thread are got in one query. (234995 lines)
+					4 changes necessary in database:
+ALTER TABLE forum_thread ADD COLUMN NumPsts INT NOT NULL DEFAULT 0 AFTER LastPstCod;
+UPDATE forum_thread SET NumPsts=(SELECT COUNT(*) FROM forum_post WHERE forum_post.ThrCod=forum_thread.ThrCod);
+ALTER TABLE forum_thread ADD INDEX(ForumType,Location);
+ALTER TABLE forum_post ADD INDEX(ThrCod,UsrCod);
+
+        Version 17.34:    Apr 29, 2018  Notifications of an event to many users are stored with one INSERT ... SELECT instead of one query per user.
+					Numbers of all and new unseen notifications are got with only one query and a new covering index. (235073 lines)
+					1 change necessary in database:
+ALTER TABLE notif ADD INDEX(ToUsrCod,Status,TimeNotif);
+
+        Version 17.33:    Apr 28, 2018  Messages in a page are got with only one query, instead of several queries per message.
+					Number of messages and page of expanded message are computed without retrieving all the messages.
+					New index to count unread messages. (235047 lines)
+					1 change necessary in database:
+ALTER TABLE msg_rcv ADD INDEX(UsrCod,Open,MsgCod);
+
+        Version 17.32:    Apr 27, 2018  Current course, degree, centre, institution and country are got in only one query joining all the levels.
+					Unused counters of current centre are not computed on every request. (235048 lines)
+        Version 17.31:    Apr 26, 2018  Numbers of connected users in each location are computed once and shared by all requests during a few seconds.
+					Number of connected users with each role got with only one query. (234863 lines)
+					1 change necessary in database:
+CREATE TABLE IF NOT EXISTS connected_counts (Scope ENUM('Sys','Cty','Ins','Ctr','Deg','Crs') NOT NULL DEFAULT 'Sys',Cod INT NOT NULL DEFAULT -1,Role TINYINT NOT NULL DEFAULT 0,NumUsrs INT NOT NULL DEFAULT 0,Sex ENUM ('unknown','female','male','all') NOT NULL DEFAULT 'all',ComputedTime DATETIME NOT NULL,UNIQUE INDEX(Scope,Cod,Role));
+
+        Version 17.30:    Apr 25, 2018  Sessions are not updated in database when nothing has changed in the last seconds.
+					Refreshes of last refresh time in sessions are coalesced.
+					Hidden parameters of a session are not queried nor removed when there are none. (234692 lines)
         Version 17.29:    Apr 24, 2018  Code refactoring and bug fixing related to actions. (234579 lines)
         Version 17.28:    Jan 09, 2018  Added average of all test exams. (? lines)
         Version 17.27.2:  Dec 20, 2017  Changes displaying a game question. (234507 lines)
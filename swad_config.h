@@ -348,9 +348,32 @@
 /* Folder for temporary HTML output of this CGI, inside private swad directory */
 #define Cfg_FOLDER_OUT 				"out"			// Created automatically the first time it is accessed
 
+/* Compression level of the HTML pages sent to clients accepting gzip encoding:
+   0 = pages are not compressed (for example, if the web server compresses them),
+   1 = fastest compression ... 9 = best compression */
+#define Cfg_OUTPUT_COMPRESSION_LEVEL		6
+
+/* Pages smaller than this are sent uncompressed,
+   because compressing them saves almost nothing and costs CPU */
+#define Cfg_MIN_BYTES_TO_COMPRESS_OUTPUT	1024
+
+/* Folder for results of actions executed in background, inside private swad directory */
+#define Cfg_FOLDER_JOB 				"job"			// Created automatically the first time it is accessed
+
 /* Folder for temporary public links to file zones, used when displaying file browsers, inside public swad directory */
 #define Cfg_FOLDER_FILE_BROWSER_TMP		"tmp"			// Created automatically the first time it is accessed
 
+/* How files in file browsers are sent when downloaded:
+   - Cfg_DOWNLOAD_STREAM: this CGI sends the file, supporting ranges and conditional requests
+   - Cfg_DOWNLOAD_X_SENDFILE: web server sends the private file given in header X-Sendfile (Apache with mod_xsendfile)
+   - Cfg_DOWNLOAD_X_ACCEL_REDIRECT: web server sends the file given in header X-Accel-Redirect (nginx) */
+#define Cfg_DOWNLOAD_STREAM			0
+#define Cfg_DOWNLOAD_X_SENDFILE			1
+#define Cfg_DOWNLOAD_X_ACCEL_REDIRECT		2
+#define Cfg_DOWNLOAD_METHOD			Cfg_DOWNLOAD_STREAM
+/* Internal location of the web server mapped to Cfg_PATH_SWAD_PRIVATE, used with X-Accel-Redirect */
+#define Cfg_URL_X_ACCEL_REDIRECT_PRIVATE	"/swad_private"		// Without ending slash
+
 /* Folder where temporary files are created for students' marks, inside private swad directory */
 #define Cfg_FOLDER_MARK				"mark"			// Created automatically the first time it is accessed
 
@@ -434,9 +457,15 @@
 // %s must be substituted by temporary file with the image received:
 #define Cfg_COMMAND_FACE_DETECTION			"./fotomaton options %s 540"
 
+/* Face detection service: a long-lived local process with the detection model loaded once.
+   If its UNIX socket does not exist or it does not respond in time, the command above is run */
+#define Cfg_FACE_DETECTION_SOCKET			"/var/run/fotomaton/fotomaton.sock"
+#define Cfg_TIME_TO_WAIT_FACE_DETECTION			10	// Seconds waiting for the face detection service before running the command
+
 /* Commands to compute the average photo of a degree */
 #define Cfg_COMMAND_DEGREE_PHOTO_MEDIAN			"./foto_mediana"
 #define Cfg_COMMAND_DEGREE_PHOTO_AVERAGE		"./foto_promedio"
+#define Cfg_MAX_PROCESSES_TO_COMPUTE_AVG_PHOTO		4	// Maximum number of processes computing average photos at the same time
 
 /* Command to send automatic emails, programmed by Antonio F. Daz-Garca and Antonio Caas-Vargas */
 #define Cfg_COMMAND_SEND_AUTOMATIC_EMAIL		"./swad_smtp.py"
@@ -450,16 +479,22 @@
 
 #define Cfg_DAYS_IN_RECENT_LOG				 15	// Only accesses in these last days + 1 are stored in recent log.
 								// Important!!! Must be 1 <= Cfg_DAYS_IN_RECENT_LOG <= 29
+#define Cfg_CLICKS_PER_SAMPLE_IN_LOG			100	// One of every these clicks is stored in sample log,
+								// used to get fast approximate statistics
 #define Cfg_TIMES_PER_SECOND_REFRESH_CONNECTED		  2	// Execute this CGI to refresh connected users about these times per second
 #define Cfg_MIN_TIME_TO_REFRESH_CONNECTED		((time_t)(                     60UL))	// Refresh period of connected users in seconds
 #define Cfg_MAX_TIME_TO_REFRESH_CONNECTED		((time_t)(              15UL * 60UL))	// Refresh period of connected users in seconds
+#define Cfg_TIME_TO_RECOMPUTE_CONNECTED_COUNTS		((time_t)(                     10UL))	// Numbers of connected users are shared by all requests during these seconds
 #define Cfg_TIME_TO_CLOSE_SESSION_FROM_LAST_REFRESH	((time_t)(Cfg_MAX_TIME_TO_REFRESH_CONNECTED * 4))	// After these seconds without refresh of connected users, session is closed
 #define Cfg_TIME_TO_CLOSE_SESSION_FROM_LAST_CLICK	((time_t)(          8 * 60UL * 60UL))	// After these seconds without user's clicks, session is closed
+#define Cfg_TIME_TO_UPDATE_SESSION_IN_DB		((time_t)(                     60UL))	// Unchanged session is not written again in database until these seconds have passed
 
 #define Cfg_TIME_TO_REFRESH_LAST_CLICKS			((time_t)(             1UL * 1000UL))	// Refresh period of last clicks in miliseconds
 
 #define Cfg_TIME_TO_REFRESH_SOCIAL_TIMELINE		((time_t)(            10UL * 1000UL))	// Refresh period of social timeline in miliseconds
 
+#define Cfg_TIME_TO_REFRESH_JOB				((time_t)(             2UL * 1000UL))	// Refresh period of the status of a job executed in background in miliseconds
+
 #define Cfg_TIME_TO_CHANGE_BANNER			((time_t)(               2UL * 60UL))	// After these seconds, change banner
 #define Cfg_NUMBER_OF_BANNERS				1					// Number of banners to show simultaneously
 
@@ -467,6 +502,8 @@
 
 #define Cfg_TIME_TO_DELETE_HTML_OUTPUT			((time_t)(              30UL * 60UL))	// Remove the HTML output files older than these seconds
 
+#define Cfg_TIME_TO_DELETE_JOBS				((time_t)(       24UL * 60UL * 60UL))	// Remove the jobs executed in background and their results older than these seconds
+
 #define Cfg_TIME_TO_ABORT_FILE_UPLOAD			((time_t)(              55UL * 60UL))	// After these seconds uploading data, abort upload.
 
 #define Cfg_TIME_TO_DELETE_BROWSER_TMP_FILES		((time_t)(        2UL * 60UL * 60UL))  	// Temporary files are deleted after these seconds
@@ -65,9 +65,14 @@ static void Con_ShowConnectedUsrsBelongingToLocation (void);
 
 static void Con_ShowConnectedUsrsWithARoleBelongingToCurrentLocationOnMainZone (Rol_Role_t Role);
 static void Con_ShowConnectedUsrsWithARoleBelongingToCurrentCrsOnRightColumn (Rol_Role_t Role);
-static unsigned Con_GetConnectedUsrsTotal (Rol_Role_t Role);
+static void Con_GetConnectedUsrsTotal (unsigned NumUsrs[Rol_NUM_ROLES]);
 
 static void Con_GetNumConnectedUsrsWithARoleBelongingCurrentLocation (Rol_Role_t Role,struct ConnectedUsrs *Usrs);
+static bool Con_GetNumConnectedUsrsFromCounts (Sco_Scope_t Scope,long Cod,Rol_Role_t Role,
+                                               struct ConnectedUsrs *Usrs);
+static void Con_StoreNumConnectedUsrsInCounts (Sco_Scope_t Scope,long Cod,Rol_Role_t Role,
+                                               const struct ConnectedUsrs *Usrs);
+static void Con_ComputeNumConnectedUsrsWithARoleBelongingCurrentLocation (Rol_Role_t Role,struct ConnectedUsrs *Usrs);
 static void Con_ComputeConnectedUsrsWithARoleCurrentCrsOneByOne (Rol_Role_t Role);
 static void Con_ShowConnectedUsrsCurrentCrsOneByOneOnRightColumn (Rol_Role_t Role);
 static void Con_WriteRowConnectedUsrOnRightColumn (Rol_Role_t Role);
@@ -355,13 +360,11 @@ void Con_ShowGlobalConnectedUsrs (void)
    unsigned NumUsrsTotal;
 
    /***** Get number of connected users *****/
+   Con_GetConnectedUsrsTotal (NumUsrs);
    for (Role  = Rol_GST, NumUsrsTotal = 0;
 	Role <= Rol_SYS_ADM;
 	Role++)
-     {
-      NumUsrs[Role] = Con_GetConnectedUsrsTotal (Role);
       NumUsrsTotal += NumUsrs[Role];
-     }
 
    /***** Container start *****/
    fprintf (Gbl.F.Out,"<div class=\"CONNECTED\">");
@@ -661,28 +664,174 @@ void Con_RemoveOldConnected (void)
   }
 
 /*****************************************************************************/
-/********************* Get connected users with a role ***********************/
+/****************** Get number of connected users per role *******************/
 /*****************************************************************************/
 
-static unsigned Con_GetConnectedUsrsTotal (Rol_Role_t Role)
+static void Con_GetConnectedUsrsTotal (unsigned NumUsrs[Rol_NUM_ROLES])
   {
    char Query[128];
+   MYSQL_RES *mysql_res;
+   MYSQL_ROW row;
+   unsigned long NumRows;
+   unsigned long NumRow;
+   Rol_Role_t Role;
+   unsigned UnsignedNum;
+
+   /***** Reset number of connected users with each role *****/
+   for (Role = (Rol_Role_t) 0;
+	Role < Rol_NUM_ROLES;
+	Role++)
+      NumUsrs[Role] = 0;
 
    if (!Gbl.DB.DatabaseIsOpen)
-      return 0;
+      return;
 
-   /***** Get number of connected users with a role from database *****/
-   sprintf (Query,"SELECT COUNT(*) FROM connected WHERE RoleInLastCrs=%u",
-            (unsigned) Role);
-   return (unsigned) DB_QueryCOUNT (Query,"can not get number of connected users");
+   /***** Get number of connected users with each role from database *****/
+   sprintf (Query,"SELECT RoleInLastCrs,COUNT(*) FROM connected"
+	          " GROUP BY RoleInLastCrs");
+   NumRows = DB_QuerySELECT (Query,&mysql_res,"can not get number of connected users");
+   for (NumRow = 0;
+	NumRow < NumRows;
+	NumRow++)
+     {
+      row = mysql_fetch_row (mysql_res);
+
+      /* Get role (row[0]) and number of users with this role (row[1]) */
+      if (sscanf (row[0],"%u",&UnsignedNum) == 1)
+	 if (UnsignedNum < Rol_NUM_ROLES)
+	    if (sscanf (row[1],"%u",&NumUsrs[UnsignedNum]) != 1)
+	       NumUsrs[UnsignedNum] = 0;
+     }
+
+   /***** Free structure that stores the query result *****/
+   DB_FreeMySQLResult (&mysql_res);
   }
 
 /*****************************************************************************/
 /************** Get connected users belonging to current course **************/
 /*****************************************************************************/
 // Return user's sex in UsrSex
+// The number is got from a recent snapshot shared by all the requests,
+// and only computed when the snapshot is too old
 
 static void Con_GetNumConnectedUsrsWithARoleBelongingCurrentLocation (Rol_Role_t Role,struct ConnectedUsrs *Usrs)
+  {
+   Sco_Scope_t Scope;
+   long Cod;
+
+   /***** Get current location *****/
+   Scope = (Role == Rol_GST) ? Sco_SCOPE_SYS :	// Guests are counted in the whole platform
+	                       Gbl.Scope.Current;
+   switch (Scope)
+     {
+      case Sco_SCOPE_SYS:
+	 Cod = -1L;
+	 break;
+      case Sco_SCOPE_CTY:
+	 Cod = Gbl.CurrentCty.Cty.CtyCod;
+	 break;
+      case Sco_SCOPE_INS:
+	 Cod = Gbl.CurrentIns.Ins.InsCod;
+	 break;
+      case Sco_SCOPE_CTR:
+	 Cod = Gbl.CurrentCtr.Ctr.CtrCod;
+	 break;
+      case Sco_SCOPE_DEG:
+	 Cod = Gbl.CurrentDeg.Deg.DegCod;
+	 break;
+      case Sco_SCOPE_CRS:
+	 Cod = Gbl.CurrentCrs.Crs.CrsCod;
+	 break;
+      default:
+	 Lay_ShowErrorAndExit ("Wrong scope.");
+	 return;	// Not reached, used to avoid warning
+     }
+
+   /***** Get number of connected users from snapshot or compute it *****/
+   if (!Con_GetNumConnectedUsrsFromCounts (Scope,Cod,Role,Usrs))
+     {
+      Con_ComputeNumConnectedUsrsWithARoleBelongingCurrentLocation (Role,Usrs);
+      Con_StoreNumConnectedUsrsInCounts (Scope,Cod,Role,Usrs);
+     }
+  }
+
+/*****************************************************************************/
+/***** Get number of connected users in a location from a recent snapshot ****/
+/*****************************************************************************/
+// Return true if a recent number is found
+
+static bool Con_GetNumConnectedUsrsFromCounts (Sco_Scope_t Scope,long Cod,Rol_Role_t Role,
+                                               struct ConnectedUsrs *Usrs)
+  {
+   extern const char *Sco_ScopeDB[Sco_NUM_SCOPES];
+   extern const char *Usr_StringsSexDB[Usr_NUM_SEXS];
+   char Query[256];
+   MYSQL_RES *mysql_res;
+   MYSQL_ROW row;
+   Usr_Sex_t Sex;
+   bool Found = false;
+
+   /***** Get number of connected users from database *****/
+   sprintf (Query,"SELECT NumUsrs,Sex FROM connected_counts"
+	          " WHERE Scope='%s' AND Cod=%ld AND Role=%u"
+	          " AND ComputedTime>FROM_UNIXTIME(UNIX_TIMESTAMP()-%lu)",
+	    Sco_ScopeDB[Scope],Cod,(unsigned) Role,
+	    (unsigned long) Cfg_TIME_TO_RECOMPUTE_CONNECTED_COUNTS);
+   if (DB_QuerySELECT (Query,&mysql_res,"can not get number of connected users"))
+     {
+      row = mysql_fetch_row (mysql_res);
+
+      /* Get number of users (row[0]) */
+      if (sscanf (row[0],"%u",&(Usrs->NumUsrs)) == 1)
+	{
+	 /* Get users' sex (row[1]) */
+	 Usrs->Sex = Usr_SEX_UNKNOWN;
+	 for (Sex = (Usr_Sex_t) 0;
+	      Sex < Usr_NUM_SEXS;
+	      Sex++)
+	    if (!strcasecmp (row[1],Usr_StringsSexDB[Sex]))
+	      {
+	       Usrs->Sex = Sex;
+	       break;
+	      }
+
+	 Found = true;
+	}
+     }
+
+   /***** Free structure that stores the query result *****/
+   DB_FreeMySQLResult (&mysql_res);
+
+   return Found;
+  }
+
+/*****************************************************************************/
+/****** Store number of connected users in a location to share it with *******/
+/****** the rest of requests during a few seconds                      *******/
+/*****************************************************************************/
+
+static void Con_StoreNumConnectedUsrsInCounts (Sco_Scope_t Scope,long Cod,Rol_Role_t Role,
+                                               const struct ConnectedUsrs *Usrs)
+  {
+   extern const char *Sco_ScopeDB[Sco_NUM_SCOPES];
+   extern const char *Usr_StringsSexDB[Usr_NUM_SEXS];
+   char Query[256];
+
+   sprintf (Query,"REPLACE INTO connected_counts"
+	          " (Scope,Cod,Role,NumUsrs,Sex,ComputedTime)"
+	          " VALUES"
+	          " ('%s',%ld,%u,%u,'%s',NOW())",
+	    Sco_ScopeDB[Scope],Cod,(unsigned) Role,
+	    Usrs->NumUsrs,Usr_StringsSexDB[Usrs->Sex]);
+   DB_QueryREPLACE (Query,"can not store number of connected users");
+  }
+
+/*****************************************************************************/
+/********* Compute number of connected users in current location *************/
+/*****************************************************************************/
+// Return user's sex in UsrSex
+
+static void Con_ComputeNumConnectedUsrsWithARoleBelongingCurrentLocation (Rol_Role_t Role,struct ConnectedUsrs *Usrs)
   {
    extern const char *Usr_StringsSexDB[Usr_NUM_SEXS];
    char Query[512];
@@ -0,0 +1,197 @@
+// swad_convert_log.c
+// Created on: 19/05/2018
+// Author: Antonio Caas Vargas
+// Compile with: gcc -Wall -O1 swad_convert_log.c -o swad_convert_log -lmysqlclient -L/usr/lib64/mysql
+
+// Partition log tables by date:
+// log_recent in daily partitions pYYYYMMDD and log_full in monthly partitions pYYYYMM,
+// both ended with a partition pmax for the entries not in other partitions.
+// Later, swad adds new partitions and drops old ones (see Sta_RotateLogTables).
+// Unique indexes in partitioned tables must include the partitioning column,
+// so index LogCod is changed to (LogCod,ClickTime).
+// Partitioning a big table may last a long time. Make a backup before!
+
+#include <mysql/mysql.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define DATABASE_HOST		"swad.ugr.es"
+#define DATABASE_USER		"swad"
+#define DATABASE_PASSWORD	"********"
+#define DATABASE_DBNAME		"swad"
+
+#define DAYS_OF_PARTITIONS_AHEAD	7	// Daily partitions created in advance in log_recent
+#define MONTHS_OF_PARTITIONS_AHEAD	2	// Monthly partitions created in advance in log_full
+#define MAX_PARTITIONS			8000	// MySQL allows up to 8192 partitions per table
+#define MAX_BYTES_PARTITION		128
+
+MYSQL mysql;
+
+void ExecuteQuery (const char *Query)
+  {
+   printf ("%s\n",Query);
+
+   if (mysql_query (&mysql,Query))
+     {
+      fprintf (stderr,"%s\n",mysql_error (&mysql));
+      exit (3);
+     }
+  }
+
+MYSQL_RES *QuerySELECT (const char *Query)
+  {
+   MYSQL_RES *mysql_res;
+
+   if (mysql_query (&mysql,Query))
+     {
+      fprintf (stderr,"%s\n",mysql_error (&mysql));
+      exit (3);
+     }
+   if ((mysql_res = mysql_store_result (&mysql)) == NULL)
+     {
+      fprintf (stderr,"%s\n",mysql_error (&mysql));
+      exit (4);
+     }
+   return mysql_res;
+  }
+
+void PartitionLogTable (const char *Table,int Monthly)
+  {
+   char Query[512];
+   char *QueryPartition;
+   MYSQL_RES *mysql_res;
+   MYSQL_ROW row;
+   unsigned Year;
+   unsigned Month;
+   unsigned Day;
+   int OldestFound = 0;
+   time_t Now = time (NULL);
+   time_t TimeLast;
+   struct tm tm;
+   struct tm tmNext;
+   unsigned NumPartitions;
+   size_t Length;
+
+   /***** Check if table is already partitioned *****/
+   sprintf (Query,"SELECT COUNT(*) FROM information_schema.PARTITIONS"
+		  " WHERE TABLE_SCHEMA=DATABASE() AND TABLE_NAME='%s'"
+		  " AND PARTITION_NAME IS NOT NULL",
+	    Table);
+   mysql_res = QuerySELECT (Query);
+   row = mysql_fetch_row (mysql_res);
+   if (strcmp (row[0],"0"))
+     {
+      printf ("# Table %s is already partitioned\n",Table);
+      mysql_free_result (mysql_res);
+      return;
+     }
+   mysql_free_result (mysql_res);
+
+   /***** Get date of oldest entry *****/
+   sprintf (Query,"SELECT DATE(MIN(ClickTime)) FROM %s",Table);
+   mysql_res = QuerySELECT (Query);
+   row = mysql_fetch_row (mysql_res);
+   if (row[0])
+      OldestFound = (sscanf (row[0],"%u-%u-%u",&Year,&Month,&Day) == 3);
+   mysql_free_result (mysql_res);
+
+   /***** First partition: day or month of oldest entry, or today *****/
+   tm = *localtime (&Now);
+   if (OldestFound)
+     {
+      tm.tm_year = (int) Year - 1900;
+      tm.tm_mon  = (int) Month - 1;
+      tm.tm_mday = (int) Day;
+     }
+   tm.tm_hour = 12;	// Avoid problems with daylight saving time
+   tm.tm_min = tm.tm_sec = 0;
+   tm.tm_isdst = -1;
+   if (Monthly)
+      tm.tm_mday = 1;
+   mktime (&tm);
+
+   /***** Last partition: some days or months ahead *****/
+   tmNext = *localtime (&Now);
+   tmNext.tm_hour = 12;
+   tmNext.tm_min = tmNext.tm_sec = 0;
+   tmNext.tm_isdst = -1;
+   if (Monthly)
+     {
+      tmNext.tm_mday = 1;
+      tmNext.tm_mon += MONTHS_OF_PARTITIONS_AHEAD;
+     }
+   else
+      tmNext.tm_mday += DAYS_OF_PARTITIONS_AHEAD;
+   TimeLast = mktime (&tmNext);
+
+   /***** Allocate space for query *****/
+   if ((QueryPartition = (char *) malloc (1024 + MAX_PARTITIONS * MAX_BYTES_PARTITION)) == NULL)
+     {
+      fprintf (stderr,"Not enough memory for query.\n");
+      exit (5);
+     }
+
+   /***** Build query *****/
+   Length = sprintf (QueryPartition,"ALTER TABLE %s"
+				    " DROP INDEX LogCod,"
+				    " ADD UNIQUE INDEX LogCod (LogCod,ClickTime)"
+				    " PARTITION BY RANGE (TO_DAYS(ClickTime)) (",
+		     Table);
+   for (NumPartitions = 0;
+	NumPartitions < MAX_PARTITIONS &&
+	mktime (&tm) <= TimeLast;
+	NumPartitions++)
+     {
+      tmNext = tm;
+      if (Monthly)
+	{
+	 tmNext.tm_mon++;
+	 mktime (&tmNext);
+	 Length += sprintf (QueryPartition + Length,
+			    "PARTITION p%04d%02d"
+			    " VALUES LESS THAN (TO_DAYS('%04d-%02d-01')),",
+			    1900 + tm.tm_year,1 + tm.tm_mon,
+			    1900 + tmNext.tm_year,1 + tmNext.tm_mon);
+	}
+      else
+	{
+	 tmNext.tm_mday++;
+	 mktime (&tmNext);
+	 Length += sprintf (QueryPartition + Length,
+			    "PARTITION p%04d%02d%02d"
+			    " VALUES LESS THAN (TO_DAYS('%04d-%02d-%02d')),",
+			    1900 + tm.tm_year,1 + tm.tm_mon,tm.tm_mday,
+			    1900 + tmNext.tm_year,1 + tmNext.tm_mon,tmNext.tm_mday);
+	}
+      tm = tmNext;
+     }
+   sprintf (QueryPartition + Length,"PARTITION pmax VALUES LESS THAN MAXVALUE)");
+
+   /***** Partition table *****/
+   ExecuteQuery (QueryPartition);
+   free ((void *) QueryPartition);
+
+   printf ("# Table %s: %u partitions + pmax\n",Table,NumPartitions);
+  }
+
+int main (void)
+  {
+   if (mysql_init (&mysql) == NULL)
+     {
+      fprintf (stderr,"Can not init MySQL.");
+      return 1;
+     }
+   if (!mysql_real_connect (&mysql,DATABASE_HOST,DATABASE_USER,DATABASE_PASSWORD,DATABASE_DBNAME,0,NULL,0))
+     {
+      fprintf (stderr,"Can not connect to database");
+      return 2;
+     }
+
+   PartitionLogTable ("log_recent",0);	// Daily partitions
+   PartitionLogTable ("log_full",1);	// Monthly partitions
+
+   mysql_close (&mysql);
+   return 0;
+  }
@@ -0,0 +1,97 @@
+// swad_convert_photo_links.c
+// Created on: 20/05/2018
+// Author: Antonio Caas Vargas
+// Compile with: gcc -Wall -O1 swad_convert_photo_links.c -o swad_convert_photo_links -lmysqlclient -L/usr/lib64/mysql
+
+// Create the public links to the private photos of all users.
+// Since version 17.54.1, swad creates the public link when a photo is updated
+// and does not check it when the photo is shown, so photos uploaded before
+// need their links created once with this program.
+
+#include <mysql/mysql.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define DATABASE_HOST		"swad.ugr.es"
+#define DATABASE_USER		"swad"
+#define DATABASE_PASSWORD	"********"
+#define DATABASE_DBNAME		"swad"
+#define PATH_SWAD_PRIVATE	"/var/www/swad"
+#define PATH_SWAD_PUBLIC	"/var/www/html/swad"
+#define FOLDER_PHOTO		"photo"
+
+int CheckIfPathExists (const char *Path)
+  {
+   return access (Path,F_OK) ? 0 :
+	                       1;
+  }
+
+int main (void)
+  {
+   char *Query = "SELECT UsrCod,Photo FROM usr_data WHERE Photo<>'' ORDER BY UsrCod";
+   MYSQL mysql;
+   MYSQL_RES *mysql_res;
+   MYSQL_ROW row;
+   unsigned NumRows;
+   unsigned NumLinks = 0;
+   unsigned i;
+   long UsrCod;
+   char PathPublPhoto[PATH_MAX + 1];
+   char PathPrivPhoto[PATH_MAX + 1];
+
+   if (mysql_init (&mysql) == NULL)
+     {
+      fprintf (stderr,"Can not init MySQL.");
+      return 1;
+     }
+   if (!mysql_real_connect (&mysql,DATABASE_HOST,DATABASE_USER,DATABASE_PASSWORD,DATABASE_DBNAME,0,NULL,0))
+     {
+      fprintf (stderr,"Can not connect to database");
+      return 2;
+     }
+   if (mysql_query (&mysql,Query))
+     {
+      fprintf (stderr,"%s",mysql_error (&mysql));
+      return 3;
+     }
+   if ((mysql_res = mysql_store_result (&mysql)) == NULL)
+     {
+      fprintf (stderr,"%s",mysql_error (&mysql));
+      return 4;
+     }
+   if ((NumRows = (unsigned) mysql_num_rows (mysql_res)))
+     {
+      for (i=0; i<NumRows; i++)
+	{
+	 row = mysql_fetch_row (mysql_res);
+	 if (row[0])
+	    if (sscanf (row[0],"%ld",&UsrCod) == 1)	// UsrCod
+	       if (row[1])
+		  if (row[1][0])			// Photo
+		    {
+		     sprintf (PathPublPhoto,"%s/%s/%s.jpg",
+			      PATH_SWAD_PUBLIC,FOLDER_PHOTO,row[1]);
+		     sprintf (PathPrivPhoto,"%s/%s/%02u/%ld.jpg",
+			      PATH_SWAD_PRIVATE,FOLDER_PHOTO,(unsigned) (UsrCod % 100),UsrCod);
+		     if (!CheckIfPathExists (PathPublPhoto) &&
+			 CheckIfPathExists (PathPrivPhoto))
+		       {
+			printf ("%s -> %s\n",PathPublPhoto,PathPrivPhoto);
+			if (symlink (PathPrivPhoto,PathPublPhoto) != 0)
+			   fprintf (stderr,"Can not create link %s\n",PathPublPhoto);
+			else
+			   NumLinks++;
+		       }
+		    }
+	}
+     }
+   mysql_free_result (mysql_res);
+   mysql_close (&mysql);
+
+   printf ("# Rows : %u\n"
+	   "# Links: %u\n",NumRows,NumLinks);
+   return 0;
+  }
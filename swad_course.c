@@ -100,7 +100,6 @@ static void Crs_RecFormRequestOrCreateCrs (unsigned Status);
 static void Crs_GetParamsNewCourse (struct Course *Crs);
 
 static void Crs_CreateCourse (unsigned Status);
-static void Crs_GetDataOfCourseFromRow (struct Course *Crs,MYSQL_ROW row);
 
 static void Crs_UpdateCrsDegDB (long CrsCod,long DegCod);
 
@@ -2033,7 +2032,7 @@ bool Crs_GetDataOfCourseByCod (struct Course *Crs)
 /********** Get data of a course from a row resulting of a query *************/
 /*****************************************************************************/
 
-static void Crs_GetDataOfCourseFromRow (struct Course *Crs,MYSQL_ROW row)
+void Crs_GetDataOfCourseFromRow (struct Course *Crs,MYSQL_ROW row)
   {
    /***** Get course code (row[0]) *****/
    if ((Crs->CrsCod = Str_ConvertStrCodToLongCod (row[0])) < 0)
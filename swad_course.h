@@ -115,6 +115,7 @@ void Crs_RecFormNewCrs (void);
 
 void Crs_RemoveCourse (void);
 bool Crs_GetDataOfCourseByCod (struct Course *Crs);
+void Crs_GetDataOfCourseFromRow (struct Course *Crs,MYSQL_ROW row);
 void Crs_RemoveCourseCompletely (long CrsCod);
 void Crs_ChangeInsCrsCodInConfig (void);
 void Crs_ChangeInsCrsCod (void);
@@ -440,7 +440,8 @@ mysql> DESCRIBE centres;
 		   "UNIQUE INDEX(CtrCod),"
 		   "INDEX(InsCod),"
 		   "INDEX(PlcCod),"
-		   "INDEX(Status))");
+		   "INDEX(Status),"
+		   "FULLTEXT(FullName)) ENGINE = MYISAM;");
 
    /***** Table chat *****/
 /*
@@ -524,6 +525,30 @@ mysql> DESCRIBE connected;
 		   "INDEX(RoleInLastCrs),"
 		   "INDEX(LastCrsCod))");
 
+   /***** Table connected_counts *****/
+/*
+mysql> DESCRIBE connected_counts;
++--------------+-------------------------------------------+------+-----+---------+-------+
+| Field        | Type                                      | Null | Key | Default | Extra |
++--------------+-------------------------------------------+------+-----+---------+-------+
+| Scope        | enum('Sys','Cty','Ins','Ctr','Deg','Crs') | NO   | PRI | Sys     |       |
+| Cod          | int(11)                                   | NO   | PRI | -1      |       |
+| Role         | tinyint(4)                                | NO   | PRI | 0       |       |
+| NumUsrs      | int(11)                                   | NO   |     | 0       |       |
+| Sex          | enum('unknown','female','male','all')     | NO   |     | all     |       |
+| ComputedTime | datetime                                  | NO   |     | NULL    |       |
++--------------+-------------------------------------------+------+-----+---------+-------+
+6 rows in set (0,00 sec)
+*/
+   DB_CreateTable ("CREATE TABLE IF NOT EXISTS connected_counts ("
+			"Scope ENUM('Sys','Cty','Ins','Ctr','Deg','Crs') NOT NULL DEFAULT 'Sys',"
+			"Cod INT NOT NULL DEFAULT -1,"
+			"Role TINYINT NOT NULL DEFAULT 0,"
+			"NumUsrs INT NOT NULL DEFAULT 0,"
+			"Sex ENUM ('unknown','female','male','all') NOT NULL DEFAULT 'all',"
+			"ComputedTime DATETIME NOT NULL,"
+		   "UNIQUE INDEX(Scope,Cod,Role))");
+
    /***** Table countries *****/
 /*
 mysql> DESCRIBE countries;
@@ -617,7 +642,8 @@ mysql> DESCRIBE courses;
 			"NumIndicators INT NOT NULL DEFAULT -1,"
 		   "UNIQUE INDEX(CrsCod),"
 		   "INDEX(DegCod,Year),"
-		   "INDEX(Status))");
+		   "INDEX(Status),"
+		   "FULLTEXT(FullName)) ENGINE = MYISAM;");
 
    /***** Table crs_grp *****/
 /*
@@ -915,7 +941,8 @@ mysql> DESCRIBE degrees;
 		   "UNIQUE INDEX(DegCod),"
 		   "INDEX(CtrCod),"
 		   "INDEX(DegTypCod),"
-		   "INDEX(Status))");
+		   "INDEX(Status),"
+		   "FULLTEXT(FullName)) ENGINE = MYISAM;");
 
    /***** Table departments *****/
 /*
@@ -1093,11 +1120,12 @@ mysql> DESCRIBE files;
 | PublisherUsrCod | int(11)       | NO   | MUL | NULL    |                |
 | FileType        | tinyint(4)    | NO   |     | 0       |                |
 | Path            | text          | NO   |     | NULL    |                |
+| Name            | varchar(255)  | NO   | MUL |         |                |
 | Hidden          | enum('N','Y') | NO   |     | N       |                |
 | Public          | enum('N','Y') | NO   |     | N       |                |
 | License         | tinyint(4)    | NO   |     | 0       |                |
 +-----------------+---------------+------+-----+---------+----------------+
-10 rows in set (0.00 sec)
+11 rows in set (0.00 sec)
 */
    DB_CreateTable ("CREATE TABLE IF NOT EXISTS files ("
 			"FilCod INT NOT NULL AUTO_INCREMENT,"
@@ -1107,13 +1135,15 @@ mysql> DESCRIBE files;
 			"PublisherUsrCod INT NOT NULL,"
 			"FileType TINYINT NOT NULL DEFAULT 0,"
 			"Path TEXT COLLATE latin1_bin NOT NULL,"	// PATH_MAX
+			"Name VARCHAR(255) COLLATE latin1_spanish_ci NOT NULL DEFAULT '',"	// NAME_MAX
 			"Hidden ENUM('N','Y') NOT NULL DEFAULT 'N',"
 			"Public ENUM('N','Y') NOT NULL DEFAULT 'N',"
 			"License TINYINT NOT NULL DEFAULT 0,"
 		   "UNIQUE INDEX(FilCod),"
 		   "INDEX(FileBrowser,Cod,ZoneUsrCod),"
 		   "INDEX(ZoneUsrCod),"
-		   "INDEX(PublisherUsrCod))");
+		   "INDEX(PublisherUsrCod),"
+		   "FULLTEXT(Name)) ENGINE = MYISAM;");
 
    /***** Table forum_disabled_post *****/
 /*
@@ -1167,6 +1197,7 @@ mysql> DESCRIBE forum_post;
 			"ImageURL VARCHAR(255) NOT NULL,"	// Cns_MAX_BYTES_WWW
 		   "UNIQUE INDEX(PstCod),"
 		   "INDEX(ThrCod),"
+		   "INDEX(ThrCod,UsrCod),"
 		   "INDEX(UsrCod),"
 		   "INDEX(CreatTime),"
 		   "INDEX(ModifTime))");
@@ -1219,8 +1250,9 @@ mysql> DESCRIBE forum_thread;
 | Location    | int(11)    | NO   | MUL | -1      |                |
 | FirstPstCod | int(11)    | NO   | UNI | NULL    |                |
 | LastPstCod  | int(11)    | NO   | UNI | NULL    |                |
+| NumPsts     | int(11)    | NO   |     | 0       |                |
 +-------------+------------+------+-----+---------+----------------+
-5 rows in set (0.00 sec)
+6 rows in set (0.00 sec)
 */
    DB_CreateTable ("CREATE TABLE IF NOT EXISTS forum_thread ("
 			"ThrCod INT NOT NULL AUTO_INCREMENT,"
@@ -1228,9 +1260,11 @@ mysql> DESCRIBE forum_thread;
 			"Location INT NOT NULL DEFAULT -1,"
 			"FirstPstCod INT NOT NULL,"
 			"LastPstCod INT NOT NULL,"
+			"NumPsts INT NOT NULL DEFAULT 0,"
 		   "UNIQUE INDEX(ThrCod),"
 		   "INDEX(ForumType),"
 		   "INDEX(Location),"
+		   "INDEX(ForumType,Location),"
 		   "UNIQUE INDEX(FirstPstCod),"
 		   "UNIQUE INDEX(LastPstCod))");
 
@@ -1417,7 +1451,41 @@ mysql> DESCRIBE institutions;
 			"WWW VARCHAR(255) NOT NULL,"					// Cns_MAX_BYTES_WWW
 		   "UNIQUE INDEX(InsCod),"
 		   "INDEX(CtyCod),"
-		   "INDEX(Status))");
+		   "INDEX(Status),"
+		   "FULLTEXT(FullName)) ENGINE = MYISAM;");
+
+   /***** Table jobs *****/
+/*
+mysql> DESCRIBE jobs;
++-------------+------------+------+-----+---------+----------------+
+| Field       | Type       | Null | Key | Default | Extra          |
++-------------+------------+------+-----+---------+----------------+
+| JobCod      | int(11)    | NO   | PRI | NULL    | auto_increment |
+| UsrCod      | int(11)    | NO   | MUL | NULL    |                |
+| ActCod      | int(11)    | NO   |     | NULL    |                |
+| Params      | text       | NO   |     | NULL    |                |
+| Status      | tinyint(4) | NO   | MUL | 0       |                |
+| Progress    | tinyint(4) | NO   |     | 0       |                |
+| RequestTime | datetime   | NO   | MUL | NULL    |                |
+| StartTime   | datetime   | NO   |     | NULL    |                |
+| EndTime     | datetime   | NO   |     | NULL    |                |
++-------------+------------+------+-----+---------+----------------+
+9 rows in set (0,00 sec)
+*/
+   DB_CreateTable ("CREATE TABLE IF NOT EXISTS jobs ("
+			"JobCod INT NOT NULL AUTO_INCREMENT,"
+			"UsrCod INT NOT NULL,"
+			"ActCod INT NOT NULL,"
+			"Params TEXT NOT NULL,"
+			"Status TINYINT NOT NULL DEFAULT 0,"
+			"Progress TINYINT NOT NULL DEFAULT 0,"
+			"RequestTime DATETIME NOT NULL,"
+			"StartTime DATETIME NOT NULL,"
+			"EndTime DATETIME NOT NULL,"
+		   "UNIQUE INDEX(JobCod),"
+		   "INDEX(UsrCod,ActCod),"
+		   "INDEX(Status),"
+		   "INDEX(RequestTime))");
 
    /***** Table links *****/
 /*
@@ -1510,7 +1578,7 @@ mysql> DESCRIBE log_full;
 			"TimeToGenerate INT NOT NULL,"
 			"TimeToSend INT NOT NULL,"
 			"IP CHAR(15) NOT NULL,"	// Cns_MAX_CHARS_IP
-		   "UNIQUE INDEX(LogCod),"
+		   "UNIQUE INDEX(LogCod,ClickTime),"	// ClickTime is needed for partitioning
 		   "INDEX(ActCod),"
 		   "INDEX(CtyCod),"
 		   "INDEX(InsCod),"
@@ -1518,7 +1586,9 @@ mysql> DESCRIBE log_full;
 		   "INDEX(DegCod),"
 		   "INDEX(CrsCod),"
 		   "INDEX(UsrCod),"
-		   "INDEX(ClickTime,Role))");
+		   "INDEX(ClickTime,Role))"
+		   " PARTITION BY RANGE (TO_DAYS(ClickTime))"	// Partitions are added in Sta_RotateLogTables
+		   " (PARTITION pmax VALUES LESS THAN MAXVALUE)");
 
    /***** Table log_recent *****/
 /*
@@ -1557,6 +1627,80 @@ mysql> DESCRIBE log_recent;
 			"TimeToGenerate INT NOT NULL,"
 			"TimeToSend INT NOT NULL,"
 			"IP CHAR(15) NOT NULL,"	// Cns_MAX_CHARS_IP
+		   "UNIQUE INDEX(LogCod,ClickTime),"	// ClickTime is needed for partitioning
+		   "INDEX(ActCod),"
+		   "INDEX(CtyCod),"
+		   "INDEX(InsCod),"
+		   "INDEX(CtrCod),"
+		   "INDEX(DegCod),"
+		   "INDEX(CrsCod),"
+		   "INDEX(UsrCod),"
+		   "INDEX(ClickTime,Role))"
+		   " PARTITION BY RANGE (TO_DAYS(ClickTime))"	// Partitions are added in Sta_RotateLogTables
+		   " (PARTITION pmax VALUES LESS THAN MAXVALUE)");
+
+   /***** Table log_refresh *****/
+/*
+mysql> DESCRIBE log_refresh;
++----------------+------------+------+-----+---------+-------+
+| Field          | Type       | Null | Key | Default | Extra |
++----------------+------------+------+-----+---------+-------+
+| ActCod         | int(11)    | NO   | PRI | NULL    |       |
+| ClickDay       | date       | NO   | PRI | NULL    |       |
+| NumRefreshes   | int(11)    | NO   |     | 0       |       |
+| TimeToGenerate | bigint(20) | NO   |     | 0       |       |
+| TimeToSend     | bigint(20) | NO   |     | 0       |       |
++----------------+------------+------+-----+---------+-------+
+5 rows in set (0.00 sec)
+*/
+   DB_CreateTable ("CREATE TABLE IF NOT EXISTS log_refresh ("
+			"ActCod INT NOT NULL,"
+			"ClickDay DATE NOT NULL,"
+			"NumRefreshes INT NOT NULL DEFAULT 0,"
+			"TimeToGenerate BIGINT NOT NULL DEFAULT 0,"
+			"TimeToSend BIGINT NOT NULL DEFAULT 0,"
+		   "UNIQUE INDEX(ActCod,ClickDay))");
+
+   /***** Table log_sample *****/
+/*
+mysql> DESCRIBE log_sample;
++----------------+------------+------+-----+---------+-------+
+| Field          | Type       | Null | Key | Default | Extra |
++----------------+------------+------+-----+---------+-------+
+| LogCod         | int(11)    | NO   | PRI | NULL    |       |
+| ActCod         | int(11)    | NO   | MUL | -1      |       |
+| CtyCod         | int(11)    | NO   | MUL | -1      |       |
+| InsCod         | int(11)    | NO   | MUL | -1      |       |
+| CtrCod         | int(11)    | NO   | MUL | -1      |       |
+| DegCod         | int(11)    | NO   | MUL | -1      |       |
+| CrsCod         | int(11)    | NO   | MUL | -1      |       |
+| UsrCod         | int(11)    | NO   | MUL | -1      |       |
+| Role           | tinyint(4) | NO   |     | NULL    |       |
+| ClickTime      | datetime   | NO   | MUL | NULL    |       |
+| TimeToGenerate | int(11)    | NO   |     | NULL    |       |
+| TimeToSend     | int(11)    | NO   |     | NULL    |       |
+| PageBytes      | int(11)    | NO   |     | 0       |       |
+| SentBytes      | int(11)    | NO   |     | 0       |       |
+| IP             | char(15)   | NO   |     | NULL    |       |
++----------------+------------+------+-----+---------+-------+
+15 rows in set (0.00 sec)
+*/
+   DB_CreateTable ("CREATE TABLE IF NOT EXISTS log_sample ("
+			"LogCod INT NOT NULL,"
+			"ActCod INT NOT NULL DEFAULT -1,"
+			"CtyCod INT NOT NULL DEFAULT -1,"
+			"InsCod INT NOT NULL DEFAULT -1,"
+			"CtrCod INT NOT NULL DEFAULT -1,"
+			"DegCod INT NOT NULL DEFAULT -1,"
+			"CrsCod INT NOT NULL DEFAULT -1,"
+			"UsrCod INT NOT NULL DEFAULT -1,"
+			"Role TINYINT NOT NULL,"
+			"ClickTime DATETIME NOT NULL,"
+			"TimeToGenerate INT NOT NULL,"
+			"TimeToSend INT NOT NULL,"
+			"PageBytes INT NOT NULL DEFAULT 0,"
+			"SentBytes INT NOT NULL DEFAULT 0,"
+			"IP CHAR(15) NOT NULL,"	// Cns_MAX_CHARS_IP
 		   "UNIQUE INDEX(LogCod),"
 		   "INDEX(ActCod),"
 		   "INDEX(CtyCod),"
@@ -1604,6 +1748,24 @@ mysql> DESCRIBE log_ws;
 		   "INDEX(PlgCod),"
 		   "INDEX(FunCod))");
 
+   /***** Table logos *****/
+/*
+mysql> DESCRIBE logos;
++------------+-------------------------+------+-----+---------+-------+
+| Field      | Type                    | Null | Key | Default | Extra |
++------------+-------------------------+------+-----+---------+-------+
+| Scope      | enum('Ins','Ctr','Deg') | NO   | PRI | NULL    |       |
+| Cod        | int(11)                 | NO   | PRI | NULL    |       |
+| LogoExists | enum('N','Y')           | NO   |     | N       |       |
++------------+-------------------------+------+-----+---------+-------+
+3 rows in set (0.00 sec)
+*/
+   DB_CreateTable ("CREATE TABLE IF NOT EXISTS logos ("
+			"Scope ENUM('Ins','Ctr','Deg') NOT NULL,"
+			"Cod INT NOT NULL,"
+			"LogoExists ENUM('N','Y') NOT NULL DEFAULT 'N',"
+		   "UNIQUE INDEX(Scope,Cod))");
+
    /***** Table mail_domains *****/
 /*
 mysql> DESCRIBE mail_domains;
@@ -1641,6 +1803,29 @@ mysql> DESCRIBE marks_properties;
 			"Footer INT NOT NULL,"
 		   "UNIQUE INDEX(FilCod))");
 
+   /***** Table marks_rows *****/
+/*
+mysql> DESCRIBE marks_rows;
++----------+----------+------+-----+---------+-------+
+| Field    | Type     | Null | Key | Default | Extra |
++----------+----------+------+-----+---------+-------+
+| FilCod   | int(11)  | NO   | PRI | NULL    |       |
+| NumRow   | int(11)  | NO   | PRI | NULL    |       |
+| UsrID    | char(16) | NO   | PRI | NULL    |       |
+| StartPos | int(11)  | NO   |     | NULL    |       |
+| EndPos   | int(11)  | NO   |     | NULL    |       |
++----------+----------+------+-----+---------+-------+
+5 rows in set (0.00 sec)
+*/
+   DB_CreateTable ("CREATE TABLE IF NOT EXISTS marks_rows ("
+			"FilCod INT NOT NULL,"
+			"NumRow INT NOT NULL,"
+			"UsrID CHAR(16) NOT NULL,"	// ID_MAX_BYTES_USR_ID
+			"StartPos INT NOT NULL,"
+			"EndPos INT NOT NULL,"
+		   "UNIQUE INDEX(FilCod,NumRow,UsrID),"
+		   "INDEX(FilCod,UsrID))");
+
    /***** Table msg_banned *****/
 /*
 mysql> DESCRIBE msg_banned;
@@ -1730,6 +1915,7 @@ mysql> DESCRIBE msg_rcv;
 			"Replied ENUM('N','Y') NOT NULL DEFAULT 'N',"
 			"Expanded ENUM('N','Y') NOT NULL DEFAULT 'N',"
 		   "UNIQUE INDEX (UsrCod,MsgCod),"
+		   "INDEX(UsrCod,Open,MsgCod),"
 		   "INDEX(MsgCod),"
 		   "INDEX(Notified))");
 
@@ -1896,6 +2082,7 @@ mysql> DESCRIBE notif;
 		   "UNIQUE INDEX(NtfCod),"
 		   "INDEX(NotifyEvent),"
 		   "INDEX(ToUsrCod),"
+		   "INDEX(ToUsrCod,Status,TimeNotif),"
 		   "INDEX(CrsCod),"
 		   "INDEX(TimeNotif))");
 
@@ -2071,8 +2258,9 @@ mysql> DESCRIBE sessions;
 | WhatToSearch   | tinyint(4)    | NO   |     | 0       |       |
 | SearchStr      | varchar(2047) | NO   |     |         |       |
 | SideCols       | tinyint(4)    | NO   |     | 3       |       |
+| MFUClicks      | varchar(255)  | NO   |     |         |       |
 +----------------+---------------+------+-----+---------+-------+
-18 rows in set (0,00 sec)
+19 rows in set (0,00 sec)
 */
    DB_CreateTable ("CREATE TABLE IF NOT EXISTS sessions ("
 			"SessionId CHAR(43) NOT NULL,"				// Ses_BYTES_SESSION_ID
@@ -2093,6 +2281,7 @@ mysql> DESCRIBE sessions;
 			"WhatToSearch TINYINT NOT NULL DEFAULT 0,"
 			"SearchStr VARCHAR(2047) NOT NULL DEFAULT '',"		// Sch_MAX_BYTES_STRING_TO_FIND
 			"SideCols TINYINT NOT NULL DEFAULT 3,"
+			"MFUClicks VARCHAR(255) NOT NULL DEFAULT '',"		// Ses_MAX_BYTES_MFU_CLICKS
 		   "UNIQUE INDEX(SessionId),"
 		   "INDEX(UsrCod))");
 
@@ -2699,7 +2888,7 @@ mysql> DESCRIBE usr_data;
 | Password          | char(86)                                         | NO   |     |         |                |
 | Surname1          | varchar(511)                                     | NO   |     |         |                |
 | Surname2          | varchar(511)                                     | NO   |     |         |                |
-| FirstName         | varchar(511)                                     | NO   |     |         |                |
+| FirstName         | varchar(511)                                     | NO   | MUL |         |                |
 | Sex               | enum('unknown','female','male')                  | NO   |     | unknown |                |
 | Theme             | char(16)                                         | NO   | MUL |         |                |
 | IconSet           | char(16)                                         | NO   | MUL |         |                |
@@ -2779,7 +2968,8 @@ mysql> DESCRIBE usr_data;
 		   "INDEX(DptCod),"
 		   "INDEX(CtrCod),"
 		   "INDEX(Menu),"
-		   "INDEX(SideCols))");
+		   "INDEX(SideCols),"
+		   "FULLTEXT(FirstName,Surname1,Surname2)) ENGINE = MYISAM;");
 
    /***** Table usr_duplicated *****/
 /*
@@ -3165,6 +3355,20 @@ void DB_QueryDELETE (const char *Query,const char *MsgError)
       DB_ExitOnMySQLError (MsgError);
   }
 
+/*****************************************************************************/
+/**** Make a DELETE query from database and return number of rows deleted ****/
+/*****************************************************************************/
+
+unsigned long DB_QueryDELETEandReturnNumRows (const char *Query,const char *MsgError)
+  {
+   /***** Query database *****/
+   if (mysql_query (&Gbl.mysql,Query))
+      DB_ExitOnMySQLError (MsgError);
+
+   /***** Return number of rows deleted *****/
+   return (unsigned long) mysql_affected_rows (&Gbl.mysql);
+  }
+
 /*****************************************************************************/
 /**************** Make other kind of query from database *********************/
 /*****************************************************************************/
@@ -43,6 +43,7 @@ long DB_QueryINSERTandReturnCode (const char *Query,const char *MsgError);
 void DB_QueryREPLACE (const char *Query,const char *MsgError);
 void DB_QueryUPDATE (const char *Query,const char *MsgError);
 void DB_QueryDELETE (const char *Query,const char *MsgError);
+unsigned long DB_QueryDELETEandReturnNumRows (const char *Query,const char *MsgError);
 void DB_Query (const char *Query,const char *MsgError);
 void DB_FreeMySQLResult (MYSQL_RES **mysql_res);
 void DB_ExitOnMySQLError (const char *Message);
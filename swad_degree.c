@@ -45,6 +45,7 @@
 #include "swad_hierarchy.h"
 #include "swad_indicator.h"
 #include "swad_info.h"
+#include "swad_layout.h"
 #include "swad_logo.h"
 #include "swad_notification.h"
 #include "swad_parameter.h"
@@ -109,7 +110,6 @@ static void Deg_PutIconToViewDegrees (void);
 static void Deg_RecFormRequestOrCreateDeg (unsigned Status);
 static void Deg_PutParamOtherDegCod (long DegCod);
 
-static void Deg_GetDataOfDegreeFromRow (struct Degree *Deg,MYSQL_ROW row);
 
 static void Deg_RenameDegree (struct Degree *Deg,Cns_ShrtOrFullName_t ShrtOrFullName);
 static bool Deg_CheckIfDegNameExistsInCtr (const char *FieldName,const char *Name,long DegCod,long CtrCod);
@@ -277,6 +277,26 @@ void Deg_PrintConfiguration (void)
    Deg_Configuration (true);
   }
 
+/*****************************************************************************/
+/*********** Build validators of the information of current degree ***********/
+/*****************************************************************************/
+// Data shown have not time of last modification,
+// so they are added to the validator of the page
+
+bool Deg_GetValidatorOfConfiguration (void)
+  {
+   if (Gbl.CurrentDeg.Deg.DegCod <= 0)
+      return false;
+
+   Lay_AddStrToPageValidator (Gbl.CurrentDeg.Deg.WWW);
+   Lay_AddNumToPageValidator ((unsigned long) Log_CheckIfLogoExists (Sco_SCOPE_DEG,Gbl.CurrentDeg.Deg.DegCod));
+   Lay_AddNumToPageValidator ((unsigned long) Log_CheckIfLogoExists (Sco_SCOPE_CTR,Gbl.CurrentCtr.Ctr.CtrCod));
+   Lay_AddNumToPageValidator ((unsigned long) Log_CheckIfLogoExists (Sco_SCOPE_INS,Gbl.CurrentIns.Ins.InsCod));
+   Lay_AddNumToPageValidator ((unsigned long) Crs_GetNumCrssInDeg (Gbl.CurrentDeg.Deg.DegCod));
+
+   return true;
+  }
+
 /*****************************************************************************/
 /******************* Information of the current degree ***********************/
 /*****************************************************************************/
@@ -1707,7 +1727,7 @@ bool Deg_GetDataOfDegreeByCod (struct Degree *Deg)
 /********** Get data of a degree from a row resulting of a query *************/
 /*****************************************************************************/
 
-static void Deg_GetDataOfDegreeFromRow (struct Degree *Deg,MYSQL_ROW row)
+void Deg_GetDataOfDegreeFromRow (struct Degree *Deg,MYSQL_ROW row)
   {
    /***** Get degree code (row[0]) *****/
    if ((Deg->DegCod = Str_ConvertStrCodToLongCod (row[0])) < 0)
@@ -1885,6 +1905,9 @@ void Deg_RemoveDegreeCompletely (long DegCod)
 	    (unsigned) DegCod);
    Fil_RemoveTree (PathDeg);
 
+   /***** Remove logo from manifest *****/
+   Log_RemoveLogoFromManifest (Sco_SCOPE_DEG,DegCod);
+
    /***** Remove administrators of this degree *****/
    sprintf (Query,"DELETE FROM admin WHERE Scope='%s' AND Cod=%ld",
             Sco_ScopeDB[Sco_SCOPE_DEG],DegCod);
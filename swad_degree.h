@@ -27,6 +27,8 @@
 /********************************* Headers ***********************************/
 /*****************************************************************************/
 
+#include <mysql/mysql.h>	// To access MySQL databases
+
 #include "swad_action.h"
 #include "swad_constant.h"
 #include "swad_hierarchy.h"
@@ -94,6 +96,7 @@ void Deg_DrawDegreeLogoAndNameWithLink (struct Degree *Deg,Act_Action_t Action,
 
 void Deg_ShowConfiguration (void);
 void Deg_PrintConfiguration (void);
+bool Deg_GetValidatorOfConfiguration (void);
 
 void Deg_WriteSelectorOfDegree (void);
 
@@ -115,6 +118,7 @@ void Deg_PutParamDegCod (long DegCod);
 long Deg_GetAndCheckParamOtherDegCod (long MinCodAllowed);
 
 bool Deg_GetDataOfDegreeByCod (struct Degree *Deg);
+void Deg_GetDataOfDegreeFromRow (struct Degree *Deg,MYSQL_ROW row);
 void Deg_GetShortNameOfDegreeByCod (struct Degree *Deg);
 long Deg_GetCtrCodOfDegreeByCod (long DegCod);
 long Deg_GetInsCodOfDegreeByCod (long DegCod);
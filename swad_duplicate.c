@@ -172,6 +172,9 @@ void Dup_ListDuplicateUsrs (void)
            NumUsr < NumUsrs;
            NumUsr++)
         {
+         /* Update progress when listing in background */
+         Job_UpdateProgress (NumUsr,NumUsrs);
+
          row = mysql_fetch_row (mysql_res);
 
          /* Get user code (row[0]) */
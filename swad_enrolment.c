@@ -50,6 +50,8 @@
 /***************************** Private constants *****************************/
 /*****************************************************************************/
 
+#define Enr_MAX_BYTES_USR_COD_IN_LIST (1 + 10)	// Comma + user's code
+
 static const bool Enr_ICanAdminOtherUsrs[Rol_NUM_ROLES] =
   {
    /* Users who can not admin */
@@ -118,14 +120,18 @@ static void Enr_PutActionsRegRemSeveralUsrs (void);
 
 static void Enr_ReceiveFormUsrsCrs (Rol_Role_t Role);
 
-static void Enr_RegisterUsr (struct UsrData *UsrDat,Rol_Role_t RegRemRole,
-                             struct ListCodGrps *LstGrps,unsigned *NumUsrsRegistered);
+static unsigned Enr_RegisterUsrsInCrsFromList (const char *ListUsrsIDs,Rol_Role_t Role,
+                                               struct ListCodGrps *LstGrps);
+static void Enr_AddQuotedStrToList (char *List,const char *Str,size_t MaxLength);
+static void Enr_AddSubQueryToGetUsrCods (char *Query,const char *SubQueryFormat,
+                                         const char *List);
 
 static void Enr_PutLinkToRemAllStdsThisCrs (void);
 
 static void Enr_ShowEnrolmentRequestsGivenRoles (unsigned RolesSelected);
 
 static void Enr_RemoveEnrolmentRequest (long CrsCod,long UsrCod);
+static void Enr_RemoveEnrolmentRequestsOfSeveralUsrs (long CrsCod,const char *UsrCodsList);
 static void Enr_RemoveExpiredEnrolmentRequests (void);
 
 static void Enr_ReqRegRemUsr (Rol_Role_t Role);
@@ -847,12 +853,8 @@ void Enr_RemoveOldUsrs (void)
    unsigned MonthsWithoutAccess;
    time_t SecondsWithoutAccess;
    char Query[1024];
-   MYSQL_RES *mysql_res;
-   MYSQL_ROW row;
-   unsigned long NumUsr;
    unsigned long NumUsrs;
    unsigned NumUsrsEliminated = 0;
-   struct UsrData UsrDat;
 
    /***** Get parameter with number of months without access *****/
    MonthsWithoutAccess = (unsigned)
@@ -864,18 +866,32 @@ void Enr_RemoveOldUsrs (void)
       Lay_ShowErrorAndExit ("Wrong number of months.");
    SecondsWithoutAccess = (time_t) MonthsWithoutAccess * Dat_SECONDS_IN_ONE_MONTH;
 
-   /***** Get old users from database *****/
-   sprintf (Query,"SELECT UsrCod FROM"
+   /***** Store old users in a temporary table *****/
+   /* The table is temporary (private to this connection),
+      so concurrent purges, for example in background jobs,
+      do not overwrite each other's list of users */
+   DB_Query ("DROP TEMPORARY TABLE IF EXISTS usr_old_tmp",
+             "can not remove temporary table");
+   sprintf (Query,"CREATE TEMPORARY TABLE usr_old_tmp"
+	          " (UsrCod INT NOT NULL,UNIQUE INDEX(UsrCod))"
+	          " ENGINE=MEMORY"
+	          " SELECT candidate_usrs.UsrCod FROM"
                   "("
                   "SELECT UsrCod FROM usr_last WHERE"
                   " LastTime<FROM_UNIXTIME(UNIX_TIMESTAMP()-'%lu')"
                   " UNION "
                   "SELECT UsrCod FROM usr_data WHERE"
                   " UsrCod NOT IN (SELECT UsrCod FROM usr_last)"
-                  ") AS candidate_usrs"
-                  " WHERE UsrCod NOT IN (SELECT DISTINCT UsrCod FROM crs_usr)",
+                  ") AS candidate_usrs,usr_data"
+                  " WHERE candidate_usrs.UsrCod=usr_data.UsrCod"
+                  " AND candidate_usrs.UsrCod NOT IN"
+                  " (SELECT DISTINCT UsrCod FROM crs_usr)",
             (unsigned long) SecondsWithoutAccess);
-   if ((NumUsrs = DB_QuerySELECT (Query,&mysql_res,"can not get old users")))
+   DB_Query (Query,"can not create temporary table");
+
+   /***** Eliminate old users *****/
+   if ((NumUsrs = DB_QueryCOUNT ("SELECT COUNT(*) FROM usr_old_tmp",
+                                 "can not get number of old users")))
      {
       sprintf (Gbl.Alert.Txt,Txt_Eliminating_X_users_who_were_not_enroled_in_any_course_and_with_more_than_Y_months_without_access_to_Z,
                NumUsrs,
@@ -883,33 +899,17 @@ void Enr_RemoveOldUsrs (void)
                Cfg_PLATFORM_SHORT_NAME);
       Ale_ShowAlert (Ale_INFO,Gbl.Alert.Txt);
 
-      /***** Initialize structure with user's data *****/
-      Usr_UsrDataConstructor (&UsrDat);
-
       /***** Remove users *****/
-      for (NumUsr = 0;
-           NumUsr < NumUsrs;
-           NumUsr++)
-        {
-         row = mysql_fetch_row (mysql_res);
-         UsrDat.UsrCod = Str_ConvertStrCodToLongCod (row[0]);
-         if (Usr_ChkUsrCodAndGetAllUsrDataFromUsrCod (&UsrDat))        // If user's data exist...
-           {
-            Acc_CompletelyEliminateAccount (&UsrDat,Cns_QUIET);
-            NumUsrsEliminated++;
-           }
-        }
-
-      /***** Free memory used for user's data *****/
-      Usr_UsrDataDestructor (&UsrDat);
-
-      /***** Free structure that stores the query result *****/
-      DB_FreeMySQLResult (&mysql_res);
+      NumUsrsEliminated = Acc_CompletelyEliminateOldAccounts ();
 
       /***** Move unused contents of messages to table of deleted contents of messages *****/
       Msg_MoveUnusedMsgsContentToDeleted ();
      }
 
+   /***** Remove temporary table *****/
+   DB_Query ("DROP TEMPORARY TABLE IF EXISTS usr_old_tmp",
+             "can not remove temporary table");
+
    /***** Write end message *****/
    sprintf (Gbl.Alert.Txt,Txt_X_users_have_been_eliminated,
             NumUsrsEliminated);
@@ -1398,7 +1398,6 @@ static void Enr_ReceiveFormUsrsCrs (Rol_Role_t Role)
    unsigned NumUsrsEliminated = 0;
    struct ListCodGrps LstGrps;
    struct UsrData UsrDat;
-   bool ItLooksLikeAUsrID;
    Enr_RegRemUsrsAction_t RegRemUsrsAction;
 
    /***** Check the role of users to register / remove *****/
@@ -1648,76 +1647,8 @@ static void Enr_ReceiveFormUsrsCrs (Rol_Role_t Role)
      }
 
    /***** Register users *****/
-   if (WhatToDo.RegisterUsrs)	// TODO: !!!!! NO CAMBIAR EL ROL DE LOS USUARIOS QUE YA ESTN EN LA ASIGNATURA SI HAY MS DE UN USUARIO ENCONTRADO PARA EL MISMO DNI !!!!!!
-     {
-      /***** Get users from a list of users' IDs ******/
-      Ptr = ListUsrsIDs;
-      while (*Ptr)
-	{
-	 /* Reset user */
-	 UsrDat.UsrCod = -1L;
-	 ItLooksLikeAUsrID = false;
-
-	 /* Find next string in text */
-	 Str_GetNextStringUntilSeparator (&Ptr,UsrDat.UsrIDNickOrEmail,
-	                                  Cns_MAX_BYTES_EMAIL_ADDRESS);
-
-	 /* Reset default list of users' codes */
-	 ListUsrCods.NumUsrs = 0;
-	 ListUsrCods.Lst = NULL;
-
-	 /* Check if the string is a user's ID, a user's nickname or a user's email address */
-	 if (Nck_CheckIfNickWithArrobaIsValid (UsrDat.UsrIDNickOrEmail))	// 1: It's a nickname
-	   {
-	    if ((UsrDat.UsrCod = Nck_GetUsrCodFromNickname (UsrDat.UsrIDNickOrEmail)) > 0)
-	      {
-	       ListUsrCods.NumUsrs = 1;
-	       Usr_AllocateListUsrCods (&ListUsrCods);
-	       ListUsrCods.Lst[0] = UsrDat.UsrCod;
-	      }
-	   }
-	 else if (Mai_CheckIfEmailIsValid (UsrDat.UsrIDNickOrEmail))		// 2: It's an email
-	   {
-	    if ((UsrDat.UsrCod = Mai_GetUsrCodFromEmail (UsrDat.UsrIDNickOrEmail)) > 0)
-	      {
-	       ListUsrCods.NumUsrs = 1;
-	       Usr_AllocateListUsrCods (&ListUsrCods);
-	       ListUsrCods.Lst[0] = UsrDat.UsrCod;
-	      }
-	   }
-	 else								// 3: It looks like a user's ID
-	   {
-	    // Users' IDs are always stored internally in capitals and without leading zeros
-	    Str_RemoveLeadingZeros (UsrDat.UsrIDNickOrEmail);
-	    if (ID_CheckIfUsrIDSeemsAValidID (UsrDat.UsrIDNickOrEmail))
-	      {
-	       ItLooksLikeAUsrID = true;
-
-	       /* Find users for this user's ID */
-	       ID_ReallocateListIDs (&UsrDat,1);	// Only one user's ID
-	       Str_Copy (UsrDat.IDs.List[0].ID,UsrDat.UsrIDNickOrEmail,
-			 ID_MAX_BYTES_USR_ID);
-	       Str_ConvertToUpperText (UsrDat.IDs.List[0].ID);
-	       ID_GetListUsrCodsFromUsrID (&UsrDat,NULL,&ListUsrCods,false);
-	      }
-	   }
-
-	 /* Register user(s) */
-	 if (ListUsrCods.NumUsrs)	// User(s) found
-	    for (NumUsrFound = 0;
-		 NumUsrFound < ListUsrCods.NumUsrs;
-		 NumUsrFound++)
-	      {
-	       UsrDat.UsrCod = ListUsrCods.Lst[NumUsrFound];
-	       Enr_RegisterUsr (&UsrDat,Role,&LstGrps,&NumUsrsRegistered);
-	      }
-	 else if (ItLooksLikeAUsrID)	// User not found. He/she is a new user. Register him/her using ID
-	    Enr_RegisterUsr (&UsrDat,Role,&LstGrps,&NumUsrsRegistered);
-
-	 /* Free memory used for list of users' codes found for this ID */
-	 Usr_FreeListUsrCods (&ListUsrCods);
-	}
-     }
+   if (WhatToDo.RegisterUsrs)
+      NumUsrsRegistered = Enr_RegisterUsrsInCrsFromList (ListUsrsIDs,Role,&LstGrps);
 
    /***** Free memory used for user's data *****/
    Usr_UsrDataDestructor (&UsrDat);
@@ -1787,52 +1718,322 @@ static void Enr_ReceiveFormUsrsCrs (Rol_Role_t Role)
   }
 
 /*****************************************************************************/
-/********************** Register a user using his/her ID *********************/
+/********* Register in current course the users specified in a list **********/
 /*****************************************************************************/
-// If user does not exists, UsrDat->IDs must hold the user's ID
+// ListUsrsIDs holds users' IDs, @nicknames or emails,
+// separated by spaces, commas or semicolons,
+// so a column copied from a CSV file can be pasted directly.
+// All the users are got and registered with a few queries,
+// instead of several queries for each user.
+// Users not found by ID are created using their IDs.
+// Returns the number of users registered
 
-static void Enr_RegisterUsr (struct UsrData *UsrDat,Rol_Role_t RegRemRole,
-                             struct ListCodGrps *LstGrps,unsigned *NumUsrsRegistered)
+static unsigned Enr_RegisterUsrsInCrsFromList (const char *ListUsrsIDs,Rol_Role_t Role,
+                                               struct ListCodGrps *LstGrps)
   {
-   /***** Check if I can register this user *****/
+   extern const char *Usr_StringsUsrListTypeInDB[Usr_NUM_USR_LIST_TYPES];
+   size_t MaxLength;
+   char *NicksList;
+   char *EmailsList;
+   char *IDsList;
+   char *FoundIDsList;
+   char *Query;
+   char *UsrCodsList;
+   char *ChangedUsrCodsList;
+   char *PtrAll;
+   char *PtrChanged;
+   const char *Ptr;
+   char UsrIDNickOrEmail[Cns_MAX_BYTES_EMAIL_ADDRESS + 1];
+   char QuotedUsrID[1 + ID_MAX_BYTES_USR_ID + 1 + 1];
+   MYSQL_RES *mysql_res = NULL;
+   MYSQL_ROW row;
+   unsigned long NumRow;
+   unsigned long NumRows;
+   unsigned NumUsrsChanged = 0;
+   struct UsrData UsrDat;
+   Ntf_NotifyEvent_t NotifyEvent;
+
+   /***** Check if I can register these users *****/
+   switch (Role)
+     {
+      case Rol_STD:
+	 NotifyEvent = Ntf_EVENT_ENROLMENT_STD;
+	 break;
+      case Rol_NET:
+	 NotifyEvent = Ntf_EVENT_ENROLMENT_NET;
+	 break;
+      case Rol_TCH:
+	 NotifyEvent = Ntf_EVENT_ENROLMENT_TCH;
+	 break;
+      default:
+	 NotifyEvent = Ntf_EVENT_UNKNOWN;
+         Lay_ShowErrorAndExit ("Wrong role.");
+     }
    if (Gbl.Usrs.Me.Role.Logged == Rol_TCH &&
-       RegRemRole != Rol_STD)
+       Role != Rol_STD)
       Lay_ShowErrorAndExit ("A teacher only can register several users as students.");
 
-   /***** Check if the record of the user exists and get the type of user *****/
-   if (UsrDat->UsrCod > 0)	// User exists in database
-      Usr_GetAllUsrDataFromUsrCod (UsrDat);	// Get user's data
-   else				// User does not exist in database, create it using his/her ID!
+   /***** Allocate memory for the lists of nicknames, emails and IDs *****/
+   // Each string in list is written between quotes and followed by a comma
+   MaxLength = (strlen (ListUsrsIDs) + 1) * 3;
+   if ((NicksList = (char *) malloc (MaxLength + 1)) == NULL)
+      Lay_ShowErrorAndExit ("Not enough memory to store list of users.");
+   if ((EmailsList = (char *) malloc (MaxLength + 1)) == NULL)
+      Lay_ShowErrorAndExit ("Not enough memory to store list of users.");
+   if ((IDsList = (char *) malloc (MaxLength + 1)) == NULL)
+      Lay_ShowErrorAndExit ("Not enough memory to store list of users.");
+   if ((FoundIDsList = (char *) malloc (MaxLength + 1)) == NULL)
+      Lay_ShowErrorAndExit ("Not enough memory to store list of users.");
+   if ((Query = (char *) malloc (1024 + MaxLength * 3)) == NULL)
+      Lay_ShowErrorAndExit ("Not enough memory to store database query.");
+   NicksList[0]    = '\0';
+   EmailsList[0]   = '\0';
+   IDsList[0]      = '\0';
+   FoundIDsList[0] = '\0';
+
+   /***** Split the list into nicknames, emails and IDs *****/
+   Ptr = ListUsrsIDs;
+   while (*Ptr)
      {
-      // Reset user's data
-      Usr_ResetUsrDataExceptUsrCodAndIDs (UsrDat);	// It's necessary, because the same struct UsrDat was used for former user
+      /* Find next string in text */
+      Str_GetNextStringUntilSeparator (&Ptr,UsrIDNickOrEmail,
+				       Cns_MAX_BYTES_EMAIL_ADDRESS);
 
-      // User does not exist in database; list of IDs is initialized
-      UsrDat->IDs.List[0].Confirmed = true;	// If he/she is a new user ==> his/her ID will be stored as confirmed in database
-      Acc_CreateNewUsr (UsrDat,
-                        false);	// I am NOT creating my own account
+      /* Check if string is a user's ID, user's nickname or user's email address */
+      if (Nck_CheckIfNickWithArrobaIsValid (UsrIDNickOrEmail))	// 1: It's a nickname
+	{
+	 Str_RemoveLeadingArrobas (UsrIDNickOrEmail);
+	 Enr_AddQuotedStrToList (NicksList,UsrIDNickOrEmail,MaxLength);
+	}
+      else if (Mai_CheckIfEmailIsValid (UsrIDNickOrEmail))	// 2: It's an email
+	 Enr_AddQuotedStrToList (EmailsList,UsrIDNickOrEmail,MaxLength);
+      else							// 3: It looks like a user's ID
+	{
+	 // Users' IDs are always stored internally in capitals and without leading zeros
+	 Str_RemoveLeadingZeros (UsrIDNickOrEmail);
+	 if (ID_CheckIfUsrIDSeemsAValidID (UsrIDNickOrEmail))
+	   {
+	    Str_ConvertToUpperText (UsrIDNickOrEmail);
+	    Enr_AddQuotedStrToList (IDsList,UsrIDNickOrEmail,MaxLength);
+	   }
+	}
      }
 
-   /***** Register user in current course in database *****/
-   if (Gbl.CurrentCrs.Crs.CrsCod > 0)	// Course selected
+   /***** Initialize structure with user's data *****/
+   Usr_UsrDataConstructor (&UsrDat);
+
+   /***** Create users not found by ID. They are new users *****/
+   if (IDsList[0])
      {
-      if (Usr_CheckIfUsrBelongsToCurrentCrs (UsrDat))
+      /* Get IDs already in database */
+      sprintf (Query,"SELECT DISTINCT UsrID FROM usr_IDs"
+		     " WHERE UsrID IN (%s)",
+	       IDsList);
+      NumRows = DB_QuerySELECT (Query,&mysql_res,"can not get users' IDs");
+      for (NumRow = 0;
+	   NumRow < NumRows;
+	   NumRow++)
 	{
-	 if (RegRemRole != UsrDat->Roles.InCurrentCrs.Role)	// The role must be updated
-	    /* Modify role */
-	    Enr_ModifyRoleInCurrentCrs (UsrDat,RegRemRole);
+	 row = mysql_fetch_row (mysql_res);
+	 Enr_AddQuotedStrToList (FoundIDsList,row[0],MaxLength);
 	}
-      else        // User does not belong to this course
-	 /* Register user */
-	 Enr_RegisterUsrInCurrentCrs (UsrDat,RegRemRole,
-	                              Enr_SET_ACCEPTED_TO_FALSE);
+      DB_FreeMySQLResult (&mysql_res);
 
-      /***** Register user in the selected groups *****/
-      if (Gbl.CurrentCrs.Grps.NumGrps)	// If there are groups in the course
-	 Grp_RegisterUsrIntoGroups (UsrDat,LstGrps);
+      /* Create a user for each ID not found */
+      Ptr = IDsList;
+      while (*Ptr)
+	{
+	 /* Get next quoted ID */
+	 Str_GetNextStringUntilSeparator (&Ptr,QuotedUsrID,
+					  1 + ID_MAX_BYTES_USR_ID + 1);
+	 if (!strstr (FoundIDsList,QuotedUsrID))	// User not found. He/she is a new user
+	   {
+	    /* Copy ID without quotes */
+	    UsrDat.UsrCod = -1L;
+	    ID_ReallocateListIDs (&UsrDat,1);	// Only one user's ID
+	    Str_Copy (UsrDat.IDs.List[0].ID,&QuotedUsrID[1],
+		      ID_MAX_BYTES_USR_ID);
+	    UsrDat.IDs.List[0].ID[strlen (UsrDat.IDs.List[0].ID) - 1] = '\0';
+
+	    /* Create user using his/her ID */
+	    Usr_ResetUsrDataExceptUsrCodAndIDs (&UsrDat);	// It's necessary, because the same struct UsrDat was used for former user
+	    UsrDat.IDs.List[0].Confirmed = true;	// If he/she is a new user ==> his/her ID will be stored as confirmed in database
+	    Acc_CreateNewUsr (&UsrDat,
+			      false);	// I am NOT creating my own account
+	   }
+	}
      }
 
-   (*NumUsrsRegistered)++;
+   /***** Free memory used for user's data *****/
+   Usr_UsrDataDestructor (&UsrDat);
+
+   /***** Get codes of all the users in list, and if they must be changed
+          (they do not belong to course or they have a different role) *****/
+   NumRows = 0;
+   if (NicksList[0] || EmailsList[0] || IDsList[0])
+     {
+      sprintf (Query,"SELECT U.UsrCod,crs_usr.UsrCod IS NULL FROM (");
+      if (NicksList[0])
+	 Enr_AddSubQueryToGetUsrCods (Query,"SELECT usr_nicknames.UsrCod"
+	                                    " FROM usr_nicknames,usr_data"
+	                                    " WHERE usr_nicknames.Nickname IN (%s)"
+	                                    " AND usr_nicknames.UsrCod=usr_data.UsrCod",
+	                              NicksList);
+      if (EmailsList[0])
+	 Enr_AddSubQueryToGetUsrCods (Query,"SELECT usr_emails.UsrCod"
+	                                    " FROM usr_emails,usr_data"
+	                                    " WHERE usr_emails.E_mail IN (%s)"
+	                                    " AND usr_emails.UsrCod=usr_data.UsrCod",
+	                              EmailsList);
+      if (IDsList[0])
+	 Enr_AddSubQueryToGetUsrCods (Query,"SELECT usr_IDs.UsrCod"
+	                                    " FROM usr_IDs,usr_data"
+	                                    " WHERE usr_IDs.UsrID IN (%s)"
+	                                    " AND usr_IDs.UsrCod=usr_data.UsrCod",
+	                              IDsList);
+      sprintf (Query + strlen (Query),") AS U"
+		                      " LEFT JOIN crs_usr"
+		                      " ON (crs_usr.CrsCod=%ld"
+		                      " AND crs_usr.UsrCod=U.UsrCod"
+		                      " AND crs_usr.Role=%u)",
+	       Gbl.CurrentCrs.Crs.CrsCod,(unsigned) Role);
+      NumRows = DB_QuerySELECT (Query,&mysql_res,"can not get users' codes");
+     }
+
+   /***** Free memory used for query and for the lists of nicknames, emails and IDs *****/
+   free ((void *) Query);
+   free ((void *) NicksList);
+   free ((void *) EmailsList);
+   free ((void *) IDsList);
+   free ((void *) FoundIDsList);
+
+   if (NumRows)
+     {
+      /***** Build lists of codes of all users and of users to be changed *****/
+      if ((UsrCodsList = (char *) malloc (NumRows * Enr_MAX_BYTES_USR_COD_IN_LIST + 1)) == NULL)
+	 Lay_ShowErrorAndExit ("Not enough memory to store list of users.");
+      if ((ChangedUsrCodsList = (char *) malloc (NumRows * Enr_MAX_BYTES_USR_COD_IN_LIST + 1)) == NULL)
+	 Lay_ShowErrorAndExit ("Not enough memory to store list of users.");
+      if ((Query = (char *) malloc (1024 + NumRows * Enr_MAX_BYTES_USR_COD_IN_LIST)) == NULL)
+	 Lay_ShowErrorAndExit ("Not enough memory to store database query.");
+      UsrCodsList[0]        = '\0';
+      ChangedUsrCodsList[0] = '\0';
+      for (NumRow = 0, PtrAll = UsrCodsList, PtrChanged = ChangedUsrCodsList;
+	   NumRow < NumRows;
+	   NumRow++)
+	{
+	 row = mysql_fetch_row (mysql_res);
+
+	 /* Get user's code (row[0]) */
+	 PtrAll += sprintf (PtrAll,NumRow ? ",%s" :
+	                                    "%s",
+	                    row[0]);
+
+	 /* Get if user must be changed (row[1]) */
+	 if (row[1][0] == '1')
+	    PtrChanged += sprintf (PtrChanged,NumUsrsChanged++ ? ",%s" :
+	                                                         "%s",
+	                           row[0]);
+	}
+
+      /***** Register users in current course in database *****/
+      if (Gbl.CurrentCrs.Crs.CrsCod > 0)	// Course selected
+	{
+	 if (NumUsrsChanged)
+	   {
+	    /* Modify role of users who belong to course */
+	    sprintf (Query,"UPDATE crs_usr SET Role=%u"
+			   " WHERE CrsCod=%ld AND UsrCod IN (%s)",
+		     (unsigned) Role,Gbl.CurrentCrs.Crs.CrsCod,ChangedUsrCodsList);
+	    DB_QueryUPDATE (Query,"can not modify users' role in course");
+
+	    /* Register users who do not belong to course */
+	    sprintf (Query,"INSERT IGNORE INTO crs_usr"
+			   " (CrsCod,UsrCod,Role,Accepted,"
+			   "LastDowGrpCod,LastComGrpCod,LastAssGrpCod,"
+			   "NumAccTst,LastAccTst,NumQstsLastTst,"
+			   "UsrListType,ColsClassPhoto,ListWithPhotos)"
+			   " SELECT %ld,UsrCod,%u,'N',"
+			   "-1,-1,-1,"
+			   "0,FROM_UNIXTIME(%ld),0,"
+			   "'%s',%u,'%c'"
+			   " FROM usr_data WHERE UsrCod IN (%s)",
+		     Gbl.CurrentCrs.Crs.CrsCod,(unsigned) Role,
+		     (long) (time_t) 0,	// The users never accessed to tests in this course
+		     Usr_StringsUsrListTypeInDB[Usr_SHOW_USRS_TYPE_DEFAULT],
+		     Usr_CLASS_PHOTO_COLS_DEF,
+		     Usr_LIST_WITH_PHOTOS_DEF ? 'Y' :
+						'N',
+		     ChangedUsrCodsList);
+	    DB_QueryINSERT (Query,"can not register users in course");
+
+	    /* Remove possible enrolment requests */
+	    Enr_RemoveEnrolmentRequestsOfSeveralUsrs (Gbl.CurrentCrs.Crs.CrsCod,
+	                                              ChangedUsrCodsList);
+
+	    /* Remove old enrolment notifications before inserting the new ones.
+	       Only one notification is created for each user changed */
+	    Ntf_MarkNotifToSeveralUsrsAsRemoved (Ntf_EVENT_ENROLMENT_STD,ChangedUsrCodsList);
+	    Ntf_MarkNotifToSeveralUsrsAsRemoved (Ntf_EVENT_ENROLMENT_NET,ChangedUsrCodsList);
+	    Ntf_MarkNotifToSeveralUsrsAsRemoved (Ntf_EVENT_ENROLMENT_TCH,ChangedUsrCodsList);
+	    Ntf_StoreNotifyEventToSeveralUsrs (NotifyEvent,ChangedUsrCodsList,-1L);
+	   }
+
+	 /* Register users in the selected groups */
+	 if (Gbl.CurrentCrs.Grps.NumGrps)	// If there are groups in the course
+	    Grp_RegisterUsrsIntoGroups (UsrCodsList,LstGrps);
+
+	 /* Flush caches */
+	 Usr_FlushCachesUsr ();
+	}
+
+      /***** Free memory used for query and lists of users' codes *****/
+      free ((void *) Query);
+      free ((void *) UsrCodsList);
+      free ((void *) ChangedUsrCodsList);
+     }
+
+   /***** Free structure that stores the query result *****/
+   DB_FreeMySQLResult (&mysql_res);
+
+   return (unsigned) NumRows;
+  }
+
+/*****************************************************************************/
+/***** Add a string between quotes to a list, if not already in the list *****/
+/*****************************************************************************/
+// Str must not contain quotes
+
+static void Enr_AddQuotedStrToList (char *List,const char *Str,size_t MaxLength)
+  {
+   char QuotedStr[1 + Cns_MAX_BYTES_EMAIL_ADDRESS + 1 + 1];
+
+   snprintf (QuotedStr,sizeof (QuotedStr),
+	     "'%s'",
+	     Str);
+   if (!strstr (List,QuotedStr))	// Not already in list
+     {
+      if (List[0])
+	 Str_Concat (List,",",
+		     MaxLength);
+      Str_Concat (List,QuotedStr,
+		  MaxLength);
+     }
+  }
+
+/*****************************************************************************/
+/******** Add to a query a subquery to get users' codes from a list **********/
+/*****************************************************************************/
+// Subqueries are joined with UNION, so repeated users' codes are removed
+
+static void Enr_AddSubQueryToGetUsrCods (char *Query,const char *SubQueryFormat,
+                                         const char *List)
+  {
+   char *Ptr = Query + strlen (Query);
+
+   if (*(Ptr - 1) != '(')	// Not the first subquery
+      Ptr += sprintf (Ptr," UNION ");
+   sprintf (Ptr,SubQueryFormat,List);
   }
 
 /*****************************************************************************/
@@ -2996,6 +3197,57 @@ static void Enr_RemoveEnrolmentRequest (long CrsCod,long UsrCod)
    DB_QueryDELETE (Query,"can not remove a request for enrolment");
   }
 
+/*****************************************************************************/
+/************ Remove requests for enrolment of several users *****************/
+/*****************************************************************************/
+// UsrCodsList is a list of users' codes separated by commas
+
+static void Enr_RemoveEnrolmentRequestsOfSeveralUsrs (long CrsCod,const char *UsrCodsList)
+  {
+   char *Query;
+   MYSQL_RES *mysql_res;
+   MYSQL_ROW row;
+   unsigned long NumRow;
+   unsigned long NumRows;
+
+   /***** Allocate space for query *****/
+   if ((Query = (char *) malloc (256 + strlen (UsrCodsList))) == NULL)
+      Lay_ShowErrorAndExit ("Not enough memory to store database query.");
+
+   /***** Mark possible notifications as removed
+          Important: do this before removing the requests *****/
+   /* Get request codes (usually none) */
+   sprintf (Query,"SELECT ReqCod FROM crs_usr_requests"
+                  " WHERE CrsCod=%ld AND UsrCod IN (%s)",
+            CrsCod,UsrCodsList);
+   NumRows = DB_QuerySELECT (Query,&mysql_res,"can not get request codes");
+   for (NumRow = 0;
+	NumRow < NumRows;
+	NumRow++)
+     {
+      /* Get request code */
+      row = mysql_fetch_row (mysql_res);
+
+      /* Mark possible notifications as removed */
+      Ntf_MarkNotifAsRemoved (Ntf_EVENT_ENROLMENT_REQUEST,
+                              Str_ConvertStrCodToLongCod (row[0]));
+     }
+   /* Free structure that stores the query result */
+   DB_FreeMySQLResult (&mysql_res);
+
+   /***** Remove enrolment requests *****/
+   if (NumRows)
+     {
+      sprintf (Query,"DELETE FROM crs_usr_requests"
+		     " WHERE CrsCod=%ld AND UsrCod IN (%s)",
+	       CrsCod,UsrCodsList);
+      DB_QueryDELETE (Query,"can not remove requests for enrolment");
+     }
+
+   /***** Free space used for query *****/
+   free ((void *) Query);
+  }
+
 /*****************************************************************************/
 /******************* Remove expired requests for enrolment ******************/
 /*****************************************************************************/
@@ -25,17 +25,23 @@
 /********************************* Headers ***********************************/
 /*****************************************************************************/
 
+#define _GNU_SOURCE 		// For copy_file_range, strcasecmp
 #include <ctype.h>		// For isprint, isspace, etc.
 #include <dirent.h>		// For scandir, etc.
 #include <errno.h>		// For errno
+#include <fcntl.h>		// For open
 #include <linux/limits.h>	// For PATH_MAX
 #include <linux/stddef.h>	// For NULL
 #include <stdio.h>		// For FILE,fprintf
 #include <stdlib.h>		// For exit, system, malloc, calloc, free, etc.
 #include <string.h>		// For string functions
+#include <sys/mman.h>		// For mmap, munmap
+#include <sys/sendfile.h>	// For sendfile
 #include <sys/stat.h>		// For mkdir
 #include <sys/types.h>		// For mkdir
+#include <time.h>		// For gmtime_r
 #include <unistd.h>		// For unlink
+#include <zlib.h>		// For deflate
 
 #include "swad_config.h"
 #include "swad_global.h"
@@ -54,18 +60,74 @@ extern struct Globals Gbl;
 
 #define NUM_BYTES_PER_CHUNK 4096
 
+#define Fil_NUM_BYTES_PER_BLOCK_FROM_STDIN (64 * 1024)	// Timeout is checked once per block
+
+/* Content types of the files sent by this CGI, depending on their extensions */
+static const struct
+  {
+   const char *Extension;
+   const char *ContentType;
+  } Fil_ContentTypes[] =
+  {
+   {"pdf"	,"application/pdf"},
+   {"htm"	,"text/html"},
+   {"html"	,"text/html"},
+   {"txt"	,"text/plain"},
+   {"csv"	,"text/csv"},
+   {"css"	,"text/css"},
+   {"xml"	,"application/xml"},
+   {"jpg"	,"image/jpeg"},
+   {"jpeg"	,"image/jpeg"},
+   {"png"	,"image/png"},
+   {"gif"	,"image/gif"},
+   {"svg"	,"image/svg+xml"},
+   {"mp3"	,"audio/mpeg"},
+   {"ogg"	,"audio/ogg"},
+   {"mp4"	,"video/mp4"},
+   {"webm"	,"video/webm"},
+   {"zip"	,"application/zip"},
+   {"doc"	,"application/msword"},
+   {"docx"	,"application/vnd.openxmlformats-officedocument.wordprocessingml.document"},
+   {"xls"	,"application/vnd.ms-excel"},
+   {"xlsx"	,"application/vnd.openxmlformats-officedocument.spreadsheetml.sheet"},
+   {"ppt"	,"application/vnd.ms-powerpoint"},
+   {"pptx"	,"application/vnd.openxmlformats-officedocument.presentationml.presentation"},
+   {"odt"	,"application/vnd.oasis.opendocument.text"},
+   {"ods"	,"application/vnd.oasis.opendocument.spreadsheet"},
+   {"odp"	,"application/vnd.oasis.opendocument.presentation"},
+  };
+#define Fil_NUM_CONTENT_TYPES (sizeof (Fil_ContentTypes) / sizeof (Fil_ContentTypes[0]))
+
 /*****************************************************************************/
 /******************************* Private types *******************************/
 /*****************************************************************************/
 
+typedef enum
+  {
+   Fil_RANGE_NOT_REQUESTED,
+   Fil_RANGE_SATISFIABLE,
+   Fil_RANGE_NOT_SATISFIABLE,
+  } Fil_Range_t;
+
 /*****************************************************************************/
 /***************************** Private variables *****************************/
 /*****************************************************************************/
 
+static z_stream Fil_GzipStream;	// Used to compress the page sent to standard output
+
 /*****************************************************************************/
 /***************************** Private prototypes ****************************/
 /*****************************************************************************/
 
+static void Fil_WriteContentHeaders (const char *FileName);
+static Fil_Range_t Fil_GetRangeRequested (off_t Size,const char *ETag,const char *LastModified,
+                                          off_t *Start,off_t *End);
+static void Fil_SendPartOfFile (int FileDescriptor,off_t Offset,off_t Length);
+
+static ssize_t Fil_WriteCompressedOutput (void *Cookie,const char *Buf,size_t Size);
+static int Fil_CloseCompressedOutput (void *Cookie);
+static void Fil_DeflateIntoStdout (z_stream *Stream,const char *Buf,size_t Size,int Flush);
+
 /*****************************************************************************/
 /******** Create HTML output file for the web page sent by this CGI **********/
 /*****************************************************************************/
@@ -79,7 +141,9 @@ void Fil_CreateFileForHTMLOutput (void)
    Fil_CreateDirIfNotExists (PathHTMLOutputPriv);
 
    /***** Remove old files *****/
-   Fil_RemoveOldTmpFiles (PathHTMLOutputPriv,Cfg_TIME_TO_DELETE_HTML_OUTPUT,false);
+   // Not in automatic refreshes, which are very frequent
+   if (!Gbl.Action.IsAJAXAutoRefresh)
+      Fil_RemoveOldTmpFiles (PathHTMLOutputPriv,Cfg_TIME_TO_DELETE_HTML_OUTPUT,false);
 
    /***** Create a unique name for the file *****/
    sprintf (Gbl.HTMLOutput.FileName,"%s/%s.html",
@@ -104,7 +168,7 @@ void Fil_CloseAndRemoveFileForHTMLOutput (void)
       fclose (Gbl.F.Out);
       unlink (Gbl.HTMLOutput.FileName);
      }
-   Gbl.F.Out = stdout;
+   Gbl.F.Out = Gbl.F.Std;
   }
 
 /*****************************************************************************/
@@ -116,6 +180,8 @@ bool Fil_ReadStdinIntoTmpFile (void)
   {
    extern const char *Txt_UPLOAD_FILE_File_too_large_maximum_X_MiB_NO_HTML;
    extern const char *Txt_UPLOAD_FILE_Upload_time_too_long_maximum_X_minutes_NO_HTML;
+   char Bytes[Fil_NUM_BYTES_PER_BLOCK_FROM_STDIN];
+   size_t NumBytesRead;
    unsigned long long TmpFileSize;
    bool FileIsTooBig = false;
    bool TimeExceeded = false;
@@ -125,15 +191,21 @@ bool Fil_ReadStdinIntoTmpFile (void)
       Fil_EndOfReadingStdin ();
       Lay_ShowErrorAndExit ("Can not create temporary file.");
      }
+
+   /***** Copy stdin into temporary file block by block *****/
    for (TmpFileSize = 0;
-	!feof (stdin) && !FileIsTooBig && !TimeExceeded;
-	TmpFileSize++)
-      if (TmpFileSize < Fil_MAX_FILE_SIZE)
+	!FileIsTooBig && !TimeExceeded &&
+	(NumBytesRead = fread ((void *) Bytes,sizeof (Bytes[0]),sizeof (Bytes),stdin)) != 0;
+	TmpFileSize += NumBytesRead)
+      if (TmpFileSize + NumBytesRead <= Fil_MAX_FILE_SIZE)
         {
-         if (!(TmpFileSize % (64ULL * 1024ULL)))	// Check timeout from time to time
-            if (time (NULL) - Gbl.StartExecutionTimeUTC >= Cfg_TIME_TO_ABORT_FILE_UPLOAD)
-               TimeExceeded = true;
-         fputc (fgetc (stdin),Gbl.F.Tmp);
+         if (time (NULL) - Gbl.StartExecutionTimeUTC >= Cfg_TIME_TO_ABORT_FILE_UPLOAD)
+            TimeExceeded = true;
+         else if (fwrite ((void *) Bytes,sizeof (Bytes[0]),NumBytesRead,Gbl.F.Tmp) != NumBytesRead)
+           {
+            Fil_EndOfReadingStdin ();
+            Lay_ShowErrorAndExit ("Can not write temporary file.");
+           }
         }
       else
          FileIsTooBig = true;
@@ -161,6 +233,19 @@ bool Fil_ReadStdinIntoTmpFile (void)
 	       Gbl.Alert.Txt);
       return false;
      }
+
+   /***** Map temporary file in memory,
+          so parameters are parsed and got without reading the file again *****/
+   if (fflush (Gbl.F.Tmp))
+      Lay_ShowErrorAndExit ("Can not write temporary file.");
+   Gbl.F.TmpSize = (size_t) TmpFileSize;
+   if (Gbl.F.TmpSize)
+      if ((Gbl.F.TmpMap = (char *) mmap (NULL,Gbl.F.TmpSize,PROT_READ,MAP_SHARED,
+                                         fileno (Gbl.F.Tmp),0)) == MAP_FAILED)
+	{
+	 Gbl.F.TmpMap = NULL;
+         Lay_ShowErrorAndExit ("Can not map temporary file.");
+	}
    rewind (Gbl.F.Tmp);
 
    return true;
@@ -172,8 +257,9 @@ bool Fil_ReadStdinIntoTmpFile (void)
 
 void Fil_EndOfReadingStdin (void)
   {
-   while (!feof (stdin))
-      fgetc (stdin);
+   char Bytes[NUM_BYTES_PER_CHUNK];
+
+   while (fread ((void *) Bytes,sizeof (Bytes[0]),sizeof (Bytes),stdin) != 0);
   }
 
 /*****************************************************************************/
@@ -241,24 +327,24 @@ struct Param *Fil_StartReceptionOfFile (const char *ParamFile,
       Lay_ShowErrorAndExit ("Error while getting filename.");
 
    /* Copy filename */
-   fseek (Gbl.F.Tmp,Param->FileName.Start,SEEK_SET);
-   if (fread (FileName,sizeof (char),Param->FileName.Length,Gbl.F.Tmp) !=
-       Param->FileName.Length)
-      Lay_ShowErrorAndExit ("Error while getting filename.");
+   memcpy ((void *) FileName,(const void *) &Gbl.F.TmpMap[Param->FileName.Start],
+           Param->FileName.Length);
    FileName[Param->FileName.Length] = '\0';
 
    /***** Get MIME type *****/
-   /* Check if MIME type exists */
+   /* Check if MIME type exists (it's optional) */
    if (Param->ContentType.Start == 0 ||
-       Param->ContentType.Length == 0 ||
-       Param->ContentType.Length > Brw_MAX_BYTES_MIME_TYPE)
+       Param->ContentType.Length == 0)
+     {
+      MIMEType[0] = '\0';
+      return Param;
+     }
+   if (Param->ContentType.Length > Brw_MAX_BYTES_MIME_TYPE)
       Lay_ShowErrorAndExit ("Error while getting content type.");
 
    /* Copy MIME type */
-   fseek (Gbl.F.Tmp,Param->ContentType.Start,SEEK_SET);
-   if (fread (MIMEType,sizeof (char),Param->ContentType.Length,Gbl.F.Tmp) !=
-       Param->ContentType.Length)
-      Lay_ShowErrorAndExit ("Error while getting content type.");
+   memcpy ((void *) MIMEType,(const void *) &Gbl.F.TmpMap[Param->ContentType.Start],
+           Param->ContentType.Length);
    MIMEType[Param->ContentType.Length] = '\0';
 
    return Param;
@@ -271,42 +357,48 @@ struct Param *Fil_StartReceptionOfFile (const char *ParamFile,
 bool Fil_EndReceptionOfFile (char *FileNameDataTmp,struct Param *Param)
   {
    extern const char *Txt_UPLOAD_FILE_File_too_large_maximum_X_MiB_NO_HTML;
-   FILE *FileDataTmp;
-   unsigned char Bytes[NUM_BYTES_PER_CHUNK];
+   int FileDataTmp;
+   loff_t OffsetSrc;
    size_t RemainingBytesToCopy;
-   size_t BytesToCopy;
+   ssize_t BytesCopied;
 
    /***** Open destination file *****/
-   if ((FileDataTmp = fopen (FileNameDataTmp,"wb")) == NULL)
+   if ((FileDataTmp = open (FileNameDataTmp,O_WRONLY | O_CREAT | O_TRUNC,0666)) < 0)
       Lay_ShowErrorAndExit ("Can not open temporary file.");
 
    /***** Copy file *****/
    /* Go to start of source */
    if (Param->Value.Start == 0)
       Lay_ShowErrorAndExit ("Error while copying file.");
-   fseek (Gbl.F.Tmp,Param->Value.Start,SEEK_SET);
 
-   /* Copy part of Gbl.F.Tmp to FileDataTmp */
-   for (RemainingBytesToCopy = Param->Value.Length;
+   /* Copy part of Gbl.F.Tmp to FileDataTmp.
+      Data are copied inside the kernel when possible,
+      without passing through user space */
+   for (OffsetSrc = (loff_t) Param->Value.Start,
+	RemainingBytesToCopy = Param->Value.Length;
 	RemainingBytesToCopy != 0;
-	RemainingBytesToCopy -= BytesToCopy)
+	RemainingBytesToCopy -= (size_t) BytesCopied)
      {
-      BytesToCopy = (RemainingBytesToCopy >= NUM_BYTES_PER_CHUNK) ? NUM_BYTES_PER_CHUNK :
-	                                                            RemainingBytesToCopy;
-      if (fread ((void *) Bytes,1,BytesToCopy,Gbl.F.Tmp) != BytesToCopy)
+      BytesCopied = copy_file_range (fileno (Gbl.F.Tmp),&OffsetSrc,
+                                     FileDataTmp,NULL,
+                                     RemainingBytesToCopy,0);
+      if (BytesCopied < 0 &&
+	  (errno == ENOSYS || errno == EXDEV ||
+	   errno == EINVAL || errno == EOPNOTSUPP))	// Not supported in these files
+	 /* Write from temporary file mapped in memory */
+	 if ((BytesCopied = write (FileDataTmp,
+	                           (const void *) &Gbl.F.TmpMap[OffsetSrc],
+	                           RemainingBytesToCopy)) > 0)
+	    OffsetSrc += (loff_t) BytesCopied;
+      if (BytesCopied <= 0)
 	{
-         fclose (FileDataTmp);
-	 return false;
-	}
-      if (fwrite ((void *) Bytes,sizeof (Bytes[0]),BytesToCopy,FileDataTmp) != BytesToCopy)
-	{
-         fclose (FileDataTmp);
+         close (FileDataTmp);
 	 return false;
 	}
      }
 
    /***** Close destination file *****/
-   fclose (FileDataTmp);
+   close (FileDataTmp);
 
    return true;
   }
@@ -581,6 +673,326 @@ void Fil_FastCopyOfOpenFiles (FILE *FileSrc,FILE *FileTgt)
       fwrite ((void *) Bytes,sizeof (Bytes[0]),NumBytesRead,FileTgt);
   }
 
+/*****************************************************************************/
+/************* Send a private file to the client as the response *************/
+/*****************************************************************************/
+// Nothing must have been written to stdout before calling this function
+// Returns false if the file can not be opened (nothing is written in that case)
+
+bool Fil_SendFileToClient (const char *FullPath,const char *FileName)
+  {
+   int FileDescriptor;
+   struct stat FileStatus;
+   char PathInServer[PATH_MAX + 1];
+   char XAccelRedirect[PATH_MAX + 1];
+   char ETag[1 + 16 + 1 + 16 + 1 + 1];
+   char LastModified[Fil_MAX_BYTES_HTTP_DATE + 1];
+   const char *RequestMethod;
+   off_t Start;
+   off_t End;
+
+   /***** Open file and get its status *****/
+   if ((FileDescriptor = open (FullPath,O_RDONLY)) < 0)
+      return false;
+   if (fstat (FileDescriptor,&FileStatus) ||
+       !S_ISREG (FileStatus.st_mode))
+     {
+      close (FileDescriptor);
+      return false;
+     }
+
+   /***** The web server can send the file by itself *****/
+   switch (Cfg_DOWNLOAD_METHOD)
+     {
+      case Cfg_DOWNLOAD_X_SENDFILE:
+	 close (FileDescriptor);
+	 Fil_WriteContentHeaders (FileName);
+	 fprintf (stdout,"X-Sendfile: %s\r\n"
+			 "\r\n",
+		  FullPath);
+	 return true;
+      case Cfg_DOWNLOAD_X_ACCEL_REDIRECT:
+	 if (!strncmp (FullPath,Cfg_PATH_SWAD_PRIVATE,strlen (Cfg_PATH_SWAD_PRIVATE)))
+	   {
+	    close (FileDescriptor);
+	    Fil_WriteContentHeaders (FileName);
+	    snprintf (PathInServer,sizeof (PathInServer),"%s%s",
+		      Cfg_URL_X_ACCEL_REDIRECT_PRIVATE,
+		      FullPath + strlen (Cfg_PATH_SWAD_PRIVATE));
+	    Str_CopyStrChangingSpaces (PathInServer,XAccelRedirect,PATH_MAX);	// URI must have no spaces
+	    fprintf (stdout,"X-Accel-Redirect: %s\r\n"
+			    "\r\n",
+		     XAccelRedirect);
+	    return true;
+	   }
+	 break;	// Not inside private directory ==> send it from here
+      default:
+	 break;
+     }
+
+   /***** Validators used in conditional requests *****/
+   snprintf (ETag,sizeof (ETag),"\"%llx-%llx\"",
+	     (unsigned long long) FileStatus.st_ino,
+	     (unsigned long long) FileStatus.st_mtime);
+   Fil_WriteHTTPDate (FileStatus.st_mtime,LastModified);
+
+   /***** If the client has the same file, don't send it again *****/
+   if (Fil_CheckIfFileIsNotModified (ETag,LastModified))
+     {
+      close (FileDescriptor);
+      fprintf (stdout,"Status: 304 Not Modified\r\n"
+		      "ETag: %s\r\n"
+		      "Last-Modified: %s\r\n"
+		      "\r\n",
+	       ETag,LastModified);
+      return true;
+     }
+
+   /***** Get the range of bytes requested *****/
+   Start = 0;
+   End = FileStatus.st_size - 1;
+   switch (Fil_GetRangeRequested (FileStatus.st_size,ETag,LastModified,&Start,&End))
+     {
+      case Fil_RANGE_NOT_REQUESTED:
+	 break;
+      case Fil_RANGE_SATISFIABLE:
+	 fprintf (stdout,"Status: 206 Partial Content\r\n"
+			 "Content-Range: bytes %lld-%lld/%lld\r\n",
+		  (long long) Start,(long long) End,
+		  (long long) FileStatus.st_size);
+	 break;
+      case Fil_RANGE_NOT_SATISFIABLE:
+	 close (FileDescriptor);
+	 fprintf (stdout,"Status: 416 Range Not Satisfiable\r\n"
+			 "Content-Range: bytes */%lld\r\n"
+			 "\r\n",
+		  (long long) FileStatus.st_size);
+	 return true;
+     }
+
+   /***** Write headers *****/
+   Fil_WriteContentHeaders (FileName);
+   fprintf (stdout,"Content-Length: %lld\r\n"
+		   "ETag: %s\r\n"
+		   "Last-Modified: %s\r\n"
+		   "Accept-Ranges: bytes\r\n"
+		   "Cache-Control: private\r\n"
+		   "\r\n",
+	    (long long) (End - Start + 1),
+	    ETag,LastModified);
+   fflush (stdout);
+
+   /***** Send content *****/
+   RequestMethod = getenv ("REQUEST_METHOD");
+   if (!RequestMethod ||
+       strcmp (RequestMethod,"HEAD"))
+      Fil_SendPartOfFile (FileDescriptor,Start,End - Start + 1);
+
+   close (FileDescriptor);
+   return true;
+  }
+
+/*****************************************************************************/
+/************** Write content type and disposition of a file *****************/
+/*****************************************************************************/
+
+static void Fil_WriteContentHeaders (const char *FileName)
+  {
+   const char *Extension;
+   const char *ContentType = "application/octet-stream";
+   unsigned NumType;
+
+   /***** Get content type from the extension of the file *****/
+   if ((Extension = strrchr (FileName,'.')))
+      for (NumType = 0, Extension++;
+	   NumType < Fil_NUM_CONTENT_TYPES;
+	   NumType++)
+	 if (!strcasecmp (Extension,Fil_ContentTypes[NumType].Extension))
+	   {
+	    ContentType = Fil_ContentTypes[NumType].ContentType;
+	    break;
+	   }
+
+   fprintf (stdout,"Content-Type: %s\r\n"
+		   "Content-Disposition: inline; filename=\"%s\"\r\n",
+	    ContentType,FileName);
+  }
+
+/*****************************************************************************/
+/********************** Write a date in HTTP headers *************************/
+/*****************************************************************************/
+// Day and month names are written in English, independently of locale
+
+void Fil_WriteHTTPDate (time_t Time,char HTTPDate[Fil_MAX_BYTES_HTTP_DATE + 1])
+  {
+   static const char *DayNames[7] =
+     {
+      "Sun","Mon","Tue","Wed","Thu","Fri","Sat",
+     };
+   static const char *MonthNames[12] =
+     {
+      "Jan","Feb","Mar","Apr","May","Jun",
+      "Jul","Aug","Sep","Oct","Nov","Dec",
+     };
+   struct tm tm;
+
+   /***** Years in HTTP dates have four digits *****/
+   if (Time < (time_t) 0)
+      Time = (time_t) 0;
+   else if ((long long) Time > Fil_LAST_TIME_IN_HTTP_DATE)
+      Time = (time_t) Fil_LAST_TIME_IN_HTTP_DATE;
+
+   /***** Write date *****/
+   if (gmtime_r (&Time,&tm) == NULL ||
+       snprintf (HTTPDate,Fil_MAX_BYTES_HTTP_DATE + 1,"%s, %02d %s %04d %02d:%02d:%02d GMT",
+		 DayNames[tm.tm_wday],tm.tm_mday,MonthNames[tm.tm_mon],tm.tm_year + 1900,
+		 tm.tm_hour,tm.tm_min,tm.tm_sec) > Fil_MAX_BYTES_HTTP_DATE)
+      HTTPDate[0] = '\0';
+  }
+
+/*****************************************************************************/
+/****** Check if the copy of the file that the client has is up to date ******/
+/*****************************************************************************/
+// LastModified may be NULL when only the entity tag must be checked
+
+bool Fil_CheckIfFileIsNotModified (const char *ETag,const char *LastModified)
+  {
+   const char *IfNoneMatch;
+   const char *IfModifiedSince;
+
+   /***** If-None-Match takes precedence over If-Modified-Since *****/
+   if ((IfNoneMatch = getenv ("HTTP_IF_NONE_MATCH")))
+      return !strcmp (IfNoneMatch,"*") ||
+	     strstr (IfNoneMatch,ETag) != NULL;
+
+   /***** Browsers send back the same date they received *****/
+   if (LastModified &&
+       (IfModifiedSince = getenv ("HTTP_IF_MODIFIED_SINCE")))
+      return !strcmp (IfModifiedSince,LastModified);
+
+   return false;
+  }
+
+/*****************************************************************************/
+/****************** Get the range of bytes of a request **********************/
+/*****************************************************************************/
+// Only a single range is supported. With several ranges the whole file is sent
+
+static Fil_Range_t Fil_GetRangeRequested (off_t Size,const char *ETag,const char *LastModified,
+                                          off_t *Start,off_t *End)
+  {
+   const char *Range;
+   const char *IfRange;
+   char *Ptr;
+   long long First;
+   long long Last;
+
+   /***** Get range *****/
+   if ((Range = getenv ("HTTP_RANGE")) == NULL)
+      return Fil_RANGE_NOT_REQUESTED;
+   if (strncmp (Range,"bytes=",6) ||
+       strchr (Range,','))
+      return Fil_RANGE_NOT_REQUESTED;
+   Range += 6;
+
+   /***** If the file has changed, the whole file must be sent *****/
+   if ((IfRange = getenv ("HTTP_IF_RANGE")))
+      if (strcmp (IfRange,ETag) &&
+	  strcmp (IfRange,LastModified))
+	 return Fil_RANGE_NOT_REQUESTED;
+
+   if (*Range == '-')		// Last bytes: "bytes=-500"
+     {
+      Last = strtoll (Range + 1,&Ptr,10);
+      if (Ptr == Range + 1 || *Ptr || Last < 0)
+	 return Fil_RANGE_NOT_REQUESTED;
+      if (Last == 0 || Size == 0)
+	 return Fil_RANGE_NOT_SATISFIABLE;
+      *Start = (Last >= (long long) Size) ? 0 :
+					    Size - (off_t) Last;
+      *End = Size - 1;
+     }
+   else				// "bytes=500-999" or "bytes=500-"
+     {
+      First = strtoll (Range,&Ptr,10);
+      if (Ptr == Range || *Ptr != '-' || First < 0)
+	 return Fil_RANGE_NOT_REQUESTED;
+      Range = Ptr + 1;
+      if (*Range)
+	{
+	 Last = strtoll (Range,&Ptr,10);
+	 if (*Ptr || Last < First)
+	    return Fil_RANGE_NOT_REQUESTED;
+	}
+      else
+	 Last = (long long) Size - 1;
+      if (First >= (long long) Size)
+	 return Fil_RANGE_NOT_SATISFIABLE;
+      if (Last >= (long long) Size)
+	 Last = (long long) Size - 1;
+      *Start = (off_t) First;
+      *End   = (off_t) Last;
+     }
+
+   return Fil_RANGE_SATISFIABLE;
+  }
+
+/*****************************************************************************/
+/************************ Send a part of a file to stdout ********************/
+/*****************************************************************************/
+
+static void Fil_SendPartOfFile (int FileDescriptor,off_t Offset,off_t Length)
+  {
+   int OutputDescriptor = fileno (stdout);
+   char Buffer[NUM_BYTES_PER_CHUNK];
+   ssize_t NumBytes;
+
+   /***** Copy the data inside the kernel *****/
+   while (Length > 0)
+     {
+      if ((NumBytes = sendfile (OutputDescriptor,FileDescriptor,&Offset,(size_t) Length)) > 0)
+	 Length -= NumBytes;
+      else if (NumBytes < 0 && errno == EINTR)
+	 continue;
+      else if (NumBytes < 0 && (errno == EINVAL || errno == ENOSYS))
+	 break;		// sendfile not supported for this output ==> use read and write
+      else
+	 return;	// Client closed the connection or file was truncated
+     }
+
+   /***** Copy the rest of the data using a buffer *****/
+   if (Length > 0 &&
+       lseek (FileDescriptor,Offset,SEEK_SET) == Offset)
+      while (Length > 0)
+	{
+	 if ((NumBytes = read (FileDescriptor,Buffer,
+			       Length < (off_t) sizeof (Buffer) ? (size_t) Length :
+								  sizeof (Buffer))) <= 0)
+	    return;
+	 if (write (OutputDescriptor,Buffer,(size_t) NumBytes) != NumBytes)
+	    return;
+	 Length -= NumBytes;
+	}
+  }
+
+/*****************************************************************************/
+/************************* Close temporary file ******************************/
+/*****************************************************************************/
+
+void Fil_CloseTmpFile (void)
+  {
+   if (Gbl.F.TmpMap)
+     {
+      munmap ((void *) Gbl.F.TmpMap,Gbl.F.TmpSize);
+      Gbl.F.TmpMap = NULL;
+     }
+   if (Gbl.F.Tmp)
+     {
+      fclose (Gbl.F.Tmp);
+      Gbl.F.Tmp = NULL;	// To indicate that it is not open
+     }
+  }
+
 /*****************************************************************************/
 /**************************** Close XML file *********************************/
 /*****************************************************************************/
@@ -645,3 +1057,159 @@ void Fil_WriteFileSizeFull (double SizeInBytes,
    else
       sprintf (FileSizeStr,"%.1f&nbsp;TiB",SizeInBytes / Ti);
   }
+
+/*****************************************************************************/
+/********** Check if the client accepts pages compressed with gzip ***********/
+/*****************************************************************************/
+
+bool Fil_CheckIfClientAcceptsGzip (void)
+  {
+   const char *AcceptEncoding;
+   const char *Ptr;
+   char Coding[16 + 1];
+   double Quality;
+   size_t Length;
+
+   if (Cfg_OUTPUT_COMPRESSION_LEVEL == 0)
+      return false;
+
+   /***** Get codings accepted by the client,
+          for example "gzip, deflate;q=0.5, br" *****/
+   if ((AcceptEncoding = getenv ("HTTP_ACCEPT_ENCODING")) == NULL)
+      return false;
+
+   for (Ptr = AcceptEncoding;
+	*Ptr;
+	Ptr += strcspn (Ptr,","))
+     {
+      /* Skip separators */
+      Ptr += strspn (Ptr,", \t");
+
+      /* Get coding */
+      Length = strcspn (Ptr,",; \t");
+      if (Length == 0 || Length > sizeof (Coding) - 1)
+	 continue;
+      strncpy (Coding,Ptr,Length);
+      Coding[Length] = '\0';
+      if (strcasecmp (Coding,"gzip") &&
+	  strcasecmp (Coding,"x-gzip"))
+	 continue;
+
+      /* A quality value of 0 means "not acceptable" */
+      Ptr += Length;
+      Ptr += strspn (Ptr," \t");
+      if (*Ptr == ';')
+	{
+	 Ptr += 1 + strspn (Ptr + 1," \t");
+	 if (!strncasecmp (Ptr,"q=",2))
+	   {
+	    Quality = strtod (Ptr + 2,NULL);
+	    if (Quality <= 0.0)
+	       return false;
+	   }
+	}
+      return true;
+     }
+
+   return false;
+  }
+
+/*****************************************************************************/
+/********* Start sending to standard output compressed with gzip *************/
+/*****************************************************************************/
+// Return false if compression can not be started
+// Headers must be written directly to stdout, not to Gbl.F.Std
+
+bool Fil_StartCompressedOutput (void)
+  {
+   cookie_io_functions_t CompressedOutputFunctions =
+     {
+      .read  = NULL,
+      .write = Fil_WriteCompressedOutput,
+      .seek  = NULL,
+      .close = Fil_CloseCompressedOutput,
+     };
+   FILE *CompressedOutput;
+
+   /***** Initialize compression (15 + 16 ==> gzip header and trailer) *****/
+   Fil_GzipStream.zalloc = Z_NULL;
+   Fil_GzipStream.zfree  = Z_NULL;
+   Fil_GzipStream.opaque = Z_NULL;
+   if (deflateInit2 (&Fil_GzipStream,Cfg_OUTPUT_COMPRESSION_LEVEL,
+		     Z_DEFLATED,15 + 16,8,Z_DEFAULT_STRATEGY) != Z_OK)
+      return false;
+
+   /***** Open a stream that compresses what is written on it *****/
+   if ((CompressedOutput = fopencookie ((void *) &Fil_GzipStream,"w",CompressedOutputFunctions)) == NULL)
+     {
+      deflateEnd (&Fil_GzipStream);
+      return false;
+     }
+
+   /***** From now on, page is sent through the compressed stream *****/
+   Gbl.F.Std = CompressedOutput;
+   return true;
+  }
+
+/*****************************************************************************/
+/********** End sending to standard output compressed with gzip **************/
+/*****************************************************************************/
+
+void Fil_EndCompressedOutput (void)
+  {
+   if (Gbl.F.Std != stdout)
+     {
+      if (Gbl.F.Out == Gbl.F.Std)
+	 Gbl.F.Out = stdout;
+
+      /* Write pending bytes and gzip trailer */
+      fclose (Gbl.F.Std);
+      Gbl.F.Std = stdout;
+     }
+  }
+
+/*****************************************************************************/
+/************* Compress bytes written in the compressed stream ***************/
+/*****************************************************************************/
+
+static ssize_t Fil_WriteCompressedOutput (void *Cookie,const char *Buf,size_t Size)
+  {
+   Fil_DeflateIntoStdout ((z_stream *) Cookie,Buf,Size,Z_NO_FLUSH);
+   return (ssize_t) Size;
+  }
+
+/*****************************************************************************/
+/************************ Close the compressed stream ************************/
+/*****************************************************************************/
+
+static int Fil_CloseCompressedOutput (void *Cookie)
+  {
+   Fil_DeflateIntoStdout ((z_stream *) Cookie,NULL,0,Z_FINISH);
+   Gbl.HTMLOutput.SentBytes = (unsigned long) ((z_stream *) Cookie)->total_out;
+   deflateEnd ((z_stream *) Cookie);
+   fflush (stdout);
+   return 0;
+  }
+
+/*****************************************************************************/
+/****************** Compress bytes and write them to stdout ******************/
+/*****************************************************************************/
+
+static void Fil_DeflateIntoStdout (z_stream *Stream,const char *Buf,size_t Size,int Flush)
+  {
+   unsigned char Bytes[NUM_BYTES_PER_CHUNK * 4];
+
+   Stream->next_in  = (Bytef *) Buf;
+   Stream->avail_in = (uInt) Size;
+
+   /***** Output buffer full ==> there may be more compressed bytes *****/
+   do
+     {
+      Stream->next_out  = Bytes;
+      Stream->avail_out = (uInt) sizeof (Bytes);
+      deflate (Stream,Flush);
+      fwrite ((void *) Bytes,sizeof (Bytes[0]),
+	      sizeof (Bytes) - Stream->avail_out,stdout);
+     }
+   while (Stream->avail_out == 0);
+  }
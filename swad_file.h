@@ -48,13 +48,19 @@
 struct Files
   {
    FILE *Out;		// File with the HTML output of this CGI
+   FILE *Std;		// Standard output (compressed or not) where the page is sent
    FILE *Tmp;		// Temporary file to save stdin
+   char *TmpMap;	// Temporary file mapped in memory
+   size_t TmpSize;	// Size of temporary file
    FILE *XML;		// XML file for syllabus, for directory tree
    FILE *Rep;		// Temporary file to save report
   };
 
 #define Fil_MAX_BYTES_FILE_SIZE_STRING (32 - 1)
 
+#define Fil_MAX_BYTES_HTTP_DATE (3 + 2 + 2 + 1 + 3 + 1 + 4 + 1 + 8 + 4)	// "Sun, 06 Nov 1994 08:49:37 GMT"
+#define Fil_LAST_TIME_IN_HTTP_DATE 253402300799LL	// "Fri, 31 Dec 9999 23:59:59 GMT"
+
 /*****************************************************************************/
 /***************************** Public prototypes *****************************/
 /*****************************************************************************/
@@ -81,7 +87,15 @@ void Fil_RemoveTree (const char *Path);
 void Fil_RemoveOldTmpFiles (const char *Path,time_t TimeToRemove,bool RemoveDirectory);
 void Fil_FastCopyOfFiles (const char *PathSrc,const char *PathTgt);
 void Fil_FastCopyOfOpenFiles (FILE *FileSrc,FILE *FileTgt);
+bool Fil_SendFileToClient (const char *FullPath,const char *FileName);
+void Fil_WriteHTTPDate (time_t Time,char HTTPDate[Fil_MAX_BYTES_HTTP_DATE + 1]);
+bool Fil_CheckIfFileIsNotModified (const char *ETag,const char *LastModified);
+
+bool Fil_CheckIfClientAcceptsGzip (void);
+bool Fil_StartCompressedOutput (void);
+void Fil_EndCompressedOutput (void);
 
+void Fil_CloseTmpFile (void);
 void Fil_CloseXMLFile (void);
 void Fil_CloseReportFile (void);
 
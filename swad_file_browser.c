@@ -81,6 +81,8 @@ struct Brw_NumObjects
 /**************************** Internal constants *****************************/
 /*****************************************************************************/
 
+#define Brw_ID_FORM_DOWNLOAD_FILE "download_file"	// Id of the form to download a file from its metadata
+
 const char *Brw_FileTypeParamName[Brw_NUM_FILE_TYPES] =
   {
    "BrwFFL",	// Brw_IS_UNKNOWN
@@ -1683,7 +1685,8 @@ static bool Brw_CheckIfIAmOwnerOfFile (long PublisherUsrCod);
 static void Brw_WriteBigLinkToDownloadFile (const char *URL,
                                             struct FileMetadata *FileMetadata,
                                             const char *FileNameToShow);
-static void Brw_WriteSmallLinkToDownloadFile (const char *URL,Brw_FileType_t FileType,
+static void Brw_WriteSmallLinkToDownloadFile (const char *URL,
+                                              struct FileMetadata *FileMetadata,
                                               const char *FileNameToShow);
 static bool Brw_GetParamPublicFile (void);
 static Brw_License_t Brw_GetParLicense (void);
@@ -4672,6 +4675,15 @@ void Brw_RemoveCrsFilesFromDB (long CrsCod)
 	    CrsCod);
    DB_QueryDELETE (Query,"can not remove the properties of marks associated to a course");
 
+   /***** Remove indexes of files of marks *****/
+   sprintf (Query,"DELETE FROM marks_rows USING files,marks_rows"
+	          " WHERE files.FileBrowser=%u"
+	          " AND files.Cod=%ld"
+	          " AND files.FilCod=marks_rows.FilCod",
+	    (unsigned) Brw_ADMI_MRK_CRS,
+	    CrsCod);
+   DB_QueryDELETE (Query,"can not remove the indexes of marks associated to a course");
+
    /***** Remove from database the entries that store the file views *****/
    /* Remove from course file zones */
    sprintf (Query,"DELETE FROM file_view USING file_view,files"
@@ -4902,6 +4914,15 @@ void Brw_RemoveGrpFilesFromDB (long GrpCod)
 	    GrpCod);
    DB_QueryDELETE (Query,"can not remove the properties of marks associated to a group");
 
+   /***** Remove indexes of files of marks *****/
+   sprintf (Query,"DELETE FROM marks_rows USING files,marks_rows"
+	          " WHERE files.FileBrowser=%u"
+	          " AND files.Cod=%ld"
+	          " AND files.FilCod=marks_rows.FilCod",
+	    (unsigned) Brw_ADMI_MRK_GRP,
+	    GrpCod);
+   DB_QueryDELETE (Query,"can not remove the indexes of marks associated to a group");
+
    /***** Remove from database the entries that store the file views *****/
    sprintf (Query,"DELETE FROM file_view USING file_view,files"
 		  " WHERE files.FileBrowser IN (%u,%u,%u,%u)"
@@ -9910,13 +9931,13 @@ void Brw_ShowFileMetadata (void)
 	    FileHasPublisher = false;	// Get user's data from database
 
 	 /***** Get link to download the file *****/
-	 if (Gbl.FileBrowser.Type == Brw_SHOW_MRK_CRS ||
-	     Gbl.FileBrowser.Type == Brw_SHOW_MRK_GRP)
-	    URL[0] = '\0';
-	 else
+	 // Files are downloaded through a form, only links need an URL
+	 if (FileMetadata.FileType == Brw_IS_LINK)
 	    Brw_GetLinkToDownloadFile (FileMetadata.PathInTreeUntilFilFolLnk,
 				       FileMetadata.FilFolLnkName,
 				       URL);
+	 else
+	    URL[0] = '\0';
 
 	 /***** Can I edit the properties of the file? *****/
 	 IAmTheOwner = Brw_CheckIfIAmOwnerOfFile (FileMetadata.PublisherUsrCod);
@@ -9927,6 +9948,21 @@ void Brw_ShowFileMetadata (void)
 	                        FileMetadata.FilFolLnkName,
 	                        FileNameToShow);
 
+	 /***** Form to download the file.
+	        It's written here because the links to download the file
+	        may be inside the form to update the metadata *****/
+	 if (FileMetadata.FileType == Brw_IS_FILE &&
+	     Gbl.FileBrowser.Type != Brw_SHOW_MRK_CRS &&
+	     Gbl.FileBrowser.Type != Brw_SHOW_MRK_GRP)
+	   {
+	    Act_FormStartId (Brw_ActDowFile[Gbl.FileBrowser.Type],Brw_ID_FORM_DOWNLOAD_FILE);
+	    Brw_PutParamsFileBrowser (Brw_ActDowFile[Gbl.FileBrowser.Type],
+				      FileMetadata.PathInTreeUntilFilFolLnk,
+				      FileMetadata.FilFolLnkName,
+				      FileMetadata.FileType,-1L);
+	    Act_FormEnd ();
+	   }
+
 	 /***** Start form to update the metadata of a file *****/
 	 if (ICanEdit)	// I can edit file properties
 	   {
@@ -9973,7 +10009,7 @@ void Brw_ShowFileMetadata (void)
 			    "</td>"
 			    "<td class=\"DAT LEFT_MIDDLE\">",
 		  The_ClassForm[Gbl.Prefs.Theme],Txt_Filename);
-	 Brw_WriteSmallLinkToDownloadFile (URL,FileMetadata.FileType,FileNameToShow);
+	 Brw_WriteSmallLinkToDownloadFile (URL,&FileMetadata,FileNameToShow);
 	 fprintf (Gbl.F.Out,"</td>"
 			    "</tr>");
 
@@ -10237,6 +10273,7 @@ void Brw_DownloadFile (void)
    extern const char *Txt_The_file_of_folder_no_longer_exists_or_is_now_hidden;
    struct FileMetadata FileMetadata;
    char URL[PATH_MAX + 1];
+   char FullPathIncludingFile[PATH_MAX + 1];
    bool Found;
    bool ICanView = false;
 
@@ -10291,13 +10328,12 @@ void Brw_DownloadFile (void)
 	 Brw_GetAndUpdateFileViews (&FileMetadata);
 
 	 /***** Get link to download the file *****/
-	 if (Gbl.FileBrowser.Type == Brw_SHOW_MRK_CRS ||
-	     Gbl.FileBrowser.Type == Brw_SHOW_MRK_GRP)
-	    URL[0] = '\0';
-	 else
+	 if (FileMetadata.FileType == Brw_IS_LINK)	// URL inside .url file
 	    Brw_GetLinkToDownloadFile (Gbl.FileBrowser.Priv.PathInTreeUntilFilFolLnk,
 				       Gbl.FileBrowser.FilFolLnkName,
 				       URL);
+	 else						// The file itself is sent below
+	    URL[0] = '\0';
 
 	 /***** Mark possible notifications as seen *****/
 	 switch (Gbl.FileBrowser.Type)
@@ -10339,10 +10375,21 @@ void Brw_DownloadFile (void)
       Brw_InsFoldersInPathAndUpdOtherFoldersInExpandedFolders (Gbl.FileBrowser.Priv.PathInTreeUntilFilFolLnk);
 
       /***** Download the file *****/
-      fprintf (stdout,"Location: %s\n\n",URL);
-      // TODO: Put headers Content-type and Content-disposition:
-      // See: http://stackoverflow.com/questions/381954/how-do-i-fix-firefox-trying-to-save-image-as-htm
-      // http://elouai.com/force-download.php
+      if (FileMetadata.FileType == Brw_IS_FILE &&
+	  Gbl.FileBrowser.Type != Brw_SHOW_MRK_CRS &&
+	  Gbl.FileBrowser.Type != Brw_SHOW_MRK_GRP)
+	{
+	 /* Send the private file directly, without temporary public links */
+	 if (snprintf (FullPathIncludingFile,sizeof (FullPathIncludingFile),"%s/%s/%s",
+		       Gbl.FileBrowser.Priv.PathAboveRootFolder,
+		       Gbl.FileBrowser.Priv.PathInTreeUntilFilFolLnk,
+		       Gbl.FileBrowser.FilFolLnkName) >= (int) sizeof (FullPathIncludingFile))
+	    Lay_ShowErrorAndExit ("Path to file is too long.");
+	 if (!Fil_SendFileToClient (FullPathIncludingFile,Gbl.FileBrowser.FilFolLnkName))
+	    Lay_ShowErrorAndExit ("Can not open file to download.");
+	}
+      else
+	 fprintf (stdout,"Location: %s\n\n",URL);
       Gbl.Layout.HTMLStartWritten =
       Gbl.Layout.DivsEndWritten   =
       Gbl.Layout.HTMLEndWritten   = true;	// Don't write HTML at all
@@ -10490,11 +10537,12 @@ static void Brw_WriteBigLinkToDownloadFile (const char *URL,
    else
      {
       /* Put anchor and filename */
-      fprintf (Gbl.F.Out,"<a href=\"%s\" class=\"FILENAME_TXT\""
-                         " title=\"%s\" target=\"_blank\">",
-	       URL,
-	       (FileMetadata->FileType == Brw_IS_LINK) ? URL :	// If it's a link, show full URL in title
-		                                         FileNameToShow);
+      if (FileMetadata->FileType == Brw_IS_FILE)
+	 Act_LinkFormSubmitId (FileNameToShow,"FILENAME_TXT",Brw_ID_FORM_DOWNLOAD_FILE,NULL);
+      else
+	 fprintf (Gbl.F.Out,"<a href=\"%s\" class=\"FILENAME_TXT\""
+			    " title=\"%s\" target=\"_blank\">",
+		  URL,URL);	// If it's a link, show full URL in title
       Brw_PutIconFile (32,FileMetadata->FileType,FileMetadata->FilFolLnkName);
       fprintf (Gbl.F.Out,"&nbsp;%s&nbsp;"
 			 "<img src=\"%s/download64x64.png\""
@@ -10511,7 +10559,8 @@ static void Brw_WriteBigLinkToDownloadFile (const char *URL,
 /*********************** Write link to download a file ***********************/
 /*****************************************************************************/
 
-static void Brw_WriteSmallLinkToDownloadFile (const char *URL,Brw_FileType_t FileType,
+static void Brw_WriteSmallLinkToDownloadFile (const char *URL,
+                                              struct FileMetadata *FileMetadata,
                                               const char *FileNameToShow)
   {
    extern const char *Txt_Check_marks_in_file_X;
@@ -10526,7 +10575,7 @@ static void Brw_WriteSmallLinkToDownloadFile (const char *URL,Brw_FileType_t Fil
       Brw_PutParamsFileBrowser (ActUnk,
                                 Gbl.FileBrowser.Priv.PathInTreeUntilFilFolLnk,
 			        Gbl.FileBrowser.FilFolLnkName,
-			        FileType,-1L);
+			        FileMetadata->FileType,-1L);
 
       /* Link begin */
       sprintf (Gbl.Title,Txt_Check_marks_in_file_X,FileNameToShow);
@@ -10536,6 +10585,12 @@ static void Brw_WriteSmallLinkToDownloadFile (const char *URL,Brw_FileType_t Fil
       fprintf (Gbl.F.Out,"%s</a>",FileNameToShow);
       Act_FormEnd ();
      }
+   else if (FileMetadata->FileType == Brw_IS_FILE)
+     {
+      /* Link to the form to download the file */
+      Act_LinkFormSubmitId (FileNameToShow,"DAT",Brw_ID_FORM_DOWNLOAD_FILE,NULL);
+      fprintf (Gbl.F.Out,"%s</a>",FileNameToShow);
+     }
    else
       /* Put anchor and filename */
       fprintf (Gbl.F.Out,"<a href=\"%s\" class=\"DAT\" title=\"%s\" target=\"_blank\">%s</a>",
@@ -11572,20 +11627,28 @@ long Brw_AddPathToDB (long PublisherUsrCod,Brw_FileType_t FileType,
   {
    long Cod = Brw_GetCodForFiles ();
    long ZoneUsrCod = Brw_GetZoneUsrCodForFiles ();
-   char Query[512 + PATH_MAX];
+   char Query[512 + PATH_MAX + NAME_MAX];
+   char PathWithoutFileName[PATH_MAX + 1];
+   char FileName[NAME_MAX + 1];
+
+   /***** Get name of file/folder from path *****/
+   // Name of file/folder is stored apart from path to search by name
+   Str_SplitFullPathIntoPathAndFileName (FullPathInTree,
+                                         PathWithoutFileName,FileName);
 
    /***** Add path to the database *****/
    sprintf (Query,"INSERT INTO files"
 	          " (FileBrowser,Cod,ZoneUsrCod,"
-	          "PublisherUsrCod,FileType,Path,Hidden,Public,License)"
+	          "PublisherUsrCod,FileType,Path,Name,Hidden,Public,License)"
                   " VALUES"
                   " (%u,%ld,%ld,"
-                  "%ld,%u,'%s','N','%c',%u)",
+                  "%ld,%u,'%s','%s','N','%c',%u)",
             (unsigned) Brw_FileBrowserForDB_files[Gbl.FileBrowser.Type],
             Cod,ZoneUsrCod,
             PublisherUsrCod,
             (unsigned) FileType,
             FullPathInTree,
+            FileName,
             IsPublic ? 'Y' :
         	       'N',
             (unsigned) License);
@@ -11619,6 +11682,13 @@ static void Brw_RemoveOneFileOrFolderFromDB (const char Path[PATH_MAX + 1])
 		     " AND files.FilCod=marks_properties.FilCod",
 	       (unsigned) FileBrowser,Cod,Path);
       DB_QueryDELETE (Query,"can not remove properties of marks from database");
+
+      sprintf (Query,"DELETE FROM marks_rows USING files,marks_rows"
+		     " WHERE files.FileBrowser=%u AND files.Cod=%ld"
+		     " AND files.Path='%s'"
+		     " AND files.FilCod=marks_rows.FilCod",
+	       (unsigned) FileBrowser,Cod,Path);
+      DB_QueryDELETE (Query,"can not remove index of marks from database");
      }
 
    /***** Remove from database the entries that store the file views *****/
@@ -11664,6 +11734,13 @@ static void Brw_RemoveChildrenOfFolderFromDB (const char Path[PATH_MAX + 1])
 		     " AND files.FilCod=marks_properties.FilCod",
 	       (unsigned) FileBrowser,Cod,Path);
       DB_QueryDELETE (Query,"can not remove properties of marks from database");
+
+      sprintf (Query,"DELETE FROM marks_rows USING files,marks_rows"
+		     " WHERE files.FileBrowser=%u AND files.Cod=%ld"
+		     " AND files.Path LIKE '%s/%%'"
+		     " AND files.FilCod=marks_rows.FilCod",
+	       (unsigned) FileBrowser,Cod,Path);
+      DB_QueryDELETE (Query,"can not remove indexes of marks from database");
      }
 
    /***** Remove from database the entries that store the file views *****/
@@ -11691,12 +11768,19 @@ static void Brw_RenameOneFolderInDB (const char OldPath[PATH_MAX + 1],
   {
    long Cod = Brw_GetCodForFiles ();
    long ZoneUsrCod = Brw_GetZoneUsrCodForFiles ();
-   char Query[512 + PATH_MAX * 2];
+   char Query[512 + PATH_MAX * 2 + NAME_MAX];
+   char PathWithoutFileName[PATH_MAX + 1];
+   char FileName[NAME_MAX + 1];
+
+   /***** Get new name of file/folder from new path *****/
+   Str_SplitFullPathIntoPathAndFileName (NewPath,
+                                         PathWithoutFileName,FileName);
 
    /***** Update file or folder in table of common files *****/
-   sprintf (Query,"UPDATE files SET Path='%s'"
+   // Names of children are not changed, so they are not updated
+   sprintf (Query,"UPDATE files SET Path='%s',Name='%s'"
                   " WHERE FileBrowser=%u AND Cod=%ld AND ZoneUsrCod=%ld AND Path='%s'",
-            NewPath,
+            NewPath,FileName,
             (unsigned) Brw_FileBrowserForDB_files[Gbl.FileBrowser.Type],
             Cod,ZoneUsrCod,
             OldPath);
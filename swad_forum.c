@@ -280,6 +280,7 @@ static void For_InsertPstIntoBannedPstTable (long PstCod);
 static long For_InsertForumPst (long ThrCod,long UsrCod,
                                 const char *Subject,const char *Content,
                                 struct Image *Image);
+static void For_IncrementNumPstsInThr (long ThrCod);
 static bool For_RemoveForumPst (long PstCod,struct Image *Image);
 static unsigned For_NumPstsInThrWithPstCod (long PstCod,long *ThrCod);
 
@@ -290,14 +291,11 @@ static void For_GetThrSubject (long ThrCod,char Subject[Cns_MAX_BYTES_SUBJECT +
 
 static void For_UpdateThrFirstAndLastPst (long ThrCod,long FirstPstCod,long LastPstCod);
 static void For_UpdateThrLastPst (long ThrCod,long LastPstCod);
+static void For_UpdateThrLastPstAndDecrementNumPsts (long ThrCod,long LastPstCod);
 static long For_GetLastPstCod (long ThrCod);
 
 static void For_UpdateThrReadTime (long ThrCod,
                                    time_t CreatTimeUTCOfTheMostRecentPostRead);
-static unsigned For_GetNumOfReadersOfThr (long ThrCod);
-static unsigned For_GetNumOfWritersInThr (long ThrCod);
-static unsigned For_GetNumPstsInThr (long ThrCod);
-static unsigned For_GetNumMyPstInThr (long ThrCod);
 static time_t For_GetThrReadTime (long ThrCod);
 static void For_DeleteThrFromReadThrs (long ThrCod);
 static void For_ShowPostsOfAThread (Ale_AlertType_t AlertType,const char *Message);
@@ -338,12 +336,10 @@ static void For_WriteLinkToForum (struct Forum *Forum,
                                   bool Highlight,bool ShowNumOfPosts,
                                   unsigned Level,
                                   bool IsLastItemInLevel[1 + For_FORUM_MAX_LEVELS]);
-static unsigned For_GetNumThrsWithNewPstsInForum (struct Forum *Forum,
-                                                  unsigned NumThreads);
-static unsigned For_GetNumOfThreadsInForumNewerThan (struct Forum *Forum,
-                                                     const char *Time);
-static unsigned For_GetNumOfUnreadPostsInThr (long ThrCod,unsigned NumPostsInThr);
-static unsigned For_GetNumOfPostsInThrNewerThan (long ThrCod,const char *Time);
+static void For_GetNumThrsAndPstsInForum (struct Forum *Forum,
+                                          unsigned *NumThrs,
+                                          unsigned *NumThrsWithNewPosts,
+                                          unsigned *NumPosts);
 
 static void For_WriteNumThrsAndPsts (unsigned NumThrs,unsigned NumThrsWithNewPosts,unsigned NumPosts);
 static void For_WriteNumberOfThrs (unsigned NumThrs,unsigned NumThrsWithNewPosts);
@@ -351,8 +347,6 @@ static void For_ShowForumThreadsHighlightingOneThread (long ThrCodHighlighted,
                                                        Ale_AlertType_t AlertType,const char *Message);
 static void For_PutIconNewThread (void);
 static void For_PutAllHiddenParamsNewThread (void);
-static unsigned For_GetNumThrsInForum (struct Forum *Forum);
-static unsigned For_GetNumPstsInForum (struct Forum *Forum);
 static void For_ListForumThrs (long ThrCods[Pag_ITEMS_PER_PAGE],
                                long ThrCodHighlighted,
                                struct Pagination *PaginationThrs);
@@ -540,6 +534,9 @@ static long For_InsertForumPst (long ThrCod,long UsrCod,
    /***** Free space used for query *****/
    free ((void *) Query);
 
+   /***** Increment number of posts in thread *****/
+   For_IncrementNumPstsInThr (ThrCod);
+
    return PstCod;
   }
 
@@ -572,13 +569,27 @@ static bool For_RemoveForumPst (long PstCod,struct Image *Image)
    /***** Delete the post from the table of disabled forum posts *****/
    For_DeletePstFromDisabledPstTable (PstCod);
 
-   /***** Update the last post of the thread *****/
+   /***** Update the last post and the number of posts of the thread *****/
    if (!ThreadDeleted)
-      For_UpdateThrLastPst (ThrCod,For_GetLastPstCod (ThrCod));
+      For_UpdateThrLastPstAndDecrementNumPsts (ThrCod,For_GetLastPstCod (ThrCod));
 
    return ThreadDeleted;
   }
 
+/*****************************************************************************/
+/****************** Increment the number of posts in a thread ****************/
+/*****************************************************************************/
+
+static void For_IncrementNumPstsInThr (long ThrCod)
+  {
+   char Query[128];
+
+   /***** Increment number of posts in a thread *****/
+   sprintf (Query,"UPDATE forum_thread SET NumPsts=NumPsts+1 WHERE ThrCod=%ld",
+            ThrCod);
+   DB_QueryUPDATE (Query,"can not update the number of posts in a thread of a forum");
+  }
+
 /*****************************************************************************/
 /*********** Get the number of posts in the thread than holds a post *********/
 /*****************************************************************************/
@@ -591,10 +602,10 @@ static unsigned For_NumPstsInThrWithPstCod (long PstCod,long *ThrCod)
    unsigned NumPsts;
 
    /***** Get number of posts in the thread that holds a post from database *****/
-   sprintf (Query,"SELECT COUNT(PstCod),ThrCod FROM forum_post"
-                  " WHERE ThrCod IN"
-                  " (SELECT ThrCod FROM forum_post"
-                  " WHERE PstCod=%ld) GROUP BY ThrCod;",
+   sprintf (Query,"SELECT forum_thread.NumPsts,forum_thread.ThrCod"
+	          " FROM forum_post,forum_thread"
+                  " WHERE forum_post.PstCod=%ld"
+                  " AND forum_post.ThrCod=forum_thread.ThrCod",
             PstCod);
    DB_QuerySELECT (Query,&mysql_res,"can not get number of posts in a thread of a forum");
 
@@ -770,6 +781,23 @@ static void For_UpdateThrLastPst (long ThrCod,long LastPstCod)
    DB_QueryUPDATE (Query,"can not update a thread of a forum");
   }
 
+/*****************************************************************************/
+/*** Modify the last post of a thread and decrement its number of posts ******/
+/*****************************************************************************/
+
+static void For_UpdateThrLastPstAndDecrementNumPsts (long ThrCod,long LastPstCod)
+  {
+   char Query[256];
+
+   /***** Update the code of the last post of a thread
+          and decrement its number of posts *****/
+   sprintf (Query,"UPDATE forum_thread"
+	          " SET LastPstCod=%ld,NumPsts=GREATEST(NumPsts-1,0)"
+	          " WHERE ThrCod=%ld",
+            LastPstCod,ThrCod);
+   DB_QueryUPDATE (Query,"can not update a thread of a forum");
+  }
+
 /*****************************************************************************/
 /**************** Get the code of the last post of a thread ******************/
 /*****************************************************************************/
@@ -819,79 +847,6 @@ static void For_UpdateThrReadTime (long ThrCod,
    DB_QueryREPLACE (Query,"can not update the status of reading of a thread of a forum");
   }
 
-/*****************************************************************************/
-/**************** Get number of users that have read a thread ****************/
-/*****************************************************************************/
-
-static unsigned For_GetNumOfReadersOfThr (long ThrCod)
-  {
-   char Query[128];
-
-   /***** Get number of distinct readers of a thread from database *****/
-   sprintf (Query,"SELECT COUNT(*) FROM forum_thr_read WHERE ThrCod=%ld",
-            ThrCod);
-   return (unsigned) DB_QueryCOUNT (Query,"can not get the number of readers of a thread of a forum");
-  }
-
-/*****************************************************************************/
-/********** Get number of users that have write posts in a thread ************/
-/*****************************************************************************/
-
-static unsigned For_GetNumOfWritersInThr (long ThrCod)
-  {
-   char Query[256];
-   MYSQL_RES *mysql_res;
-   MYSQL_ROW row;
-   unsigned NumWriters;
-
-   /***** Get number of distinct writers in a thread from database *****/
-   sprintf (Query,"SELECT COUNT(DISTINCT UsrCod) FROM forum_post"
-                  " WHERE ThrCod=%ld",
-            ThrCod);
-   DB_QuerySELECT (Query,&mysql_res,"can not get the number of writers in a thread of a forum");
-
-   /* Get row with number of writers */
-   row = mysql_fetch_row (mysql_res);
-
-   /* Get number of writers (row[0]) */
-   if (sscanf (row[0],"%u",&NumWriters) != 1)
-      Lay_ShowErrorAndExit ("Error when getting the number of writers in a thread of a forum.");
-
-   /***** Free structure that stores the query result *****/
-   DB_FreeMySQLResult (&mysql_res);
-
-   return NumWriters;
-  }
-
-/*****************************************************************************/
-/********************** Get number of posts in a thread **********************/
-/*****************************************************************************/
-
-static unsigned For_GetNumPstsInThr (long ThrCod)
-  {
-   char Query[128];
-
-   /***** Get number of posts in a thread from database *****/
-   sprintf (Query,"SELECT COUNT(*) FROM forum_post WHERE ThrCod=%ld",
-            ThrCod);
-   return (unsigned) DB_QueryCOUNT (Query,"can not get the number of posts in a thread of a forum");
-  }
-
-/*****************************************************************************/
-/************** Get whether there are posts of mine in a thread **************/
-/*****************************************************************************/
-
-static unsigned For_GetNumMyPstInThr (long ThrCod)
-  {
-   char Query[256];
-
-   /***** Get if I have write posts in a thread from database *****/
-   sprintf (Query,"SELECT COUNT(*) FROM forum_post"
-                  " WHERE ThrCod=%ld AND UsrCod=%ld",
-            ThrCod,Gbl.Usrs.Me.UsrDat.UsrCod);
-   return (unsigned) DB_QueryCOUNT (Query,"can not check if you have written post in a thead of a forum");
-  }
-
 /*****************************************************************************/
 /*********************** Get number of posts from a user *********************/
 /*****************************************************************************/
@@ -2071,8 +2026,7 @@ static void For_WriteLinkToForum (struct Forum *Forum,
    char ForumName[For_MAX_BYTES_FORUM_NAME + 1];
 
    /***** Get number of threads and number of posts *****/
-   NumThrs = For_GetNumThrsInForum (Forum);
-   NumThrsWithNewPosts = For_GetNumThrsWithNewPstsInForum (Forum,NumThrs);
+   For_GetNumThrsAndPstsInForum (Forum,&NumThrs,&NumThrsWithNewPosts,&NumPosts);
    Style = (NumThrsWithNewPosts ? The_ClassFormBold[Gbl.Prefs.Theme] :
 	                          The_ClassForm[Gbl.Prefs.Theme]);
 
@@ -2172,7 +2126,7 @@ static void For_WriteLinkToForum (struct Forum *Forum,
    /***** Write total number of threads and posts in this forum *****/
    if (ShowNumOfPosts)
      {
-      if ((NumPosts = For_GetNumPstsInForum (Forum)))
+      if (NumPosts)
          For_WriteNumThrsAndPsts (NumThrs,NumThrsWithNewPosts,NumPosts);
      }
    else
@@ -2298,114 +2252,55 @@ void For_SetForumName (struct Forum *Forum,
   }
 
 /*****************************************************************************/
-/***** Get number of threads with new posts since my last read of a forum ****/
+/********* Get number of threads, threads with new posts and posts ***********/
 /*****************************************************************************/
+// Threads with new posts are those whose last post is newer than
+// the newest read time of mine in any thread of the forum.
+// If I have not read any thread of the forum, all the threads are new to me.
 
-static unsigned For_GetNumThrsWithNewPstsInForum (struct Forum *Forum,
-                                                  unsigned NumThreads)
+static void For_GetNumThrsAndPstsInForum (struct Forum *Forum,
+                                          unsigned *NumThrs,
+                                          unsigned *NumThrsWithNewPosts,
+                                          unsigned *NumPosts)
   {
    char SubQuery[256];
    char Query[2048];
    MYSQL_RES *mysql_res;
    MYSQL_ROW row;
-   unsigned long NumRows;
-   unsigned NumThrsWithNewPosts = NumThreads;	// By default, all the threads are new to me
-
-   /***** Get last time I read this forum from database *****/
-   if (Forum->Location > 0)
-      sprintf (SubQuery," AND forum_thread.Location=%ld",Forum->Location);
-   else
-      SubQuery[0] = '\0';
-   sprintf (Query,"SELECT MAX(forum_thr_read.ReadTime)"
-	          " FROM forum_thr_read,forum_thread"
-                  " WHERE forum_thr_read.UsrCod=%ld"
-                  " AND forum_thr_read.ThrCod=forum_thread.ThrCod"
-                  " AND forum_thread.ForumType=%u%s",
-                  Gbl.Usrs.Me.UsrDat.UsrCod,(unsigned) Forum->Type,SubQuery);
-   NumRows = DB_QuerySELECT (Query,&mysql_res,"can not get the date of reading of a forum");
 
-   if (NumRows)
-     {
-      /***** Get number of threads with a last message modify time > newest read time (row[0]) *****/
-      row = mysql_fetch_row (mysql_res);
-      NumThrsWithNewPosts = For_GetNumOfThreadsInForumNewerThan (Forum,row[0]);
-     }
-
-   /***** Free structure that stores the query result *****/
-   DB_FreeMySQLResult (&mysql_res);
-
-   return NumThrsWithNewPosts;
-  }
-
-/*****************************************************************************/
-/**** Get number of threads in forum with a modify time > a specified time ***/
-/*****************************************************************************/
-
-static unsigned For_GetNumOfThreadsInForumNewerThan (struct Forum *Forum,
-                                                     const char *Time)
-  {
-   char SubQuery[256];
-   char Query[1024];
-
-   /***** Get number of threads with a last message modify time
-          > specified time from database *****/
+   /***** Get number of threads, number of threads with new posts
+          and number of posts in a forum from database *****/
    if (Forum->Location > 0)
       sprintf (SubQuery," AND forum_thread.Location=%ld",Forum->Location);
    else
       SubQuery[0] = '\0';
-   sprintf (Query,"SELECT COUNT(*) FROM forum_thread,forum_post"
-	          " WHERE forum_thread.ForumType=%u%s"
-                  " AND forum_thread.LastPstCod=forum_post.PstCod"
-                  " AND forum_post.ModifTime>'%s'",
-                  (unsigned) Forum->Type,SubQuery,Time);
-   return (unsigned) DB_QueryCOUNT (Query,"can not check if there are new posts in a forum");
-  }
-
-/*****************************************************************************/
-/** Get number of unread posts in a thread since my last read of that thread */
-/*****************************************************************************/
-
-static unsigned For_GetNumOfUnreadPostsInThr (long ThrCod,unsigned NumPostsInThr)
-  {
-   char Query[256];
-   MYSQL_RES *mysql_res;
-   MYSQL_ROW row;
-   unsigned long NumRows;
-   unsigned NumUnreadPosts = NumPostsInThr;	// By default, all the posts are unread by me
-
-   /***** Get last time I read this thread from database *****/
-   sprintf (Query,"SELECT ReadTime FROM forum_thr_read"
-                  " WHERE ThrCod=%ld AND UsrCod=%ld",
-            ThrCod,Gbl.Usrs.Me.UsrDat.UsrCod);
-   NumRows = DB_QuerySELECT (Query,&mysql_res,"can not get the date of reading of a thread");
-
-   /***** Get if last time I read this thread exists in database *****/
-   if (NumRows)
-     {
-      /***** Get the number of posts in thread with a modify time > newest read time for me (row[0]) *****/
-      row = mysql_fetch_row (mysql_res);
-      NumUnreadPosts = For_GetNumOfPostsInThrNewerThan (ThrCod,row[0]);
-     }
+   sprintf (Query,"SELECT COUNT(*),"
+		  "SUM(R.ReadTime IS NULL OR forum_post.ModifTime>R.ReadTime),"
+		  "SUM(forum_thread.NumPsts)"
+		  " FROM (SELECT MAX(forum_thr_read.ReadTime) AS ReadTime"
+		  " FROM forum_thr_read,forum_thread"
+		  " WHERE forum_thr_read.UsrCod=%ld"
+		  " AND forum_thr_read.ThrCod=forum_thread.ThrCod"
+		  " AND forum_thread.ForumType=%u%s) AS R,"
+		  "forum_thread LEFT JOIN forum_post"
+		  " ON forum_thread.LastPstCod=forum_post.PstCod"
+		  " WHERE forum_thread.ForumType=%u%s",
+	    Gbl.Usrs.Me.UsrDat.UsrCod,(unsigned) Forum->Type,SubQuery,
+	    (unsigned) Forum->Type,SubQuery);
+   DB_QuerySELECT (Query,&mysql_res,"can not get number of threads and posts in a forum");
+
+   /***** Get numbers (row[0], row[1], row[2]) *****/
+   // SUM returns NULL when there are no threads
+   row = mysql_fetch_row (mysql_res);
+   if (sscanf (row[0],"%u",NumThrs) != 1)
+      *NumThrs = 0;
+   if (!row[1] || sscanf (row[1],"%u",NumThrsWithNewPosts) != 1)
+      *NumThrsWithNewPosts = 0;
+   if (!row[2] || sscanf (row[2],"%u",NumPosts) != 1)
+      *NumPosts = 0;
 
    /***** Free structure that stores the query result *****/
    DB_FreeMySQLResult (&mysql_res);
-
-   return NumUnreadPosts;
-  }
-
-/*****************************************************************************/
-/**** Get number of posts in thread with a modify time > a specified time ****/
-/*****************************************************************************/
-
-static unsigned For_GetNumOfPostsInThrNewerThan (long ThrCod,const char *Time)
-  {
-   char Query[256];
-
-   /***** Get the number of posts in thread with a modify time > a specified time from database *****/
-   sprintf (Query,"SELECT COUNT(*) FROM forum_post"
-                  " WHERE ThrCod=%ld AND ModifTime>'%s'",
-            ThrCod,Time);
-   return (unsigned) DB_QueryCOUNT (Query,"can not check if there are new posts in a thread of a forum");
   }
 
 /*****************************************************************************/
@@ -3019,25 +2914,6 @@ unsigned For_GetNumTotalThrsInForumsOfType (For_ForumType_t ForumType,
    return (unsigned) DB_QueryCOUNT (Query,"can not get the number of threads in forums of a type");
   }
 
-/*****************************************************************************/
-/******************* Get number of threads in a forum ************************/
-/*****************************************************************************/
-
-static unsigned For_GetNumThrsInForum (struct Forum *Forum)
-  {
-   char SubQuery[256];
-   char Query[1024];
-
-   /***** Get number of threads in a forum from database *****/
-   if (Forum->Location > 0)
-      sprintf (SubQuery," AND Location=%ld",Forum->Location);
-   else
-      SubQuery[0] = '\0';
-   sprintf (Query,"SELECT COUNT(*) FROM forum_thread WHERE ForumType=%u%s",
-            (unsigned) Forum->Type,SubQuery);
-   return (unsigned) DB_QueryCOUNT (Query,"can not get number of threads in a forum");
-  }
-
 /*****************************************************************************/
 /************** Get total number of posts in forums of a type ****************/
 /*****************************************************************************/
@@ -3245,27 +3121,6 @@ unsigned For_GetNumTotalPstsInForumsOfType (For_ForumType_t ForumType,
    return NumPosts;
   }
 
-/*****************************************************************************/
-/********************* Get number of posts in a forum ************************/
-/*****************************************************************************/
-
-static unsigned For_GetNumPstsInForum (struct Forum *Forum)
-  {
-   char SubQuery[256];
-   char Query[1024];
-
-   /***** Get number of posts in a forum from database *****/
-   if (Forum->Location > 0)
-      sprintf (SubQuery," AND forum_thread.Location=%ld",Forum->Location);
-   else
-      SubQuery[0] = '\0';
-   sprintf (Query,"SELECT COUNT(*) FROM forum_thread,forum_post "
-                  " WHERE forum_thread.ForumType=%u%s"
-                  " AND forum_thread.ThrCod=forum_post.ThrCod",
-            (unsigned) Forum->Type,SubQuery);
-   return (unsigned) DB_QueryCOUNT (Query,"can not get the number of posts in a forum");
-  }
-
 /*****************************************************************************/
 /************************ List the threads of a forum ************************/
 /*****************************************************************************/
@@ -3494,17 +3349,43 @@ static void For_GetThrData (struct ForumThread *Thr)
    MYSQL_RES *mysql_res;
    MYSQL_ROW row;
    unsigned long NumRows;
-   For_Order_t Order;
 
    /***** Get data of a thread from database *****/
+   // The number of posts is stored in the thread,
+   // the rest of numbers are got in the same query
    sprintf (Query,"SELECT m0.PstCod,m1.PstCod,m0.UsrCod,m1.UsrCod,"
                   "UNIX_TIMESTAMP(m0.CreatTime),"
                   "UNIX_TIMESTAMP(m1.CreatTime),"
-                  "m0.Subject"
-                  " FROM forum_thread,forum_post AS m0,forum_post AS m1"
-                  " WHERE forum_thread.ThrCod=%ld"
-                  " AND forum_thread.FirstPstCod=m0.PstCod"
-                  " AND forum_thread.LastPstCod=m1.PstCod",
+                  "m0.Subject,"
+                  "d0.PstCod IS NULL,"				// Is first post enabled?
+                  "d1.PstCod IS NULL,"				// Is last  post enabled?
+                  "forum_thread.NumPsts,"
+                  "IF(forum_thr_read.ReadTime IS NULL,forum_thread.NumPsts,"
+                  "(SELECT COUNT(*) FROM forum_post"
+                  " WHERE ThrCod=forum_thread.ThrCod"
+                  " AND ModifTime>forum_thr_read.ReadTime)),"	// Unread posts
+                  "(SELECT COUNT(*) FROM forum_post"
+                  " WHERE ThrCod=forum_thread.ThrCod"
+                  " AND UsrCod=%ld),"				// My posts
+                  "(SELECT COUNT(DISTINCT UsrCod) FROM forum_post"
+                  " WHERE ThrCod=forum_thread.ThrCod),"		// Writers
+                  "(SELECT COUNT(*) FROM forum_thr_read"
+                  " WHERE ThrCod=forum_thread.ThrCod)"		// Readers
+                  " FROM forum_thread"
+                  " JOIN forum_post AS m0"
+                  " ON forum_thread.FirstPstCod=m0.PstCod"
+                  " JOIN forum_post AS m1"
+                  " ON forum_thread.LastPstCod=m1.PstCod"
+                  " LEFT JOIN forum_disabled_post AS d0"
+                  " ON m0.PstCod=d0.PstCod"
+                  " LEFT JOIN forum_disabled_post AS d1"
+                  " ON m1.PstCod=d1.PstCod"
+                  " LEFT JOIN forum_thr_read"
+                  " ON forum_thread.ThrCod=forum_thr_read.ThrCod"
+                  " AND forum_thr_read.UsrCod=%ld"
+                  " WHERE forum_thread.ThrCod=%ld",
+            Gbl.Usrs.Me.UsrDat.UsrCod,
+            Gbl.Usrs.Me.UsrDat.UsrCod,
             Thr->ThrCod);
    NumRows = DB_QuerySELECT (Query,&mysql_res,"can not get data of a thread of a forum");
 
@@ -3513,12 +3394,6 @@ static void For_GetThrData (struct ForumThread *Thr)
       Lay_ShowErrorAndExit ("Error when getting data of a thread of a forum.");
    row = mysql_fetch_row (mysql_res);
 
-   /***** Get the code of the first post in this thread (row[0]) *****/
-   Thr->PstCod[For_FIRST_MSG] = Str_ConvertStrCodToLongCod (row[0]);
-
-   /***** Get the code of the last  post in this thread (row[1]) *****/
-   Thr->PstCod[For_LAST_MSG ] = Str_ConvertStrCodToLongCod (row[1]);
-
    /***** Get the code of the first message in this thread (row[0]) *****/
    if (sscanf (row[0],"%ld",&(Thr->PstCod[For_FIRST_MSG])) != 1)
       Lay_ShowErrorAndExit ("Wrong code of post.");
@@ -3545,30 +3420,32 @@ static void For_GetThrData (struct ForumThread *Thr)
    if (!Thr->Subject[0])
       sprintf (Thr->Subject,"[%s]",Txt_no_subject);
 
-   /***** Free structure that stores the query result *****/
-   DB_FreeMySQLResult (&mysql_res);
+   /***** Get if first or last message are enabled (row[7], row[8]) *****/
+   Thr->Enabled[For_FIRST_MSG] = (row[7][0] == '1');
+   Thr->Enabled[For_LAST_MSG ] = (row[8][0] == '1');
 
-   /***** Get if first or last message are enabled *****/
-   for (Order = For_FIRST_MSG;
-	Order <= For_LAST_MSG;
-	Order++)
-      Thr->Enabled[Order] = For_GetIfPstIsEnabled (Thr->PstCod[Order]);
-      // Thr->Enabled[Order] = true;
+   /***** Get number of posts in this thread (row[9]) *****/
+   if (sscanf (row[9],"%u",&(Thr->NumPosts)) != 1)
+      Thr->NumPosts = 0;
 
-   /***** Get number of posts in this thread *****/
-   Thr->NumPosts = For_GetNumPstsInThr (Thr->ThrCod);
+   /***** Get number of unread (by me) posts in this thread (row[10]) *****/
+   if (sscanf (row[10],"%u",&(Thr->NumUnreadPosts)) != 1)
+      Thr->NumUnreadPosts = 0;
 
-   /***** Get number of unread (by me) posts in this thread *****/
-   Thr->NumUnreadPosts = For_GetNumOfUnreadPostsInThr (Thr->ThrCod,Thr->NumPosts);
+   /***** Get number of posts that I have written in this thread (row[11]) *****/
+   if (sscanf (row[11],"%u",&(Thr->NumMyPosts)) != 1)
+      Thr->NumMyPosts = 0;
 
-   /***** Get number of posts that I have written in this thread *****/
-   Thr->NumMyPosts = For_GetNumMyPstInThr (Thr->ThrCod);
+   /***** Get number of users who have write posts in this thread (row[12]) *****/
+   if (sscanf (row[12],"%u",&(Thr->NumWriters)) != 1)
+      Thr->NumWriters = 0;
 
-   /***** Get number of users who have write posts in this thread *****/
-   Thr->NumWriters = For_GetNumOfWritersInThr (Thr->ThrCod);
+   /***** Get number of users who have read this thread (row[13]) *****/
+   if (sscanf (row[13],"%u",&(Thr->NumReaders)) != 1)
+      Thr->NumReaders = 0;
 
-   /***** Get number of users who have read this thread *****/
-   Thr->NumReaders = For_GetNumOfReadersOfThr (Thr->ThrCod);
+   /***** Free structure that stores the query result *****/
+   DB_FreeMySQLResult (&mysql_res);
   }
 
 /*****************************************************************************/
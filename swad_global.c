@@ -40,6 +40,8 @@
 #include "swad_exam.h"
 #include "swad_global.h"
 #include "swad_icon.h"
+#include "swad_logo.h"
+#include "swad_mark.h"
 #include "swad_parameter.h"
 #include "swad_preference.h"
 #include "swad_project.h"
@@ -85,10 +87,11 @@ void Gbl_InitializeGlobals (void)
    Rol_Role_t Role;
    Txt_Language_t Lan;
 
-   Gbl.Layout.WritingHTMLStart =
-   Gbl.Layout.HTMLStartWritten =
-   Gbl.Layout.DivsEndWritten   =
-   Gbl.Layout.HTMLEndWritten   = false;
+   Gbl.Layout.WritingHTMLStart  =
+   Gbl.Layout.HTMLStartWritten  =
+   Gbl.Layout.DivsEndWritten    =
+   Gbl.Layout.HTMLEndWritten    =
+   Gbl.Layout.HTTPHeaderPending = false;
 
    if (!setlocale (LC_ALL,"es_ES.utf8"))   // TODO: this should be internationalized!!!!!!!
       exit (1);
@@ -109,13 +112,21 @@ void Gbl_InitializeGlobals (void)
 
    Gbl.WebService.IsWebService = false;
 
+   Gbl.Job.IsWorker = false;
+   Gbl.Job.JobCod = -1L;
+   Gbl.Job.Status = Job_PENDING;
+   Gbl.Job.Progress = 0;
+
    Gbl.Params.ContentLength = 0;
    Gbl.Params.QueryString = NULL;
    Gbl.Params.List = NULL;
    Gbl.Params.GetMethod = false;
 
    Gbl.F.Out = stdout;
+   Gbl.F.Std = stdout;
    Gbl.F.Tmp = NULL;
+   Gbl.F.TmpMap = NULL;
+   Gbl.F.TmpSize = 0;
    Gbl.F.XML = NULL;
    Gbl.F.Rep = NULL;	// Report
 
@@ -148,6 +159,7 @@ void Gbl_InitializeGlobals (void)
    Gbl.Session.NumSessions = 0;
    Gbl.Session.IsOpen = false;
    Gbl.Session.HasBeenDisconnected = false;
+   Gbl.Session.Stored.Filled = false;
 
    Gbl.Usrs.Me.UsrIdLogin[0] = '\0';
    Gbl.Usrs.Me.LoginPlainPassword[0] = '\0';
@@ -193,6 +205,8 @@ void Gbl_InitializeGlobals (void)
      {
       Gbl.Usrs.LstUsrs[Role].Lst = NULL;
       Gbl.Usrs.LstUsrs[Role].NumUsrs = 0;
+      Gbl.Usrs.LstUsrs[Role].IDs = NULL;
+      Gbl.Usrs.LstUsrs[Role].NumIDs = 0;
       Gbl.Usrs.Select[Role] = NULL;
      }
    Gbl.Usrs.ListOtherRecipients = NULL;
@@ -396,6 +410,7 @@ void Gbl_InitializeGlobals (void)
    /* Statistics */
    Gbl.Stat.ClicksGroupedBy = Sta_CLICKS_GROUPED_BY_DEFAULT;
    Gbl.Stat.CountType       = Sta_COUNT_TYPE_DEFAULT;
+   Gbl.Stat.ExactOrApproximate = Sta_EXACT_OR_APPROXIMATE_DEFAULT;
    Gbl.Stat.Role            = Sta_ROLE_DEFAULT;
    Gbl.Stat.NumAction       = Sta_NUM_ACTION_DEFAULT;
    Gbl.Stat.RowsPerPage     = Sta_DEF_ROWS_PER_PAGE;
@@ -487,6 +502,7 @@ void Gbl_Cleanup (void)
 
    if (!Gbl.Action.UsesAJAX &&
        !Gbl.WebService.IsWebService &&
+       !Gbl.Job.IsWorker &&
        Act_GetBrowserTab (Gbl.Action.Act) == Act_BRW_1ST_TAB)
       Ses_RemoveHiddenParFromThisSession ();
    Usr_FreeMyCourses ();
@@ -510,6 +526,8 @@ void Gbl_Cleanup (void)
    Hld_FreeListHolidays ();
    Lnk_FreeListLinks ();
    Plg_FreeListPlugins ();
+   Log_FreeLogoCache ();
+   Mrk_FreeIndexOfMarks ();
 
    for (Role = (Rol_Role_t) 0;
 	Role < Rol_NUM_ROLES;
@@ -522,8 +540,7 @@ void Gbl_Cleanup (void)
    Tst_FreeTagsList ();
    Exa_FreeMemExamAnnouncement ();
    Exa_FreeListExamAnnouncements ();
-   if (Gbl.F.Tmp)
-      fclose (Gbl.F.Tmp);
+   Fil_CloseTmpFile ();
    Fil_CloseXMLFile ();
    Fil_CloseReportFile ();
    Par_FreeParams ();
@@ -56,6 +56,7 @@
 #include "swad_icon.h"
 #include "swad_indicator.h"
 #include "swad_institution.h"
+#include "swad_job.h"
 #include "swad_layout.h"
 #include "swad_link.h"
 #include "swad_mail.h"
@@ -135,6 +136,7 @@ struct Globals
       bool HTMLStartWritten;	// Used to avoid writing more than once the HTML head
       bool DivsEndWritten;	// Used to avoid writing more than once the HTML end
       bool HTMLEndWritten;	// Used to avoid writing more than once the HTML end
+      bool HTTPHeaderPending;	// End of HTTP header not written yet, because content encoding is decided when page is sent
       unsigned NestedBox;
      } Layout;
    struct
@@ -175,6 +177,23 @@ struct Globals
       bool HasBeenDisconnected;
       char Id[Ses_BYTES_SESSION_ID + 1];
       long UsrCod;
+      char MFUClicks[Ses_MAX_BYTES_MFU_CLICKS + 1];	// Clicks not yet added to most frequently used actions
+      struct
+        {
+         bool Filled;			// Data below have been got from database?
+         long UsrCod;
+         char Password[Pwd_BYTES_ENCRYPTED_PASSWORD + 1];
+         Rol_Role_t Role;
+         long CtyCod;
+         long InsCod;
+         long CtrCod;
+         long DegCod;
+         long CrsCod;
+         time_t SecondsSinceLastTime;
+         time_t SecondsSinceLastRefresh;
+         unsigned NumHiddenParams;
+         char MFUClicks[Ses_MAX_BYTES_MFU_CLICKS + 1];
+        } Stored;	// Session as it is stored in database, used to avoid unnecessary updates
      } Session;
 
    struct
@@ -195,6 +214,8 @@ struct Globals
    struct
      {
       char FileName[PATH_MAX + 1];
+      unsigned long PageBytes;	// Size of the page before compressing it
+      unsigned long SentBytes;	// Bytes sent to the client (compressed or not)
      } HTMLOutput;
    struct
      {
@@ -288,6 +309,13 @@ struct Globals
       long PlgCod;
       Svc_Function_t Function;
      } WebService;
+   struct
+     {
+      bool IsWorker;		// Is this process a worker executing a job in background?
+      long JobCod;		// Job being executed or displayed
+      Job_Status_t Status;
+      unsigned Progress;	// Percentage of the job already done
+     } Job;
    struct
      {
       struct
@@ -749,6 +777,7 @@ struct Globals
       Sta_FigureType_t FigureType;
       Sta_Role_t Role;
       Sta_CountType_t CountType;
+      Sta_ExactOrApproximate_t ExactOrApproximate;
       Act_Action_t NumAction;
       unsigned long FirstRow;
       unsigned long LastRow;
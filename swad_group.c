@@ -96,6 +96,9 @@ static void Grp_PutCheckboxAllGrps (Grp_WhichGroups_t GroupsSelectableByStdsOrNE
 
 static void Grp_ConstructorListGrpAlreadySelec (struct ListGrpsAlreadySelec **AlreadyExistsGroupOfType);
 static void Grp_DestructorListGrpAlreadySelec (struct ListGrpsAlreadySelec **AlreadyExistsGroupOfType);
+static void Grp_ShowAlertsUsrsChangedInGrp (MYSQL_RES *mysql_res,unsigned long NumRows,
+                                            const char *TxtFormat,
+                                            const char *GrpTypName,const char *GrpName);
 static void Grp_RemoveUsrFromGroup (long UsrCod,long GrpCod);
 static void Grp_AddUsrToGroup (struct UsrData *UsrDat,long GrpCod);
 
@@ -1048,79 +1051,158 @@ static void Grp_DestructorListGrpAlreadySelec (struct ListGrpsAlreadySelec **Alr
   }
 
 /*****************************************************************************/
-/******************* Register user in the groups of a list *******************/
+/************ Register several users in the groups of a list *****************/
 /*****************************************************************************/
+// UsrCodsList is a list of users' codes separated by commas
+// For each selected group, all the users are registered with a few queries,
+// instead of getting and changing the groups of each user
 
-void Grp_RegisterUsrIntoGroups (struct UsrData *UsrDat,struct ListCodGrps *LstGrps)
+void Grp_RegisterUsrsIntoGroups (const char *UsrCodsList,struct ListCodGrps *LstGrps)
   {
    extern const char *Txt_THE_USER_X_has_been_removed_from_the_group_of_type_Y_to_which_it_belonged;
    extern const char *Txt_THE_USER_X_has_been_enroled_in_the_group_of_type_Y_Z;
-   struct ListCodGrps LstGrpsHeBelongs;
+   char *Query;
+   MYSQL_RES *mysql_res;
+   unsigned long NumRows;
    unsigned NumGrpTyp;
    unsigned NumGrpSel;
    unsigned NumGrpThisType;
-   unsigned NumGrpHeBelongs;
-   bool MultipleEnrolment;
-   bool AlreadyRegisteredInGrp;
+   long GrpTypCod;
+   long GrpCod;
+   const char *GrpTypName;
+   const char *GrpName;
+
+   /***** Allocate space for query *****/
+   if ((Query = (char *) malloc (1024 + strlen (UsrCodsList))) == NULL)
+      Lay_ShowErrorAndExit ("Not enough memory to store database query.");
 
    /***** For each existing type of group in the course... *****/
    for (NumGrpTyp = 0;
 	NumGrpTyp < Gbl.CurrentCrs.Grps.GrpTypes.Num;
 	NumGrpTyp++)
      {
-      MultipleEnrolment = Gbl.CurrentCrs.Grps.GrpTypes.LstGrpTypes[NumGrpTyp].MultipleEnrolment;
-
-      /***** Query in the database the group codes of any group of this type the student belongs to *****/
-      LstGrpsHeBelongs.NumGrps = 0;	// Initialized to avoid bug reported by Coverity
-      LstGrpsHeBelongs.GrpCods = NULL;	// Initialized to avoid bug reported by Coverity
-      Grp_GetLstCodGrpsUsrBelongs (Gbl.CurrentCrs.Crs.CrsCod,Gbl.CurrentCrs.Grps.GrpTypes.LstGrpTypes[NumGrpTyp].GrpTypCod,
-	                           UsrDat->UsrCod,&LstGrpsHeBelongs);
+      GrpTypCod  = Gbl.CurrentCrs.Grps.GrpTypes.LstGrpTypes[NumGrpTyp].GrpTypCod;
+      GrpTypName = Gbl.CurrentCrs.Grps.GrpTypes.LstGrpTypes[NumGrpTyp].GrpTypName;
 
       /***** For each group selected by me... *****/
       for (NumGrpSel = 0;
 	   NumGrpSel < LstGrps->NumGrps;
 	   NumGrpSel++)
         {
+	 GrpCod = LstGrps->GrpCods[NumGrpSel];
+
          /* Check if the selected group is of this type */
          for (NumGrpThisType = 0;
               NumGrpThisType < Gbl.CurrentCrs.Grps.GrpTypes.LstGrpTypes[NumGrpTyp].NumGrps;
               NumGrpThisType++)
-            if (LstGrps->GrpCods[NumGrpSel] == Gbl.CurrentCrs.Grps.GrpTypes.LstGrpTypes[NumGrpTyp].LstGrps[NumGrpThisType].GrpCod)
+            if (GrpCod == Gbl.CurrentCrs.Grps.GrpTypes.LstGrpTypes[NumGrpTyp].LstGrps[NumGrpThisType].GrpCod)
               {	// The selected group is of this type
-               AlreadyRegisteredInGrp = false;
-
-               /* For each group of this type to which the user belongs... */
-               for (NumGrpHeBelongs = 0;
-        	    NumGrpHeBelongs < LstGrpsHeBelongs.NumGrps;
-        	    NumGrpHeBelongs++)
-                  if (LstGrps->GrpCods[NumGrpSel] == LstGrpsHeBelongs.GrpCods[NumGrpHeBelongs])
-                     AlreadyRegisteredInGrp = true;
-                  else if (!MultipleEnrolment)	// If the type of group is of single enrolment
-                    {
-                     /* If the enrolment is single and the group to which the user belongs is different from the selected ==>
-                        remove user from the group to which he belongs */
-                     Grp_RemoveUsrFromGroup (UsrDat->UsrCod,LstGrpsHeBelongs.GrpCods[NumGrpHeBelongs]);
-                     sprintf (Gbl.Alert.Txt,Txt_THE_USER_X_has_been_removed_from_the_group_of_type_Y_to_which_it_belonged,
-			      UsrDat->FullName,Gbl.CurrentCrs.Grps.GrpTypes.LstGrpTypes[NumGrpTyp].GrpTypName);
-                     Ale_ShowAlert (Ale_SUCCESS,Gbl.Alert.Txt);
-                    }
-
-               if (!AlreadyRegisteredInGrp)	// If the user does not belong to the selected group
-                 {
-                  Grp_AddUsrToGroup (UsrDat,LstGrps->GrpCods[NumGrpSel]);
-                  sprintf (Gbl.Alert.Txt,Txt_THE_USER_X_has_been_enroled_in_the_group_of_type_Y_Z,
-		           UsrDat->FullName,Gbl.CurrentCrs.Grps.GrpTypes.LstGrpTypes[NumGrpTyp].GrpTypName,
-                           Gbl.CurrentCrs.Grps.GrpTypes.LstGrpTypes[NumGrpTyp].LstGrps[NumGrpThisType].GrpName);
-                  Ale_ShowAlert (Ale_SUCCESS,Gbl.Alert.Txt);
-                 }
+               GrpName = Gbl.CurrentCrs.Grps.GrpTypes.LstGrpTypes[NumGrpTyp].LstGrps[NumGrpThisType].GrpName;
+
+               if (!Gbl.CurrentCrs.Grps.GrpTypes.LstGrpTypes[NumGrpTyp].MultipleEnrolment)
+        	 {
+        	  /* If the type of group is of single enrolment ==>
+        	     remove users from the other groups of this type */
+		  sprintf (Query,"SELECT usr_data.FirstName,usr_data.Surname1,usr_data.Surname2"
+				 " FROM crs_grp_usr,crs_grp,usr_data"
+				 " WHERE crs_grp_usr.UsrCod IN (%s)"
+				 " AND crs_grp_usr.GrpCod=crs_grp.GrpCod"
+				 " AND crs_grp.GrpTypCod=%ld AND crs_grp.GrpCod<>%ld"
+				 " AND crs_grp_usr.UsrCod=usr_data.UsrCod",
+			   UsrCodsList,GrpTypCod,GrpCod);
+		  NumRows = DB_QuerySELECT (Query,&mysql_res,"can not get users to be removed from groups");
+
+		  sprintf (Query,"DELETE FROM crs_grp_usr"
+				 " WHERE UsrCod IN (%s)"
+				 " AND GrpCod IN"
+				 " (SELECT GrpCod FROM crs_grp"
+				 " WHERE GrpTypCod=%ld AND GrpCod<>%ld)",
+			   UsrCodsList,GrpTypCod,GrpCod);
+		  DB_QueryDELETE (Query,"can not remove users from groups");
+
+		  Grp_ShowAlertsUsrsChangedInGrp (mysql_res,NumRows,
+		                                  Txt_THE_USER_X_has_been_removed_from_the_group_of_type_Y_to_which_it_belonged,
+		                                  GrpTypName,GrpName);
+		  DB_FreeMySQLResult (&mysql_res);
+        	 }
+
+               /* Register in the selected group the users who do not belong to it */
+	       sprintf (Query,"SELECT FirstName,Surname1,Surname2 FROM usr_data"
+			      " WHERE UsrCod IN (%s)"
+			      " AND UsrCod NOT IN"
+			      " (SELECT UsrCod FROM crs_grp_usr WHERE GrpCod=%ld)",
+			UsrCodsList,GrpCod);
+	       NumRows = DB_QuerySELECT (Query,&mysql_res,"can not get users to be added to a group");
+
+	       sprintf (Query,"INSERT IGNORE INTO crs_grp_usr"
+			      " (GrpCod,UsrCod)"
+			      " SELECT %ld,UsrCod FROM usr_data"
+			      " WHERE UsrCod IN (%s)",
+			GrpCod,UsrCodsList);
+	       DB_QueryINSERT (Query,"can not add users to a group");
+
+	       Grp_ShowAlertsUsrsChangedInGrp (mysql_res,NumRows,
+					       Txt_THE_USER_X_has_been_enroled_in_the_group_of_type_Y_Z,
+					       GrpTypName,GrpName);
+	       DB_FreeMySQLResult (&mysql_res);
 
                break;	// Once we know the type of a selected group, it's not necessary to check the rest of types
               }
         }
+     }
 
-      /***** Free the list of groups of this type to which the user belonged *****/
-      Grp_FreeListCodGrp (&LstGrpsHeBelongs);
+   /***** Free space used for query *****/
+   free ((void *) Query);
+
+   /***** Flush caches *****/
+   Grp_FlushCacheUsrSharesAnyOfMyGrpsInCurrentCrs ();
+   Grp_FlushCacheIBelongToGrp ();
+  }
+
+/*****************************************************************************/
+/*************** Show an alert for each user changed in a group **************/
+/*****************************************************************************/
+// Each row of mysql_res holds FirstName, Surname1 and Surname2 of a user.
+// TxtFormat gets the user's name, the type of group and the group name
+// (the last argument is ignored if TxtFormat does not include it)
+
+static void Grp_ShowAlertsUsrsChangedInGrp (MYSQL_RES *mysql_res,unsigned long NumRows,
+                                            const char *TxtFormat,
+                                            const char *GrpTypName,const char *GrpName)
+  {
+   struct UsrData UsrDat;
+   MYSQL_ROW row;
+   unsigned long NumRow;
+
+   /***** Initialize structure with user's data *****/
+   Usr_UsrDataConstructor (&UsrDat);
+
+   /***** Show an alert for each user *****/
+   for (NumRow = 0;
+	NumRow < NumRows;
+	NumRow++)
+     {
+      row = mysql_fetch_row (mysql_res);
+
+      /* Get user's name (row[0], row[1], row[2]) */
+      Str_Copy (UsrDat.FirstName,row[0],
+		Usr_MAX_BYTES_FIRSTNAME_OR_SURNAME);
+      Str_Copy (UsrDat.Surname1,row[1],
+		Usr_MAX_BYTES_FIRSTNAME_OR_SURNAME);
+      Str_Copy (UsrDat.Surname2,row[2],
+		Usr_MAX_BYTES_FIRSTNAME_OR_SURNAME);
+      Str_ConvertToTitleType (UsrDat.FirstName);
+      Str_ConvertToTitleType (UsrDat.Surname1 );
+      Str_ConvertToTitleType (UsrDat.Surname2 );
+      Usr_BuildFullName (&UsrDat);
+
+      sprintf (Gbl.Alert.Txt,TxtFormat,
+	       UsrDat.FullName,GrpTypName,GrpName);
+      Ale_ShowAlert (Ale_SUCCESS,Gbl.Alert.Txt);
      }
+
+   /***** Free memory used for user's data *****/
+   Usr_UsrDataDestructor (&UsrDat);
   }
 
 /*****************************************************************************/
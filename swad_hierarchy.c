@@ -29,6 +29,7 @@
 #include <string.h>		// For string functions
 
 #include "swad_config.h"
+#include "swad_database.h"
 #include "swad_degree.h"
 #include "swad_global.h"
 #include "swad_logo.h"
@@ -53,10 +54,17 @@ extern struct Globals Gbl;
 /**************************** Private constants ******************************/
 /*****************************************************************************/
 
+#define Hie_MAX_BYTES_QUERY_FIELDS	(1024 - 1)
+#define Hie_MAX_BYTES_QUERY_TABLES	( 128 - 1)
+#define Hie_MAX_BYTES_QUERY_JOINS	( 512 - 1)
+
 /*****************************************************************************/
 /**************************** Private prototypes *****************************/
 /*****************************************************************************/
 
+static bool Hie_GetDataOfHierarchyInOneQuery (void);
+static void Hie_GetDataOfHierarchyOneByOne (void);
+
 /*****************************************************************************/
 /********** List pending institutions, centres, degrees and courses **********/
 /*****************************************************************************/
@@ -452,6 +460,204 @@ void Hie_WriteBigNameCtyInsCtrDegCrs (void)
 /*****************************************************************************/
 
 void Hie_InitHierarchy (void)
+  {
+   /***** Get data of current course, degree, centre, institution and country.
+          Usually all of them can be got in only one query;
+          if any of them is not found, get them one by one *****/
+   if (!Hie_GetDataOfHierarchyInOneQuery ())
+      Hie_GetDataOfHierarchyOneByOne ();
+
+   /***** Initialize default fields for edition to current values *****/
+   Gbl.Inss.EditingIns.CtyCod    = Gbl.CurrentCty.Cty.CtyCod;
+   Gbl.Ctrs.EditingCtr.InsCod    =
+   Gbl.Dpts.EditingDpt.InsCod    = Gbl.CurrentIns.Ins.InsCod;
+   Gbl.Degs.EditingDeg.CtrCod    = Gbl.CurrentCtr.Ctr.CtrCod;
+   Gbl.Degs.EditingDeg.DegTypCod = Gbl.CurrentDegTyp.DegTyp.DegTypCod;
+
+   /***** Initialize paths *****/
+   if (Gbl.CurrentCrs.Crs.CrsCod > 0)
+     {
+      /***** Paths of course directories *****/
+      sprintf (Gbl.CurrentCrs.PathPriv,"%s/%s/%ld",
+	       Cfg_PATH_SWAD_PRIVATE,Cfg_FOLDER_CRS,Gbl.CurrentCrs.Crs.CrsCod);
+      sprintf (Gbl.CurrentCrs.PathRelPubl,"%s/%s/%ld",
+	       Cfg_PATH_SWAD_PUBLIC ,Cfg_FOLDER_CRS,Gbl.CurrentCrs.Crs.CrsCod);
+      sprintf (Gbl.CurrentCrs.PathURLPubl,"%s/%s/%ld",
+	       Cfg_URL_SWAD_PUBLIC,Cfg_FOLDER_CRS,Gbl.CurrentCrs.Crs.CrsCod);
+
+      /***** If any of the course directories does not exist, create it *****/
+      if (!Fil_CheckIfPathExists (Gbl.CurrentCrs.PathPriv))
+	 Fil_CreateDirIfNotExists (Gbl.CurrentCrs.PathPriv);
+      if (!Fil_CheckIfPathExists (Gbl.CurrentCrs.PathRelPubl))
+	 Fil_CreateDirIfNotExists (Gbl.CurrentCrs.PathRelPubl);
+
+      /***** Count number of groups in current course
+             (used in some actions) *****/
+      Gbl.CurrentCrs.Grps.NumGrps = Grp_CountNumGrpsInCurrentCrs ();
+     }
+  }
+
+/*****************************************************************************/
+/******** Get data of current course, degree, centre, institution and ********/
+/******** country in only one query joining all the levels            ********/
+/*****************************************************************************/
+// Return true if all the levels from the lowest one available up to country
+// have been found
+
+static bool Hie_GetDataOfHierarchyInOneQuery (void)
+  {
+   extern const char *Txt_STR_LANG_ID[1 + Txt_NUM_LANGUAGES];
+   char Fields[Hie_MAX_BYTES_QUERY_FIELDS + 1];
+   char Tables[Hie_MAX_BYTES_QUERY_TABLES + 1];
+   char Joins[Hie_MAX_BYTES_QUERY_JOINS + 1];
+   char Query[2048];
+   MYSQL_RES *mysql_res;
+   MYSQL_ROW row;
+   unsigned long NumRows;
+   Sco_Scope_t Scope;
+
+   /***** Get the lowest level available *****/
+   if (Gbl.CurrentCrs.Crs.CrsCod > 0)
+     {
+      Scope = Sco_SCOPE_CRS;
+      sprintf (Joins,"courses.CrsCod=%ld",Gbl.CurrentCrs.Crs.CrsCod);
+     }
+   else if (Gbl.CurrentDeg.Deg.DegCod > 0)
+     {
+      Scope = Sco_SCOPE_DEG;
+      sprintf (Joins,"degrees.DegCod=%ld",Gbl.CurrentDeg.Deg.DegCod);
+     }
+   else if (Gbl.CurrentCtr.Ctr.CtrCod > 0)
+     {
+      Scope = Sco_SCOPE_CTR;
+      sprintf (Joins,"centres.CtrCod=%ld",Gbl.CurrentCtr.Ctr.CtrCod);
+     }
+   else if (Gbl.CurrentIns.Ins.InsCod > 0)
+     {
+      Scope = Sco_SCOPE_INS;
+      sprintf (Joins,"institutions.InsCod=%ld",Gbl.CurrentIns.Ins.InsCod);
+     }
+   else	// Only country (or nothing) is available ==> nothing to join
+      return false;
+
+   /***** Build query joining levels from the lowest one up to country *****/
+   Fields[0] = '\0';
+   Tables[0] = '\0';
+   if (Scope >= Sco_SCOPE_CRS)
+     {
+      Str_Concat (Fields,"courses.CrsCod,courses.DegCod,courses.Year,"
+	                 "courses.InsCrsCod,courses.Status,"
+	                 "courses.RequesterUsrCod,"
+	                 "courses.ShortName,courses.FullName,",
+	          Hie_MAX_BYTES_QUERY_FIELDS);
+      Str_Concat (Tables,"courses,",
+	          Hie_MAX_BYTES_QUERY_TABLES);
+      Str_Concat (Joins," AND courses.DegCod=degrees.DegCod",
+	          Hie_MAX_BYTES_QUERY_JOINS);
+     }
+   if (Scope >= Sco_SCOPE_DEG)
+     {
+      Str_Concat (Fields,"degrees.DegCod,degrees.CtrCod,degrees.DegTypCod,"
+	                 "degrees.Status,degrees.RequesterUsrCod,"
+	                 "degrees.ShortName,degrees.FullName,degrees.WWW,"
+	                 "deg_types.DegTypName,",
+	          Hie_MAX_BYTES_QUERY_FIELDS);
+      Str_Concat (Tables,"degrees,deg_types,",
+	          Hie_MAX_BYTES_QUERY_TABLES);
+      Str_Concat (Joins," AND degrees.DegTypCod=deg_types.DegTypCod"
+	                " AND degrees.CtrCod=centres.CtrCod",
+	          Hie_MAX_BYTES_QUERY_JOINS);
+     }
+   if (Scope >= Sco_SCOPE_CTR)
+     {
+      Str_Concat (Fields,"centres.InsCod,centres.PlcCod,"
+	                 "centres.Status,centres.RequesterUsrCod,"
+	                 "centres.ShortName,centres.FullName,centres.WWW,",
+	          Hie_MAX_BYTES_QUERY_FIELDS);
+      Str_Concat (Tables,"centres,",
+	          Hie_MAX_BYTES_QUERY_TABLES);
+      Str_Concat (Joins," AND centres.InsCod=institutions.InsCod",
+	          Hie_MAX_BYTES_QUERY_JOINS);
+     }
+   Str_Concat (Fields,"institutions.CtyCod,institutions.Status,"
+		      "institutions.RequesterUsrCod,"
+		      "institutions.ShortName,institutions.FullName,"
+		      "institutions.WWW,",
+	       Hie_MAX_BYTES_QUERY_FIELDS);
+   Str_Concat (Tables,"institutions,countries",
+	       Hie_MAX_BYTES_QUERY_TABLES);
+   Str_Concat (Joins," AND institutions.CtyCod=countries.CtyCod",
+	       Hie_MAX_BYTES_QUERY_JOINS);
+
+   sprintf (Query,"SELECT %s"
+	          "countries.Alpha2,countries.Name_%s,countries.WWW_%s"
+	          " FROM %s"
+	          " WHERE %s",
+	    Fields,
+	    Txt_STR_LANG_ID[Gbl.Prefs.Language],
+	    Txt_STR_LANG_ID[Gbl.Prefs.Language],
+	    Tables,
+	    Joins);
+   NumRows = DB_QuerySELECT (Query,&mysql_res,"can not get data of hierarchy");
+
+   if (NumRows == 1)
+     {
+      row = mysql_fetch_row (mysql_res);
+
+      /***** Get data of course (row[0]...row[7]) *****/
+      if (Scope >= Sco_SCOPE_CRS)
+	{
+	 Crs_GetDataOfCourseFromRow (&Gbl.CurrentCrs.Crs,row);
+	 Gbl.CurrentDeg.Deg.DegCod = Gbl.CurrentCrs.Crs.DegCod;
+	 row += 8;
+	}
+
+      /***** Get data of degree (row[0]...row[7])
+             and name of degree type (row[8]) *****/
+      if (Scope >= Sco_SCOPE_DEG)
+	{
+	 Deg_GetDataOfDegreeFromRow (&Gbl.CurrentDeg.Deg,row);
+	 Gbl.CurrentCtr.Ctr.CtrCod          = Gbl.CurrentDeg.Deg.CtrCod;
+	 Gbl.CurrentDegTyp.DegTyp.DegTypCod = Gbl.CurrentDeg.Deg.DegTypCod;
+	 Str_Copy (Gbl.CurrentDegTyp.DegTyp.DegTypName,row[8],
+		   Deg_MAX_BYTES_DEGREE_TYPE_NAME);
+	 row += 9;
+	}
+
+      /***** Get data of centre (row[0]...row[6]) *****/
+      if (Scope >= Sco_SCOPE_CTR)
+	{
+	 Ctr_GetBasicDataOfCentreFromRow (&Gbl.CurrentCtr.Ctr,row);
+	 Gbl.CurrentIns.Ins.InsCod = Gbl.CurrentCtr.Ctr.InsCod;
+	 row += 7;
+	}
+
+      /***** Get data of institution (row[0]...row[5]) *****/
+      Ins_GetBasicDataOfInstitutionFromRow (&Gbl.CurrentIns.Ins,row);
+      Gbl.CurrentCty.Cty.CtyCod = Gbl.CurrentIns.Ins.CtyCod;
+      row += 6;
+
+      /***** Get Alpha-2, name and WWW of country (row[0]...row[2]) *****/
+      Str_Copy (Gbl.CurrentCty.Cty.Alpha2,row[0],
+		2);
+      Str_Copy (Gbl.CurrentCty.Cty.Name[Gbl.Prefs.Language],row[1],
+		Cty_MAX_BYTES_NAME);
+      Str_Copy (Gbl.CurrentCty.Cty.WWW[Gbl.Prefs.Language],row[2],
+		Cns_MAX_BYTES_WWW);
+     }
+
+   /***** Free structure that stores the query result *****/
+   DB_FreeMySQLResult (&mysql_res);
+
+   return (NumRows == 1);
+  }
+
+/*****************************************************************************/
+/******** Get data of current course, degree, centre, institution and ********/
+/******** country one by one, starting with the lowest level available *******/
+/*****************************************************************************/
+
+static void Hie_GetDataOfHierarchyOneByOne (void)
   {
    /***** If course code is available, get course data *****/
    if (Gbl.CurrentCrs.Crs.CrsCod > 0)
@@ -531,33 +737,4 @@ void Hie_InitHierarchy (void)
          Gbl.CurrentCrs.Crs.CrsCod = -1L;
         }
      }
-
-   /***** Initialize default fields for edition to current values *****/
-   Gbl.Inss.EditingIns.CtyCod    = Gbl.CurrentCty.Cty.CtyCod;
-   Gbl.Ctrs.EditingCtr.InsCod    =
-   Gbl.Dpts.EditingDpt.InsCod    = Gbl.CurrentIns.Ins.InsCod;
-   Gbl.Degs.EditingDeg.CtrCod    = Gbl.CurrentCtr.Ctr.CtrCod;
-   Gbl.Degs.EditingDeg.DegTypCod = Gbl.CurrentDegTyp.DegTyp.DegTypCod;
-
-   /***** Initialize paths *****/
-   if (Gbl.CurrentCrs.Crs.CrsCod > 0)
-     {
-      /***** Paths of course directories *****/
-      sprintf (Gbl.CurrentCrs.PathPriv,"%s/%s/%ld",
-	       Cfg_PATH_SWAD_PRIVATE,Cfg_FOLDER_CRS,Gbl.CurrentCrs.Crs.CrsCod);
-      sprintf (Gbl.CurrentCrs.PathRelPubl,"%s/%s/%ld",
-	       Cfg_PATH_SWAD_PUBLIC ,Cfg_FOLDER_CRS,Gbl.CurrentCrs.Crs.CrsCod);
-      sprintf (Gbl.CurrentCrs.PathURLPubl,"%s/%s/%ld",
-	       Cfg_URL_SWAD_PUBLIC,Cfg_FOLDER_CRS,Gbl.CurrentCrs.Crs.CrsCod);
-
-      /***** If any of the course directories does not exist, create it *****/
-      if (!Fil_CheckIfPathExists (Gbl.CurrentCrs.PathPriv))
-	 Fil_CreateDirIfNotExists (Gbl.CurrentCrs.PathPriv);
-      if (!Fil_CheckIfPathExists (Gbl.CurrentCrs.PathRelPubl))
-	 Fil_CreateDirIfNotExists (Gbl.CurrentCrs.PathRelPubl);
-
-      /***** Count number of groups in current course
-             (used in some actions) *****/
-      Gbl.CurrentCrs.Grps.NumGrps = Grp_CountNumGrpsInCurrentCrs ();
-     }
   }
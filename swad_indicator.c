@@ -27,6 +27,8 @@
 
 #include <linux/stddef.h>	// For NULL
 #include <stdio.h>		// For fprintf
+#include <stdlib.h>		// For calloc, free, qsort, bsearch
+#include <string.h>		// For strlen
 #include <mysql/mysql.h>	// To access MySQL databases
 
 #include "swad_action.h"
@@ -48,6 +50,8 @@ extern struct Globals Gbl;
 /*************************** Internal constants ******************************/
 /*****************************************************************************/
 
+#define Ind_MAX_BYTES_CRS_COD_IN_LIST (1 + 10)	// Comma and course code
+
 /*****************************************************************************/
 /******************************* Internal types ******************************/
 /*****************************************************************************/
@@ -58,6 +62,16 @@ typedef enum
    Ind_INDICATORS_FULL,
   } Ind_IndicatorsLayout_t;
 
+typedef enum
+  {
+   Ind_NUM_FILES_IN_DOCUM_ZONES,
+   Ind_NUM_FILES_IN_SHARE_ZONES,
+   Ind_NUM_FILES_IN_ASSIG_ZONES,
+   Ind_NUM_FILES_IN_WORKS_ZONES,
+   Ind_NUM_ASSIGNMENTS,
+   Ind_NUM_MSGS_SENT_BY_TCHS,
+  } Ind_NumberCrs_t;
+
 /*****************************************************************************/
 /***************************** Internal prototypes ***************************/
 /*****************************************************************************/
@@ -70,17 +84,45 @@ static void Ind_PutButtonToConfirmIWantToSeeBigList (unsigned NumCrss);
 static void Ind_PutParamsConfirmIWantToSeeBigList (void);
 
 static void Ind_GetNumCoursesWithIndicators (unsigned NumCrssWithIndicatorYes[1 + Ind_NUM_INDICATORS],
-                                             unsigned NumCrss,MYSQL_RES *mysql_res);
+                                             unsigned NumCrss,
+                                             const struct Ind_IndicatorsCrs *IndicatorsCrss);
 static void Ind_ShowNumCoursesWithIndicators (unsigned NumCrssWithIndicatorYes[1 + Ind_NUM_INDICATORS],
                                               unsigned NumCrss,bool PutForm);
 static void Ind_ShowTableOfCoursesWithIndicators (Ind_IndicatorsLayout_t IndicatorsLayout,
-                                                  unsigned NumCrss,MYSQL_RES *mysql_res);
-static unsigned Ind_GetAndUpdateNumIndicatorsCrs (long CrsCod);
+                                                  unsigned NumCrss,MYSQL_RES *mysql_res,
+                                                  struct Ind_IndicatorsCrs *IndicatorsCrss);
+
+static struct Ind_IndicatorsCrs *Ind_ComputeAndStoreIndicatorsCrss (unsigned NumCrss,MYSQL_RES *mysql_res);
+static void Ind_ComputeIndicatorsCrss (unsigned NumCrss,
+                                       struct Ind_IndicatorsCrs *IndicatorsCrss);
+static int Ind_CompareCrsCods (const void *p1,const void *p2);
+static struct Ind_IndicatorsCrs *Ind_GetIndicatorsOfCrs (long CrsCod,unsigned NumCrss,
+                                                        struct Ind_IndicatorsCrs *IndicatorsCrss);
+static char *Ind_BuildListOfCrsCods (unsigned NumCrss,
+                                     const struct Ind_IndicatorsCrs *IndicatorsCrss);
+static void Ind_GetNumIndicatorsCrssFromDB (const char *CrsCodsList,
+                                            unsigned NumCrss,
+                                            struct Ind_IndicatorsCrs *IndicatorsCrss);
+static void Ind_StoreNumIndicatorsCrssIntoDB (unsigned NumCrss,
+                                              const struct Ind_IndicatorsCrs *IndicatorsCrss);
 static void Ind_StoreIndicatorsCrsIntoDB (long CrsCod,unsigned NumIndicators);
-static unsigned long Ind_GetNumFilesInDocumZonesOfCrsFromDB (long CrsCod);
-static unsigned long Ind_GetNumFilesInShareZonesOfCrsFromDB (long CrsCod);
-static unsigned long Ind_GetNumFilesInAssigZonesOfCrsFromDB (long CrsCod);
-static unsigned long Ind_GetNumFilesInWorksZonesOfCrsFromDB (long CrsCod);
+static void Ind_GetNumFilesInZonesOfCrssFromDB (const char *CrsCodsList,
+                                                Brw_FileBrowser_t FileBrowserCrs,
+                                                Brw_FileBrowser_t FileBrowserGrp,
+                                                Ind_NumberCrs_t NumberCrs,
+                                                unsigned NumCrss,
+                                                struct Ind_IndicatorsCrs *IndicatorsCrss);
+static void Ind_GetInfoSrcOfCrssFromDB (const char *CrsCodsList,
+                                        Inf_InfoType_t InfoType,
+                                        unsigned NumCrss,
+                                        struct Ind_IndicatorsCrs *IndicatorsCrss);
+static void Ind_GetNumThrsAndPstsOfCrssFromDB (const char *CrsCodsList,
+                                               unsigned NumCrss,
+                                               struct Ind_IndicatorsCrs *IndicatorsCrss);
+static void Ind_AddNumbersOfCrssFromDB (const char *Query,
+                                        Ind_NumberCrs_t NumberCrs,
+                                        unsigned NumCrss,
+                                        struct Ind_IndicatorsCrs *IndicatorsCrss);
 
 /*****************************************************************************/
 /******************* Request showing statistics of courses *******************/
@@ -100,6 +142,7 @@ void Ind_ReqIndicatorsCourses (void)
    extern const char *Txt_Show_more_details;
    MYSQL_RES *mysql_res;
    unsigned NumCrss;
+   struct Ind_IndicatorsCrs *IndicatorsCrss;
    unsigned NumCrssWithIndicatorYes[1 + Ind_NUM_INDICATORS];
    unsigned NumCrssToList;
    unsigned Ind;
@@ -166,8 +209,11 @@ void Ind_ReqIndicatorsCourses (void)
                                          will be listed */
    NumCrss = Ind_GetTableOfCourses (&mysql_res);
 
+   /***** Compute indicators of all the courses *****/
+   IndicatorsCrss = Ind_ComputeAndStoreIndicatorsCrss (NumCrss,mysql_res);
+
    /***** Get vector with numbers of courses with 0, 1, 2... indicators set to yes *****/
-   Ind_GetNumCoursesWithIndicators (NumCrssWithIndicatorYes,NumCrss,mysql_res);
+   Ind_GetNumCoursesWithIndicators (NumCrssWithIndicatorYes,NumCrss,IndicatorsCrss);
 
    /* Selection of the number of indicators */
    fprintf (Gbl.F.Out,"<tr>"
@@ -194,7 +240,8 @@ void Ind_ReqIndicatorsCourses (void)
    if (Ind_GetIfShowBigList (NumCrssToList))
      {
       /* Show table */
-      Ind_ShowTableOfCoursesWithIndicators (Ind_INDICATORS_BRIEF,NumCrss,mysql_res);
+      Ind_ShowTableOfCoursesWithIndicators (Ind_INDICATORS_BRIEF,NumCrss,mysql_res,
+                                            IndicatorsCrss);
 
       /* Button to show more details */
       Act_FormStart (ActSeeAllStaCrs);
@@ -210,6 +257,9 @@ void Ind_ReqIndicatorsCourses (void)
    /***** End box *****/
    Box_EndBox ();
 
+   /***** Free memory used for indicators of courses *****/
+   free ((void *) IndicatorsCrss);
+
    /***** Free structure that stores the query result *****/
    DB_FreeMySQLResult (&mysql_res);
   }
@@ -250,6 +300,7 @@ void Ind_ShowIndicatorsCourses (void)
   {
    MYSQL_RES *mysql_res;
    unsigned NumCrss;
+   struct Ind_IndicatorsCrs *IndicatorsCrss;
    unsigned NumCrssWithIndicatorYes[1 + Ind_NUM_INDICATORS];
 
    /***** Get parameters *****/
@@ -258,14 +309,21 @@ void Ind_ShowIndicatorsCourses (void)
    /***** Get courses from database *****/
    NumCrss = Ind_GetTableOfCourses (&mysql_res);
 
+   /***** Compute indicators of all the courses *****/
+   IndicatorsCrss = Ind_ComputeAndStoreIndicatorsCrss (NumCrss,mysql_res);
+
    /***** Get vector with numbers of courses with 0, 1, 2... indicators set to yes *****/
-   Ind_GetNumCoursesWithIndicators (NumCrssWithIndicatorYes,NumCrss,mysql_res);
+   Ind_GetNumCoursesWithIndicators (NumCrssWithIndicatorYes,NumCrss,IndicatorsCrss);
 
    /***** Show table with numbers of courses with 0, 1, 2... indicators set to yes *****/
    Ind_ShowNumCoursesWithIndicators (NumCrssWithIndicatorYes,NumCrss,false);
 
    /***** Show the stats of courses *****/
-   Ind_ShowTableOfCoursesWithIndicators (Ind_INDICATORS_FULL,NumCrss,mysql_res);
+   Ind_ShowTableOfCoursesWithIndicators (Ind_INDICATORS_FULL,NumCrss,mysql_res,
+                                         IndicatorsCrss);
+
+   /***** Free memory used for indicators of courses *****/
+   free ((void *) IndicatorsCrss);
 
    /***** Free structure that stores the query result *****/
    DB_FreeMySQLResult (&mysql_res);
@@ -552,13 +610,11 @@ static void Ind_PutParamsConfirmIWantToSeeBigList (void)
 /*****************************************************************************/
 
 static void Ind_GetNumCoursesWithIndicators (unsigned NumCrssWithIndicatorYes[1 + Ind_NUM_INDICATORS],
-                                             unsigned NumCrss,MYSQL_RES *mysql_res)
+                                             unsigned NumCrss,
+                                             const struct Ind_IndicatorsCrs *IndicatorsCrss)
   {
-   MYSQL_ROW row;
    unsigned NumCrs;
-   long CrsCod;
    unsigned Ind;
-   unsigned NumIndicators;
 
    /***** Reset counters of courses with each number of indicators *****/
    for (Ind = 0;
@@ -566,22 +622,11 @@ static void Ind_GetNumCoursesWithIndicators (unsigned NumCrssWithIndicatorYes[1
 	Ind++)
       NumCrssWithIndicatorYes[Ind] = 0;
 
-   /***** List courses *****/
-   for (Gbl.RowEvenOdd = 1, NumCrs = 0;
+   /***** Count courses *****/
+   for (NumCrs = 0;
 	NumCrs < NumCrss;
-	NumCrs++, Gbl.RowEvenOdd = 1 - Gbl.RowEvenOdd)
-     {
-      /* Get next course */
-      row = mysql_fetch_row (mysql_res);
-
-      /* Get course code (row[2]) */
-      if ((CrsCod = Str_ConvertStrCodToLongCod (row[2])) < 0)
-         Lay_ShowErrorAndExit ("Wrong code of course.");
-
-      /* Get stored number of indicators of this course */
-      NumIndicators = Ind_GetAndUpdateNumIndicatorsCrs (CrsCod);
-      NumCrssWithIndicatorYes[NumIndicators]++;
-     }
+	NumCrs++)
+      NumCrssWithIndicatorYes[IndicatorsCrss[NumCrs].NumIndicators]++;
   }
 
 /*****************************************************************************/
@@ -680,7 +725,8 @@ static void Ind_ShowNumCoursesWithIndicators (unsigned NumCrssWithIndicatorYes[1
 /*****************************************************************************/
 
 static void Ind_ShowTableOfCoursesWithIndicators (Ind_IndicatorsLayout_t IndicatorsLayout,
-                                                  unsigned NumCrss,MYSQL_RES *mysql_res)
+                                                  unsigned NumCrss,MYSQL_RES *mysql_res,
+                                                  struct Ind_IndicatorsCrs *IndicatorsCrss)
   {
    extern const char *Txt_Degree;
    extern const char *Txt_Course;
@@ -712,8 +758,7 @@ static void Ind_ShowTableOfCoursesWithIndicators (Ind_IndicatorsLayout_t Indicat
    long CrsCod;
    unsigned NumTchs;
    unsigned NumStds;
-   unsigned NumIndicators;
-   struct Ind_IndicatorsCrs Indicators;
+   struct Ind_IndicatorsCrs *Indicators;
    long ActCod;
 
    /***** Start table *****/
@@ -993,15 +1038,10 @@ static void Ind_ShowTableOfCoursesWithIndicators (Ind_IndicatorsLayout_t Indicat
       if ((CrsCod = Str_ConvertStrCodToLongCod (row[2])) < 0)
          Lay_ShowErrorAndExit ("Wrong code of course.");
 
-      /* Get stored number of indicators of this course */
-      NumIndicators = Ind_GetAndUpdateNumIndicatorsCrs (CrsCod);
-      if (Gbl.Stat.IndicatorsSelected[NumIndicators])
+      /* Get indicators of this course, already computed */
+      if ((Indicators = Ind_GetIndicatorsOfCrs (CrsCod,NumCrss,IndicatorsCrss)))
 	{
-	 /* Compute and store indicators */
-	 Ind_ComputeAndStoreIndicatorsCrs (CrsCod,(int) NumIndicators,&Indicators);
-
-	 /* The number of indicators may have changed */
-	 if (Gbl.Stat.IndicatorsSelected[Indicators.NumIndicators])
+	 if (Gbl.Stat.IndicatorsSelected[Indicators->NumIndicators])
 	   {
             ActCod = Act_GetActCod (ActReqStaCrs);
 
@@ -1064,63 +1104,63 @@ static void Ind_ShowTableOfCoursesWithIndicators (Ind_IndicatorsLayout_t Indicat
 				     "%s"
 				     "</td>"
 				     "</tr>",
-			   Indicators.CourseAllOK ? "DAT_SMALL_GREEN" :
-			   (Indicators.CoursePartiallyOK ? "DAT_SMALL" :
+			   Indicators->CourseAllOK ? "DAT_SMALL_GREEN" :
+			   (Indicators->CoursePartiallyOK ? "DAT_SMALL" :
 							   "DAT_SMALL_RED"),
 			   Gbl.RowEvenOdd,
 			   row[0],
-			   Indicators.CourseAllOK ? "DAT_SMALL_GREEN" :
-			   (Indicators.CoursePartiallyOK ? "DAT_SMALL" :
+			   Indicators->CourseAllOK ? "DAT_SMALL_GREEN" :
+			   (Indicators->CoursePartiallyOK ? "DAT_SMALL" :
 							   "DAT_SMALL_RED"),
 			   Gbl.RowEvenOdd,
 			   row[1],
-			   Indicators.CourseAllOK ? "DAT_SMALL_GREEN" :
-			   (Indicators.CoursePartiallyOK ? "DAT_SMALL" :
+			   Indicators->CourseAllOK ? "DAT_SMALL_GREEN" :
+			   (Indicators->CoursePartiallyOK ? "DAT_SMALL" :
 							   "DAT_SMALL_RED"),
 			   Gbl.RowEvenOdd,
 			   row[3],
 			   Gbl.RowEvenOdd,Cfg_URL_SWAD_CGI,CrsCod,ActCod,
 					  Cfg_URL_SWAD_CGI,CrsCod,ActCod,
 
-			   Indicators.CourseAllOK ? "DAT_SMALL_GREEN" :
-			   (Indicators.CoursePartiallyOK ? "DAT_SMALL" :
+			   Indicators->CourseAllOK ? "DAT_SMALL_GREEN" :
+			   (Indicators->CoursePartiallyOK ? "DAT_SMALL" :
 							   "DAT_SMALL_RED"),
 			   Gbl.RowEvenOdd,
-			   Indicators.NumIndicators,
+			   Indicators->NumIndicators,
 
 			   "DAT_SMALL_GREEN",Gbl.RowEvenOdd,
-			   Indicators.ThereIsSyllabus ? Txt_YES :
+			   Indicators->ThereIsSyllabus ? Txt_YES :
 							"",
 			   "DAT_SMALL_RED",Gbl.RowEvenOdd,
-			   Indicators.ThereIsSyllabus ? "" :
+			   Indicators->ThereIsSyllabus ? "" :
 							Txt_NO,
 
 			   "DAT_SMALL_GREEN",Gbl.RowEvenOdd,
-			   Indicators.ThereAreAssignments ? Txt_YES :
+			   Indicators->ThereAreAssignments ? Txt_YES :
 							    "",
 			   "DAT_SMALL_RED",Gbl.RowEvenOdd,
-			   Indicators.ThereAreAssignments ? "" :
+			   Indicators->ThereAreAssignments ? "" :
 							    Txt_NO,
 
 			   "DAT_SMALL_GREEN",Gbl.RowEvenOdd,
-			   Indicators.ThereIsOnlineTutoring ? Txt_YES :
+			   Indicators->ThereIsOnlineTutoring ? Txt_YES :
 							      "",
 			   "DAT_SMALL_RED",Gbl.RowEvenOdd,
-			   Indicators.ThereIsOnlineTutoring ? "" :
+			   Indicators->ThereIsOnlineTutoring ? "" :
 							      Txt_NO,
 
 			   "DAT_SMALL_GREEN",Gbl.RowEvenOdd,
-			   Indicators.ThereAreMaterials ? Txt_YES :
+			   Indicators->ThereAreMaterials ? Txt_YES :
 							  "",
 			   "DAT_SMALL_RED",Gbl.RowEvenOdd,
-			   Indicators.ThereAreMaterials ? "" :
+			   Indicators->ThereAreMaterials ? "" :
 							  Txt_NO,
 
 			   "DAT_SMALL_GREEN",Gbl.RowEvenOdd,
-			   Indicators.ThereIsAssessment ? Txt_YES :
+			   Indicators->ThereIsAssessment ? Txt_YES :
 							  "",
 			   "DAT_SMALL_RED",Gbl.RowEvenOdd,
-			   Indicators.ThereIsAssessment ? "" :
+			   Indicators->ThereIsAssessment ? "" :
 							  Txt_NO);
 		  break;
 	       case Ind_INDICATORS_FULL:
@@ -1230,18 +1270,18 @@ static void Ind_ShowTableOfCoursesWithIndicators (Ind_IndicatorsLayout_t Indicat
 				     "%s"
 				     "</td>"
 				     "</tr>",
-			   Indicators.CourseAllOK ? "DAT_SMALL_GREEN" :
-			   (Indicators.CoursePartiallyOK ? "DAT_SMALL" :
+			   Indicators->CourseAllOK ? "DAT_SMALL_GREEN" :
+			   (Indicators->CoursePartiallyOK ? "DAT_SMALL" :
 							   "DAT_SMALL_RED"),
 			   Gbl.RowEvenOdd,
 			   row[0],
-			   Indicators.CourseAllOK ? "DAT_SMALL_GREEN" :
-			   (Indicators.CoursePartiallyOK ? "DAT_SMALL" :
+			   Indicators->CourseAllOK ? "DAT_SMALL_GREEN" :
+			   (Indicators->CoursePartiallyOK ? "DAT_SMALL" :
 							   "DAT_SMALL_RED"),
 			   Gbl.RowEvenOdd,
 			   row[1],
-			   Indicators.CourseAllOK ? "DAT_SMALL_GREEN" :
-			   (Indicators.CoursePartiallyOK ? "DAT_SMALL" :
+			   Indicators->CourseAllOK ? "DAT_SMALL_GREEN" :
+			   (Indicators->CoursePartiallyOK ? "DAT_SMALL" :
 							   "DAT_SMALL_RED"),
 			   Gbl.RowEvenOdd,
 			   row[3],
@@ -1257,98 +1297,98 @@ static void Ind_ShowTableOfCoursesWithIndicators (Ind_IndicatorsLayout_t Indicat
 			   Gbl.RowEvenOdd,
 			   NumStds,
 
-			   Indicators.CourseAllOK ? "DAT_SMALL_GREEN" :
-			   (Indicators.CoursePartiallyOK ? "DAT_SMALL" :
+			   Indicators->CourseAllOK ? "DAT_SMALL_GREEN" :
+			   (Indicators->CoursePartiallyOK ? "DAT_SMALL" :
 							   "DAT_SMALL_RED"),
 			   Gbl.RowEvenOdd,
-			   Indicators.NumIndicators,
+			   Indicators->NumIndicators,
 
 			   "DAT_SMALL_GREEN",Gbl.RowEvenOdd,
-			   Indicators.ThereIsSyllabus ? Txt_YES :
+			   Indicators->ThereIsSyllabus ? Txt_YES :
 							"",
 			   "DAT_SMALL_RED",Gbl.RowEvenOdd,
-			   Indicators.ThereIsSyllabus ? "" :
+			   Indicators->ThereIsSyllabus ? "" :
 							Txt_NO,
-			   (Indicators.SyllabusLecSrc != Inf_INFO_SRC_NONE) ? "DAT_SMALL_GREEN" :
+			   (Indicators->SyllabusLecSrc != Inf_INFO_SRC_NONE) ? "DAT_SMALL_GREEN" :
 									      "DAT_SMALL_RED",
 			   Gbl.RowEvenOdd,
-			   Txt_INFO_SRC_SHORT_TEXT[Indicators.SyllabusLecSrc],
-			   (Indicators.SyllabusPraSrc != Inf_INFO_SRC_NONE) ? "DAT_SMALL_GREEN" :
+			   Txt_INFO_SRC_SHORT_TEXT[Indicators->SyllabusLecSrc],
+			   (Indicators->SyllabusPraSrc != Inf_INFO_SRC_NONE) ? "DAT_SMALL_GREEN" :
 									      "DAT_SMALL_RED",
 			   Gbl.RowEvenOdd,
-			   Txt_INFO_SRC_SHORT_TEXT[Indicators.SyllabusPraSrc],
-			   (Indicators.TeachingGuideSrc != Inf_INFO_SRC_NONE) ? "DAT_SMALL_GREEN" :
+			   Txt_INFO_SRC_SHORT_TEXT[Indicators->SyllabusPraSrc],
+			   (Indicators->TeachingGuideSrc != Inf_INFO_SRC_NONE) ? "DAT_SMALL_GREEN" :
 										"DAT_SMALL_RED",
 			   Gbl.RowEvenOdd,
-			   Txt_INFO_SRC_SHORT_TEXT[Indicators.TeachingGuideSrc],
+			   Txt_INFO_SRC_SHORT_TEXT[Indicators->TeachingGuideSrc],
 
 			   "DAT_SMALL_GREEN",Gbl.RowEvenOdd,
-			   Indicators.ThereAreAssignments ? Txt_YES :
+			   Indicators->ThereAreAssignments ? Txt_YES :
 							    "",
 			   "DAT_SMALL_RED",Gbl.RowEvenOdd,
-			   Indicators.ThereAreAssignments ? "" :
+			   Indicators->ThereAreAssignments ? "" :
 							    Txt_NO,
-			   (Indicators.NumAssignments != 0) ? "DAT_SMALL_GREEN" :
+			   (Indicators->NumAssignments != 0) ? "DAT_SMALL_GREEN" :
 							      "DAT_SMALL_RED",
 			   Gbl.RowEvenOdd,
-			   Indicators.NumAssignments,
-			   (Indicators.NumFilesAssignments != 0) ? "DAT_SMALL_GREEN" :
+			   Indicators->NumAssignments,
+			   (Indicators->NumFilesAssignments != 0) ? "DAT_SMALL_GREEN" :
 								   "DAT_SMALL_RED",
 			   Gbl.RowEvenOdd,
-			   Indicators.NumFilesAssignments,
-			   (Indicators.NumFilesWorks != 0) ? "DAT_SMALL_GREEN" :
+			   Indicators->NumFilesAssignments,
+			   (Indicators->NumFilesWorks != 0) ? "DAT_SMALL_GREEN" :
 							     "DAT_SMALL_RED",
 			   Gbl.RowEvenOdd,
-			   Indicators.NumFilesWorks,
+			   Indicators->NumFilesWorks,
 
 			   "DAT_SMALL_GREEN",Gbl.RowEvenOdd,
-			   Indicators.ThereIsOnlineTutoring ? Txt_YES :
+			   Indicators->ThereIsOnlineTutoring ? Txt_YES :
 							      "",
 			   "DAT_SMALL_RED",Gbl.RowEvenOdd,
-			   Indicators.ThereIsOnlineTutoring ? "" :
+			   Indicators->ThereIsOnlineTutoring ? "" :
 							      Txt_NO,
-			   (Indicators.NumThreads != 0) ? "DAT_SMALL_GREEN" :
+			   (Indicators->NumThreads != 0) ? "DAT_SMALL_GREEN" :
 							  "DAT_SMALL_RED",
 			   Gbl.RowEvenOdd,
-			   Indicators.NumThreads,
-			   (Indicators.NumPosts != 0) ? "DAT_SMALL_GREEN" :
+			   Indicators->NumThreads,
+			   (Indicators->NumPosts != 0) ? "DAT_SMALL_GREEN" :
 							"DAT_SMALL_RED",
 			   Gbl.RowEvenOdd,
-			   Indicators.NumPosts,
-			   (Indicators.NumMsgsSentByTchs != 0) ? "DAT_SMALL_GREEN" :
+			   Indicators->NumPosts,
+			   (Indicators->NumMsgsSentByTchs != 0) ? "DAT_SMALL_GREEN" :
 								 "DAT_SMALL_RED",
 			   Gbl.RowEvenOdd,
-			   Indicators.NumMsgsSentByTchs,
+			   Indicators->NumMsgsSentByTchs,
 
 			   "DAT_SMALL_GREEN",Gbl.RowEvenOdd,
-			   Indicators.ThereAreMaterials ? Txt_YES :
+			   Indicators->ThereAreMaterials ? Txt_YES :
 							  "",
 			   "DAT_SMALL_RED",Gbl.RowEvenOdd,
-			   Indicators.ThereAreMaterials ? "" :
+			   Indicators->ThereAreMaterials ? "" :
 							  Txt_NO,
-			   (Indicators.NumFilesInDocumentZones != 0) ? "DAT_SMALL_GREEN" :
+			   (Indicators->NumFilesInDocumentZones != 0) ? "DAT_SMALL_GREEN" :
 								       "DAT_SMALL_RED",
 			   Gbl.RowEvenOdd,
-			   Indicators.NumFilesInDocumentZones,
-			   (Indicators.NumFilesInSharedZones != 0) ? "DAT_SMALL_GREEN" :
+			   Indicators->NumFilesInDocumentZones,
+			   (Indicators->NumFilesInSharedZones != 0) ? "DAT_SMALL_GREEN" :
 								     "DAT_SMALL_RED",
 			   Gbl.RowEvenOdd,
-			   Indicators.NumFilesInSharedZones,
+			   Indicators->NumFilesInSharedZones,
 
 			   "DAT_SMALL_GREEN",Gbl.RowEvenOdd,
-			   Indicators.ThereIsAssessment ? Txt_YES :
+			   Indicators->ThereIsAssessment ? Txt_YES :
 							  "",
 			   "DAT_SMALL_RED",Gbl.RowEvenOdd,
-			   Indicators.ThereIsAssessment ? "" :
+			   Indicators->ThereIsAssessment ? "" :
 							  Txt_NO,
-			   (Indicators.AssessmentSrc != Inf_INFO_SRC_NONE) ? "DAT_SMALL_GREEN" :
+			   (Indicators->AssessmentSrc != Inf_INFO_SRC_NONE) ? "DAT_SMALL_GREEN" :
 									     "DAT_SMALL_RED",
 			   Gbl.RowEvenOdd,
-			   Txt_INFO_SRC_SHORT_TEXT[Indicators.AssessmentSrc],
-			   (Indicators.TeachingGuideSrc != Inf_INFO_SRC_NONE) ? "DAT_SMALL_GREEN" :
+			   Txt_INFO_SRC_SHORT_TEXT[Indicators->AssessmentSrc],
+			   (Indicators->TeachingGuideSrc != Inf_INFO_SRC_NONE) ? "DAT_SMALL_GREEN" :
 										"DAT_SMALL_RED",
 			   Gbl.RowEvenOdd,
-			   Txt_INFO_SRC_SHORT_TEXT[Indicators.TeachingGuideSrc]);
+			   Txt_INFO_SRC_SHORT_TEXT[Indicators->TeachingGuideSrc]);
 		  break;
 		 }
 	   }
@@ -1360,26 +1400,253 @@ static void Ind_ShowTableOfCoursesWithIndicators (Ind_IndicatorsLayout_t Indicat
   }
 
 /*****************************************************************************/
-/************ Get number of indicators of a course from database *************/
-/************ If not stored ==> compute and store it             *************/
+/************ Compute and store indicators of a list of courses **************/
 /*****************************************************************************/
+// Returns an array with the indicators of the courses, sorted by course code
+// Each number needed to compute indicators is got for all the courses
+// in only one query, so the number of queries does not depend on number of courses
+// The array returned must be freed by the caller
 
-static unsigned Ind_GetAndUpdateNumIndicatorsCrs (long CrsCod)
+static struct Ind_IndicatorsCrs *Ind_ComputeAndStoreIndicatorsCrss (unsigned NumCrss,MYSQL_RES *mysql_res)
   {
-   unsigned NumIndicators;
-   struct Ind_IndicatorsCrs Indicators;
-   int NumIndicatorsFromDB = Ind_GetNumIndicatorsCrsFromDB (CrsCod);
+   struct Ind_IndicatorsCrs *IndicatorsCrss;
+   MYSQL_ROW row;
+   unsigned NumCrs;
+   char *CrsCodsList;
+
+   /***** Allocate memory for indicators of courses *****/
+   if ((IndicatorsCrss = (struct Ind_IndicatorsCrs *) calloc ((size_t) (NumCrss ? NumCrss :
+	                                                                          1),
+	                                                      sizeof (struct Ind_IndicatorsCrs))) == NULL)
+      Lay_ShowErrorAndExit ("Not enough memory to store indicators of courses.");
 
-   /***** If number of indicators is not already computed ==> compute it! *****/
-   if (NumIndicatorsFromDB >= 0)
-      NumIndicators = (unsigned) NumIndicatorsFromDB;
-   else	// Number of indicators is not already computed
+   if (NumCrss)
      {
-      /***** Compute and store number of indicators *****/
-      Ind_ComputeAndStoreIndicatorsCrs (CrsCod,NumIndicatorsFromDB,&Indicators);
-      NumIndicators = Indicators.NumIndicators;
+      /***** Get codes of courses *****/
+      mysql_data_seek (mysql_res,0);
+      for (NumCrs = 0;
+	   NumCrs < NumCrss;
+	   NumCrs++)
+	{
+	 /* Get next course */
+	 row = mysql_fetch_row (mysql_res);
+
+	 /* Get course code (row[2]) */
+	 if ((IndicatorsCrss[NumCrs].CrsCod = Str_ConvertStrCodToLongCod (row[2])) < 0)
+	    Lay_ShowErrorAndExit ("Wrong code of course.");
+	}
+
+      /***** Sort courses by code to find them quickly *****/
+      qsort ((void *) IndicatorsCrss,(size_t) NumCrss,sizeof (struct Ind_IndicatorsCrs),
+             Ind_CompareCrsCods);
+
+      /***** Compute indicators *****/
+      Ind_ComputeIndicatorsCrss (NumCrss,IndicatorsCrss);
+
+      /***** Store number of indicators of those courses
+             with a number of indicators different to the stored one *****/
+      CrsCodsList = Ind_BuildListOfCrsCods (NumCrss,IndicatorsCrss);
+      Ind_GetNumIndicatorsCrssFromDB (CrsCodsList,NumCrss,IndicatorsCrss);
+      free ((void *) CrsCodsList);
+      Ind_StoreNumIndicatorsCrssIntoDB (NumCrss,IndicatorsCrss);
+     }
+
+   return IndicatorsCrss;
+  }
+
+/*****************************************************************************/
+/************************ Compare two codes of courses ***********************/
+/*****************************************************************************/
+
+static int Ind_CompareCrsCods (const void *p1,const void *p2)
+  {
+   long CrsCod1 = ((const struct Ind_IndicatorsCrs *) p1)->CrsCod;
+   long CrsCod2 = ((const struct Ind_IndicatorsCrs *) p2)->CrsCod;
+
+   return (CrsCod1 < CrsCod2) ? -1 :
+	  ((CrsCod1 > CrsCod2) ? 1 :
+		                 0);
+  }
+
+/*****************************************************************************/
+/********* Find the indicators of a course in an array of courses ************/
+/*****************************************************************************/
+// The array must be sorted by course code
+// Returns NULL if not found
+
+static struct Ind_IndicatorsCrs *Ind_GetIndicatorsOfCrs (long CrsCod,unsigned NumCrss,
+                                                        struct Ind_IndicatorsCrs *IndicatorsCrss)
+  {
+   struct Ind_IndicatorsCrs Key;
+
+   Key.CrsCod = CrsCod;
+   return (struct Ind_IndicatorsCrs *) bsearch ((const void *) &Key,
+                                                (const void *) IndicatorsCrss,
+                                                (size_t) NumCrss,
+                                                sizeof (struct Ind_IndicatorsCrs),
+                                                Ind_CompareCrsCods);
+  }
+
+/*****************************************************************************/
+/*********** Build a list of codes of courses separated by commas ************/
+/*****************************************************************************/
+// The string returned must be freed by the caller
+
+static char *Ind_BuildListOfCrsCods (unsigned NumCrss,
+                                     const struct Ind_IndicatorsCrs *IndicatorsCrss)
+  {
+   char *CrsCodsList;
+   char *Ptr;
+   unsigned NumCrs;
+
+   /***** Allocate memory for the list *****/
+   if ((CrsCodsList = (char *) malloc ((size_t) NumCrss * Ind_MAX_BYTES_CRS_COD_IN_LIST + 1)) == NULL)
+      Lay_ShowErrorAndExit ("Not enough memory to store list of courses.");
+
+   /***** Write codes of courses *****/
+   CrsCodsList[0] = '\0';
+   for (NumCrs = 0, Ptr = CrsCodsList;
+	NumCrs < NumCrss;
+	NumCrs++)
+      Ptr += sprintf (Ptr,NumCrs ? ",%ld" :
+	                           "%ld",
+	              IndicatorsCrss[NumCrs].CrsCod);
+
+   return CrsCodsList;
+  }
+
+/*****************************************************************************/
+/**************** Compute indicators of an array of courses ******************/
+/*****************************************************************************/
+// The array must be sorted by course code
+
+static void Ind_ComputeIndicatorsCrss (unsigned NumCrss,
+                                       struct Ind_IndicatorsCrs *IndicatorsCrss)
+  {
+   char *CrsCodsList;
+   char *Query;
+   unsigned NumCrs;
+   struct Ind_IndicatorsCrs *Indicators;
+
+   /***** Build list of codes of courses *****/
+   CrsCodsList = Ind_BuildListOfCrsCods (NumCrss,IndicatorsCrss);
+
+   /***** Allocate space for query *****/
+   if ((Query = (char *) malloc (1024 + strlen (CrsCodsList))) == NULL)
+      Lay_ShowErrorAndExit ("Not enough memory to store database query.");
+
+   /***** Reset numbers *****/
+   for (NumCrs = 0;
+	NumCrs < NumCrss;
+	NumCrs++)
+     {
+      Indicators = &IndicatorsCrss[NumCrs];
+      Indicators->NumFilesInDocumentZones = 0;
+      Indicators->NumFilesInSharedZones   = 0;
+      Indicators->SyllabusLecSrc          = Inf_INFO_SRC_NONE;
+      Indicators->SyllabusPraSrc          = Inf_INFO_SRC_NONE;
+      Indicators->TeachingGuideSrc        = Inf_INFO_SRC_NONE;
+      Indicators->NumAssignments          = 0;
+      Indicators->NumFilesAssignments     = 0;
+      Indicators->NumFilesWorks           = 0;
+      Indicators->NumThreads              = 0;
+      Indicators->NumPosts                = 0;
+      Indicators->NumUsrsToBeNotifiedByEMail = 0;
+      Indicators->NumMsgsSentByTchs       = 0;
+      Indicators->AssessmentSrc           = Inf_INFO_SRC_NONE;
+     }
+
+   /***** Get number of files in download zones *****/
+   Ind_GetNumFilesInZonesOfCrssFromDB (CrsCodsList,Brw_ADMI_DOC_CRS,Brw_ADMI_DOC_GRP,
+                                       Ind_NUM_FILES_IN_DOCUM_ZONES,
+                                       NumCrss,IndicatorsCrss);
+   Ind_GetNumFilesInZonesOfCrssFromDB (CrsCodsList,Brw_ADMI_SHR_CRS,Brw_ADMI_SHR_GRP,
+                                       Ind_NUM_FILES_IN_SHARE_ZONES,
+                                       NumCrss,IndicatorsCrss);
+
+   /***** Get info sources about syllabus and assessment *****/
+   Ind_GetInfoSrcOfCrssFromDB (CrsCodsList,Inf_LECTURES      ,NumCrss,IndicatorsCrss);
+   Ind_GetInfoSrcOfCrssFromDB (CrsCodsList,Inf_PRACTICALS    ,NumCrss,IndicatorsCrss);
+   Ind_GetInfoSrcOfCrssFromDB (CrsCodsList,Inf_TEACHING_GUIDE,NumCrss,IndicatorsCrss);
+   Ind_GetInfoSrcOfCrssFromDB (CrsCodsList,Inf_ASSESSMENT    ,NumCrss,IndicatorsCrss);
+
+   /***** Get number of assignments and files in assignments and works zones *****/
+   sprintf (Query,"SELECT CrsCod,COUNT(*) FROM assignments"
+		  " WHERE CrsCod IN (%s) GROUP BY CrsCod",
+	    CrsCodsList);
+   Ind_AddNumbersOfCrssFromDB (Query,Ind_NUM_ASSIGNMENTS,NumCrss,IndicatorsCrss);
+   Ind_GetNumFilesInZonesOfCrssFromDB (CrsCodsList,Brw_ADMI_ASG_USR,Brw_UNKNOWN,
+                                       Ind_NUM_FILES_IN_ASSIG_ZONES,
+                                       NumCrss,IndicatorsCrss);
+   Ind_GetNumFilesInZonesOfCrssFromDB (CrsCodsList,Brw_ADMI_WRK_USR,Brw_UNKNOWN,
+                                       Ind_NUM_FILES_IN_WORKS_ZONES,
+                                       NumCrss,IndicatorsCrss);
+
+   /***** Get number of threads and posts in forums of courses *****/
+   Ind_GetNumThrsAndPstsOfCrssFromDB (CrsCodsList,NumCrss,IndicatorsCrss);
+
+   /***** Get number of unique messages sent by teachers from courses *****/
+   sprintf (Query,"SELECT msg_snt.CrsCod,COUNT(*) FROM msg_snt,crs_usr"
+                  " WHERE msg_snt.CrsCod IN (%s)"
+                  " AND msg_snt.CrsCod=crs_usr.CrsCod"
+                  " AND crs_usr.Role=%u"
+                  " AND msg_snt.UsrCod=crs_usr.UsrCod"
+                  " GROUP BY msg_snt.CrsCod",
+            CrsCodsList,(unsigned) Rol_TCH);
+   Ind_AddNumbersOfCrssFromDB (Query,Ind_NUM_MSGS_SENT_BY_TCHS,NumCrss,IndicatorsCrss);
+
+   /***** Free memory used for query and list of courses *****/
+   free ((void *) Query);
+   free ((void *) CrsCodsList);
+
+   /***** Compute indicators from numbers got *****/
+   for (NumCrs = 0;
+	NumCrs < NumCrss;
+	NumCrs++)
+     {
+      Indicators = &IndicatorsCrss[NumCrs];
+
+      /* Initialize number of indicators */
+      Indicators->NumIndicators = 0;
+
+      /* Indicator #1: information about syllabus */
+      Indicators->ThereIsSyllabus = (Indicators->SyllabusLecSrc   != Inf_INFO_SRC_NONE) ||
+				    (Indicators->SyllabusPraSrc   != Inf_INFO_SRC_NONE) ||
+				    (Indicators->TeachingGuideSrc != Inf_INFO_SRC_NONE);
+      if (Indicators->ThereIsSyllabus)
+	 Indicators->NumIndicators++;
+
+      /* Indicator #2: information about assignments */
+      Indicators->ThereAreAssignments = (Indicators->NumAssignments      != 0) ||
+					(Indicators->NumFilesAssignments != 0) ||
+					(Indicators->NumFilesWorks       != 0);
+      if (Indicators->ThereAreAssignments)
+	 Indicators->NumIndicators++;
+
+      /* Indicator #3: information about online tutoring */
+      Indicators->ThereIsOnlineTutoring = (Indicators->NumThreads        != 0) ||
+					  (Indicators->NumPosts          != 0) ||
+					  (Indicators->NumMsgsSentByTchs != 0);
+      if (Indicators->ThereIsOnlineTutoring)
+	 Indicators->NumIndicators++;
+
+      /* Indicator #4: information about materials */
+      Indicators->ThereAreMaterials = (Indicators->NumFilesInDocumentZones != 0) ||
+				      (Indicators->NumFilesInSharedZones   != 0);
+      if (Indicators->ThereAreMaterials)
+	 Indicators->NumIndicators++;
+
+      /* Indicator #5: information about assessment */
+      Indicators->ThereIsAssessment = (Indicators->AssessmentSrc    != Inf_INFO_SRC_NONE) ||
+				      (Indicators->TeachingGuideSrc != Inf_INFO_SRC_NONE);
+      if (Indicators->ThereIsAssessment)
+	 Indicators->NumIndicators++;
+
+      /* All the indicators are OK? */
+      Indicators->CoursePartiallyOK = Indicators->NumIndicators >= 1 &&
+				      Indicators->NumIndicators < Ind_NUM_INDICATORS;
+      Indicators->CourseAllOK       = Indicators->NumIndicators == Ind_NUM_INDICATORS;
      }
-   return NumIndicators;
   }
 
 /*****************************************************************************/
@@ -1413,6 +1680,58 @@ int Ind_GetNumIndicatorsCrsFromDB (long CrsCod)
    return NumIndicatorsFromDB;
   }
 
+/*****************************************************************************/
+/********** Get number of indicators of several courses from database ********/
+/*****************************************************************************/
+
+static void Ind_GetNumIndicatorsCrssFromDB (const char *CrsCodsList,
+                                            unsigned NumCrss,
+                                            struct Ind_IndicatorsCrs *IndicatorsCrss)
+  {
+   char *Query;
+   MYSQL_RES *mysql_res;
+   MYSQL_ROW row;
+   unsigned long NumRow;
+   unsigned long NumRows;
+   unsigned NumCrs;
+   struct Ind_IndicatorsCrs *Indicators;
+
+   /***** By default, number of indicators is not yet calculated *****/
+   for (NumCrs = 0;
+	NumCrs < NumCrss;
+	NumCrs++)
+      IndicatorsCrss[NumCrs].NumIndicatorsFromDB = -1;
+
+   /***** Allocate space for query *****/
+   if ((Query = (char *) malloc (128 + strlen (CrsCodsList))) == NULL)
+      Lay_ShowErrorAndExit ("Not enough memory to store database query.");
+
+   /***** Get number of indicators of courses from database *****/
+   sprintf (Query,"SELECT CrsCod,NumIndicators FROM courses"
+		  " WHERE CrsCod IN (%s)",
+	    CrsCodsList);
+   NumRows = DB_QuerySELECT (Query,&mysql_res,"can not get number of indicators");
+
+   /***** Free space used for query *****/
+   free ((void *) Query);
+
+   for (NumRow = 0;
+	NumRow < NumRows;
+	NumRow++)
+     {
+      row = mysql_fetch_row (mysql_res);
+
+      /* Get course code (row[0]) and number of indicators (row[1]) */
+      if ((Indicators = Ind_GetIndicatorsOfCrs (Str_ConvertStrCodToLongCod (row[0]),
+                                                NumCrss,IndicatorsCrss)))
+	 if (sscanf (row[1],"%d",&Indicators->NumIndicatorsFromDB) != 1)
+	    Lay_ShowErrorAndExit ("Error when getting number of indicators.");
+     }
+
+   /***** Free structure that stores the query result *****/
+   DB_FreeMySQLResult (&mysql_res);
+  }
+
 /*****************************************************************************/
 /************ Store number of indicators of a course in database *************/
 /*****************************************************************************/
@@ -1427,6 +1746,55 @@ static void Ind_StoreIndicatorsCrsIntoDB (long CrsCod,unsigned NumIndicators)
    DB_QueryUPDATE (Query,"can not store number of indicators of a course");
   }
 
+/*****************************************************************************/
+/*********** Store number of indicators of courses in database ***************/
+/*****************************************************************************/
+// Only courses with a number of indicators different to the stored one
+// are updated, with one query for each possible number of indicators
+
+static void Ind_StoreNumIndicatorsCrssIntoDB (unsigned NumCrss,
+                                              const struct Ind_IndicatorsCrs *IndicatorsCrss)
+  {
+   char *Query;
+   char *Ptr;
+   unsigned NumIndicators;
+   unsigned NumCrs;
+   unsigned NumCrssToUpdate;
+
+   /***** Allocate space for query *****/
+   if ((Query = (char *) malloc (128 + (size_t) NumCrss * Ind_MAX_BYTES_CRS_COD_IN_LIST)) == NULL)
+      Lay_ShowErrorAndExit ("Not enough memory to store database query.");
+
+   for (NumIndicators = 0;
+	NumIndicators <= Ind_NUM_INDICATORS;
+	NumIndicators++)
+     {
+      /***** Build query with courses to be updated *****/
+      Ptr = Query + sprintf (Query,"UPDATE courses SET NumIndicators=%u"
+			           " WHERE CrsCod IN (",
+			     NumIndicators);
+      for (NumCrs = 0, NumCrssToUpdate = 0;
+	   NumCrs < NumCrss;
+	   NumCrs++)
+	 if (IndicatorsCrss[NumCrs].NumIndicators == NumIndicators &&
+	     IndicatorsCrss[NumCrs].NumIndicatorsFromDB != (int) NumIndicators)
+	   {
+	    Ptr += sprintf (Ptr,NumCrssToUpdate ? ",%ld" :
+					          "%ld",
+			    IndicatorsCrss[NumCrs].CrsCod);
+	    NumCrssToUpdate++;
+	   }
+      sprintf (Ptr,")");
+
+      /***** Store number of indicators of courses in database *****/
+      if (NumCrssToUpdate)
+	 DB_QueryUPDATE (Query,"can not store number of indicators of courses");
+     }
+
+   /***** Free space used for query *****/
+   free ((void *) Query);
+  }
+
 /*****************************************************************************/
 /********************* Compute indicators of a course ************************/
 /*****************************************************************************/
@@ -1438,60 +1806,10 @@ static void Ind_StoreIndicatorsCrsIntoDB (long CrsCod,unsigned NumIndicators)
 void Ind_ComputeAndStoreIndicatorsCrs (long CrsCod,int NumIndicatorsFromDB,
                                        struct Ind_IndicatorsCrs *Indicators)
   {
-   /***** Initialize number of indicators *****/
-   Indicators->NumIndicators = 0;
-
-   /***** Get whether download zones are empty or not *****/
-   Indicators->NumFilesInDocumentZones = Ind_GetNumFilesInDocumZonesOfCrsFromDB (CrsCod);
-   Indicators->NumFilesInSharedZones   = Ind_GetNumFilesInShareZonesOfCrsFromDB (CrsCod);
-
-   /***** Indicator #1: information about syllabus *****/
-   Indicators->SyllabusLecSrc   = Inf_GetInfoSrcFromDB (CrsCod,Inf_LECTURES);
-   Indicators->SyllabusPraSrc   = Inf_GetInfoSrcFromDB (CrsCod,Inf_PRACTICALS);
-   Indicators->TeachingGuideSrc = Inf_GetInfoSrcFromDB (CrsCod,Inf_TEACHING_GUIDE);
-   Indicators->ThereIsSyllabus = (Indicators->SyllabusLecSrc   != Inf_INFO_SRC_NONE) ||
-                                 (Indicators->SyllabusPraSrc   != Inf_INFO_SRC_NONE) ||
-                                 (Indicators->TeachingGuideSrc != Inf_INFO_SRC_NONE);
-   if (Indicators->ThereIsSyllabus)
-      Indicators->NumIndicators++;
-
-   /***** Indicator #2: information about assignments *****/
-   Indicators->NumAssignments = Asg_GetNumAssignmentsInCrs (CrsCod);
-   Indicators->NumFilesAssignments = Ind_GetNumFilesInAssigZonesOfCrsFromDB (CrsCod);
-   Indicators->NumFilesWorks       = Ind_GetNumFilesInWorksZonesOfCrsFromDB (CrsCod);
-   Indicators->ThereAreAssignments = (Indicators->NumAssignments      != 0) ||
-                                     (Indicators->NumFilesAssignments != 0) ||
-                                     (Indicators->NumFilesWorks       != 0);
-   if (Indicators->ThereAreAssignments)
-      Indicators->NumIndicators++;
-
-   /***** Indicator #3: information about online tutoring *****/
-   Indicators->NumThreads = For_GetNumTotalThrsInForumsOfType (For_FORUM_COURSE_USRS,-1L,-1L,-1L,-1L,CrsCod);
-   Indicators->NumPosts   = For_GetNumTotalPstsInForumsOfType (For_FORUM_COURSE_USRS,-1L,-1L,-1L,-1L,CrsCod,&(Indicators->NumUsrsToBeNotifiedByEMail));
-   Indicators->NumMsgsSentByTchs = Msg_GetNumMsgsSentByTchsCrs (CrsCod);
-   Indicators->ThereIsOnlineTutoring = (Indicators->NumThreads        != 0) ||
-	                               (Indicators->NumPosts          != 0) ||
-	                               (Indicators->NumMsgsSentByTchs != 0);
-   if (Indicators->ThereIsOnlineTutoring)
-      Indicators->NumIndicators++;
-
-   /***** Indicator #4: information about materials *****/
-   Indicators->ThereAreMaterials = (Indicators->NumFilesInDocumentZones != 0) ||
-                                   (Indicators->NumFilesInSharedZones   != 0);
-   if (Indicators->ThereAreMaterials)
-      Indicators->NumIndicators++;
-
-   /***** Indicator #5: information about assessment *****/
-   Indicators->AssessmentSrc = Inf_GetInfoSrcFromDB (CrsCod,Inf_ASSESSMENT);
-   Indicators->ThereIsAssessment = (Indicators->AssessmentSrc    != Inf_INFO_SRC_NONE) ||
-                                   (Indicators->TeachingGuideSrc != Inf_INFO_SRC_NONE);
-   if (Indicators->ThereIsAssessment)
-      Indicators->NumIndicators++;
-
-   /***** All the indicators are OK? *****/
-   Indicators->CoursePartiallyOK = Indicators->NumIndicators >= 1 &&
-	                           Indicators->NumIndicators < Ind_NUM_INDICATORS;
-   Indicators->CourseAllOK       = Indicators->NumIndicators == Ind_NUM_INDICATORS;
+   /***** Compute indicators of this course *****/
+   Indicators->CrsCod = CrsCod;
+   Indicators->NumIndicatorsFromDB = NumIndicatorsFromDB;
+   Ind_ComputeIndicatorsCrss (1,Indicators);
 
    /***** Update number of indicators into database
           if different to the stored one *****/
@@ -1500,151 +1818,241 @@ void Ind_ComputeAndStoreIndicatorsCrs (long CrsCod,int NumIndicatorsFromDB,
   }
 
 /*****************************************************************************/
-/*********** Get the number of files in document zones of a course ***********/
+/********** Get the number of files in zones of several courses **************/
 /*****************************************************************************/
-
-static unsigned long Ind_GetNumFilesInDocumZonesOfCrsFromDB (long CrsCod)
+// FileBrowserGrp may be Brw_UNKNOWN when there are no group zones
+
+static void Ind_GetNumFilesInZonesOfCrssFromDB (const char *CrsCodsList,
+                                                Brw_FileBrowser_t FileBrowserCrs,
+                                                Brw_FileBrowser_t FileBrowserGrp,
+                                                Ind_NumberCrs_t NumberCrs,
+                                                unsigned NumCrss,
+                                                struct Ind_IndicatorsCrs *IndicatorsCrss)
   {
    extern const Brw_FileBrowser_t Brw_FileBrowserForDB_files[Brw_NUM_TYPES_FILE_BROWSER];
-   char Query[1024];
-   MYSQL_RES *mysql_res;
-   MYSQL_ROW row;
-   unsigned long NumFiles;
+   char *Query;
 
-   /***** Get number of files in document zones of a course from database *****/
-   sprintf (Query,"SELECT"
-	          " (SELECT COALESCE(SUM(NumFiles),0)"
-		  " FROM file_browser_size"
-		  " WHERE FileBrowser=%u AND Cod=%ld) +"
-		  " (SELECT COALESCE(SUM(file_browser_size.NumFiles),0)"
-		  " FROM crs_grp_types,crs_grp,file_browser_size"
-		  " WHERE crs_grp_types.CrsCod=%ld"
-                  " AND crs_grp_types.GrpTypCod=crs_grp.GrpTypCod"
-		  " AND file_browser_size.FileBrowser=%u"
-		  " AND file_browser_size.Cod=crs_grp.GrpCod)",
-	    (unsigned) Brw_FileBrowserForDB_files[Brw_ADMI_DOC_CRS],
-	    CrsCod,
-	    CrsCod,
-	    (unsigned) Brw_FileBrowserForDB_files[Brw_ADMI_DOC_GRP]);
-   DB_QuerySELECT (Query,&mysql_res,"can not get the number of files");
-
-   /***** Get row *****/
-   row = mysql_fetch_row (mysql_res);
-
-   /***** Get number of files (row[0]) *****/
-   if (sscanf (row[0],"%lu",&NumFiles) != 1)
-      Lay_ShowErrorAndExit ("Error when getting the number of files.");
+   /***** Allocate space for query *****/
+   if ((Query = (char *) malloc (1024 + strlen (CrsCodsList))) == NULL)
+      Lay_ShowErrorAndExit ("Not enough memory to store database query.");
 
-   /***** Free structure that stores the query result *****/
-   DB_FreeMySQLResult (&mysql_res);
+   /***** Get number of files in course zones of courses from database *****/
+   sprintf (Query,"SELECT Cod,SUM(NumFiles)"
+		  " FROM file_browser_size"
+		  " WHERE FileBrowser=%u AND Cod IN (%s)"
+		  " GROUP BY Cod",
+	    (unsigned) Brw_FileBrowserForDB_files[FileBrowserCrs],
+	    CrsCodsList);
+   Ind_AddNumbersOfCrssFromDB (Query,NumberCrs,NumCrss,IndicatorsCrss);
+
+   /***** Get number of files in group zones of courses from database *****/
+   if (FileBrowserGrp != Brw_UNKNOWN)
+     {
+      sprintf (Query,"SELECT crs_grp_types.CrsCod,SUM(file_browser_size.NumFiles)"
+		     " FROM crs_grp_types,crs_grp,file_browser_size"
+		     " WHERE crs_grp_types.CrsCod IN (%s)"
+		     " AND crs_grp_types.GrpTypCod=crs_grp.GrpTypCod"
+		     " AND file_browser_size.FileBrowser=%u"
+		     " AND file_browser_size.Cod=crs_grp.GrpCod"
+		     " GROUP BY crs_grp_types.CrsCod",
+	       CrsCodsList,
+	       (unsigned) Brw_FileBrowserForDB_files[FileBrowserGrp]);
+      Ind_AddNumbersOfCrssFromDB (Query,NumberCrs,NumCrss,IndicatorsCrss);
+     }
 
-   return NumFiles;
+   /***** Free space used for query *****/
+   free ((void *) Query);
   }
 
 /*****************************************************************************/
-/*********** Get the number of files in shared zones of a course ***********/
+/*********** Get the source of a type of info of several courses *************/
 /*****************************************************************************/
 
-static unsigned long Ind_GetNumFilesInShareZonesOfCrsFromDB (long CrsCod)
+static void Ind_GetInfoSrcOfCrssFromDB (const char *CrsCodsList,
+                                        Inf_InfoType_t InfoType,
+                                        unsigned NumCrss,
+                                        struct Ind_IndicatorsCrs *IndicatorsCrss)
   {
-   extern const Brw_FileBrowser_t Brw_FileBrowserForDB_files[Brw_NUM_TYPES_FILE_BROWSER];
-   char Query[1024];
+   extern const char *Inf_NamesInDBForInfoType[Inf_NUM_INFO_TYPES];
+   char *Query;
    MYSQL_RES *mysql_res;
    MYSQL_ROW row;
-   unsigned long NumFiles;
+   unsigned long NumRow;
+   unsigned long NumRows;
+   struct Ind_IndicatorsCrs *Indicators;
+   Inf_InfoSrc_t InfoSrc;
+
+   /***** Allocate space for query *****/
+   if ((Query = (char *) malloc (256 + strlen (CrsCodsList))) == NULL)
+      Lay_ShowErrorAndExit ("Not enough memory to store database query.");
+
+   /***** Get info source for a specific type of info from database *****/
+   sprintf (Query,"SELECT CrsCod,InfoSrc FROM crs_info_src"
+	          " WHERE CrsCod IN (%s) AND InfoType='%s'",
+            CrsCodsList,Inf_NamesInDBForInfoType[InfoType]);
+   NumRows = DB_QuerySELECT (Query,&mysql_res,"can not get info source");
+
+   /***** Free space used for query *****/
+   free ((void *) Query);
+
+   for (NumRow = 0;
+	NumRow < NumRows;
+	NumRow++)
+     {
+      row = mysql_fetch_row (mysql_res);
 
-   /***** Get number of files in document zones of a course from database *****/
-   sprintf (Query,"SELECT"
-	          " (SELECT COALESCE(SUM(NumFiles),0)"
-		  " FROM file_browser_size"
-		  " WHERE FileBrowser=%u AND Cod=%ld) +"
-		  " (SELECT COALESCE(SUM(file_browser_size.NumFiles),0)"
-		  " FROM crs_grp_types,crs_grp,file_browser_size"
-		  " WHERE crs_grp_types.CrsCod=%ld"
-                  " AND crs_grp_types.GrpTypCod=crs_grp.GrpTypCod"
-		  " AND file_browser_size.FileBrowser=%u"
-		  " AND file_browser_size.Cod=crs_grp.GrpCod)",
-	    (unsigned) Brw_FileBrowserForDB_files[Brw_ADMI_SHR_CRS],
-	    CrsCod,
-	    CrsCod,
-	    (unsigned) Brw_FileBrowserForDB_files[Brw_ADMI_SHR_GRP]);
-   DB_QuerySELECT (Query,&mysql_res,"can not get the number of files");
-
-   /***** Get row *****/
-   row = mysql_fetch_row (mysql_res);
-
-   /***** Get number of files (row[0]) *****/
-   if (sscanf (row[0],"%lu",&NumFiles) != 1)
-      Lay_ShowErrorAndExit ("Error when getting the number of files.");
+      /* Get course code (row[0]) and info source (row[1]) */
+      if ((Indicators = Ind_GetIndicatorsOfCrs (Str_ConvertStrCodToLongCod (row[0]),
+                                                NumCrss,IndicatorsCrss)))
+	{
+	 InfoSrc = Inf_ConvertFromStrDBToInfoSrc (row[1]);
+	 switch (InfoType)
+	   {
+	    case Inf_LECTURES:
+	       Indicators->SyllabusLecSrc = InfoSrc;
+	       break;
+	    case Inf_PRACTICALS:
+	       Indicators->SyllabusPraSrc = InfoSrc;
+	       break;
+	    case Inf_TEACHING_GUIDE:
+	       Indicators->TeachingGuideSrc = InfoSrc;
+	       break;
+	    case Inf_ASSESSMENT:
+	       Indicators->AssessmentSrc = InfoSrc;
+	       break;
+	    default:
+	       break;
+	   }
+	}
+     }
 
    /***** Free structure that stores the query result *****/
    DB_FreeMySQLResult (&mysql_res);
-
-   return NumFiles;
   }
 
 /*****************************************************************************/
-/********* Get the number of files in assignment zones of a course ***********/
+/****** Get the number of threads and posts in forums of several courses *****/
 /*****************************************************************************/
 
-static unsigned long Ind_GetNumFilesInAssigZonesOfCrsFromDB (long CrsCod)
+static void Ind_GetNumThrsAndPstsOfCrssFromDB (const char *CrsCodsList,
+                                               unsigned NumCrss,
+                                               struct Ind_IndicatorsCrs *IndicatorsCrss)
   {
-   extern const Brw_FileBrowser_t Brw_FileBrowserForDB_files[Brw_NUM_TYPES_FILE_BROWSER];
-   char Query[256];
+   char *Query;
    MYSQL_RES *mysql_res;
    MYSQL_ROW row;
-   unsigned long NumFiles;
+   unsigned long NumRow;
+   unsigned long NumRows;
+   struct Ind_IndicatorsCrs *Indicators;
+
+   /***** Allocate space for query *****/
+   if ((Query = (char *) malloc (512 + strlen (CrsCodsList))) == NULL)
+      Lay_ShowErrorAndExit ("Not enough memory to store database query.");
+
+   /***** Get number of threads, posts and notifications
+          in forums of courses from database *****/
+   sprintf (Query,"SELECT forum_thread.Location,"
+		  "COUNT(DISTINCT forum_thread.ThrCod),"
+		  "COUNT(*),"
+		  "SUM(forum_post.NumNotif)"
+		  " FROM forum_thread,forum_post"
+		  " WHERE forum_thread.ForumType=%u"
+		  " AND forum_thread.Location IN (%s)"
+		  " AND forum_thread.ThrCod=forum_post.ThrCod"
+		  " GROUP BY forum_thread.Location",
+	    (unsigned) For_FORUM_COURSE_USRS,CrsCodsList);
+   NumRows = DB_QuerySELECT (Query,&mysql_res,"can not get number of posts in forums");
+
+   /***** Free space used for query *****/
+   free ((void *) Query);
+
+   for (NumRow = 0;
+	NumRow < NumRows;
+	NumRow++)
+     {
+      row = mysql_fetch_row (mysql_res);
 
-   /***** Get number of files in document zones of a course from database *****/
-   sprintf (Query,"SELECT COALESCE(SUM(NumFiles),0)"
-		  " FROM file_browser_size"
-		  " WHERE FileBrowser=%u AND Cod=%ld",
-	    (unsigned) Brw_FileBrowserForDB_files[Brw_ADMI_ASG_USR],
-	    CrsCod);
-   DB_QuerySELECT (Query,&mysql_res,"can not get the number of files");
+      /* Get course code (row[0]) */
+      if ((Indicators = Ind_GetIndicatorsOfCrs (Str_ConvertStrCodToLongCod (row[0]),
+                                                NumCrss,IndicatorsCrss)))
+	{
+	 /* Get number of threads (row[1]) */
+	 if (sscanf (row[1],"%u",&Indicators->NumThreads) != 1)
+	    Lay_ShowErrorAndExit ("Error when getting the number of threads.");
 
-   /***** Get row *****/
-   row = mysql_fetch_row (mysql_res);
+	 /* Get number of posts (row[2]) */
+	 if (sscanf (row[2],"%u",&Indicators->NumPosts) != 1)
+	    Lay_ShowErrorAndExit ("Error when getting the number of posts.");
 
-   /***** Get number of files (row[0]) *****/
-   if (sscanf (row[0],"%lu",&NumFiles) != 1)
-      Lay_ShowErrorAndExit ("Error when getting the number of files.");
+	 /* Get number of users to be notified by email (row[3]) */
+	 if (sscanf (row[3],"%u",&Indicators->NumUsrsToBeNotifiedByEMail) != 1)
+	    Lay_ShowErrorAndExit ("Error when getting the number of notifications.");
+	}
+     }
 
    /***** Free structure that stores the query result *****/
    DB_FreeMySQLResult (&mysql_res);
-
-   return NumFiles;
   }
 
 /*****************************************************************************/
-/************* Get the number of files in works zones of a course ************/
+/************** Add numbers got from database to several courses *************/
 /*****************************************************************************/
+// Query must return rows with a course code (row[0]) and a number (row[1])
 
-static unsigned long Ind_GetNumFilesInWorksZonesOfCrsFromDB (long CrsCod)
+static void Ind_AddNumbersOfCrssFromDB (const char *Query,
+                                        Ind_NumberCrs_t NumberCrs,
+                                        unsigned NumCrss,
+                                        struct Ind_IndicatorsCrs *IndicatorsCrss)
   {
-   extern const Brw_FileBrowser_t Brw_FileBrowserForDB_files[Brw_NUM_TYPES_FILE_BROWSER];
-   char Query[256];
    MYSQL_RES *mysql_res;
    MYSQL_ROW row;
-   unsigned long NumFiles;
+   unsigned long NumRow;
+   unsigned long NumRows;
+   struct Ind_IndicatorsCrs *Indicators;
+   unsigned long Number;
 
-   /***** Get number of files in document zones of a course from database *****/
-   sprintf (Query,"SELECT COALESCE(SUM(NumFiles),0)"
-		  " FROM file_browser_size"
-		  " WHERE FileBrowser=%u AND Cod=%ld",
-	    (unsigned) Brw_FileBrowserForDB_files[Brw_ADMI_WRK_USR],
-	    CrsCod);
-   DB_QuerySELECT (Query,&mysql_res,"can not get the number of files");
+   /***** Query database *****/
+   NumRows = DB_QuerySELECT (Query,&mysql_res,"can not get numbers of courses");
 
-   /***** Get row *****/
-   row = mysql_fetch_row (mysql_res);
+   for (NumRow = 0;
+	NumRow < NumRows;
+	NumRow++)
+     {
+      row = mysql_fetch_row (mysql_res);
 
-   /***** Get number of files (row[0]) *****/
-   if (sscanf (row[0],"%lu",&NumFiles) != 1)
-      Lay_ShowErrorAndExit ("Error when getting the number of files.");
+      /* Get course code (row[0]) */
+      if ((Indicators = Ind_GetIndicatorsOfCrs (Str_ConvertStrCodToLongCod (row[0]),
+                                                NumCrss,IndicatorsCrss)))
+	{
+	 /* Get number (row[1]) */
+	 if (sscanf (row[1],"%lu",&Number) != 1)
+	    Lay_ShowErrorAndExit ("Error when getting a number of a course.");
+
+	 /* Add number to the corresponding field */
+	 switch (NumberCrs)
+	   {
+	    case Ind_NUM_FILES_IN_DOCUM_ZONES:
+	       Indicators->NumFilesInDocumentZones += Number;
+	       break;
+	    case Ind_NUM_FILES_IN_SHARE_ZONES:
+	       Indicators->NumFilesInSharedZones += Number;
+	       break;
+	    case Ind_NUM_FILES_IN_ASSIG_ZONES:
+	       Indicators->NumFilesAssignments += Number;
+	       break;
+	    case Ind_NUM_FILES_IN_WORKS_ZONES:
+	       Indicators->NumFilesWorks += Number;
+	       break;
+	    case Ind_NUM_ASSIGNMENTS:
+	       Indicators->NumAssignments += (unsigned) Number;
+	       break;
+	    case Ind_NUM_MSGS_SENT_BY_TCHS:
+	       Indicators->NumMsgsSentByTchs += (unsigned) Number;
+	       break;
+	   }
+	}
+     }
 
    /***** Free structure that stores the query result *****/
    DB_FreeMySQLResult (&mysql_res);
-
-   return NumFiles;
   }
@@ -36,6 +36,8 @@
 
 struct Ind_IndicatorsCrs
   {
+   long CrsCod;
+   int NumIndicatorsFromDB;	// -1 means not yet calculated
    unsigned long NumFilesInDocumentZones;
    unsigned long NumFilesInSharedZones;
    bool ThereIsSyllabus;
@@ -31,6 +31,7 @@
 #include <stdlib.h>		// For getenv, etc
 #include <stdsoap2.h>		// For SOAP_OK and soap functions
 #include <string.h>		// For string functions
+#include <sys/stat.h>		// For lstat
 #include <unistd.h>		// For unlink
 
 #include "swad_action.h"
@@ -38,6 +39,7 @@
 #include "swad_database.h"
 #include "swad_global.h"
 #include "swad_info.h"
+#include "swad_layout.h"
 #include "swad_parameter.h"
 #include "swad_string.h"
 
@@ -453,6 +455,60 @@ void Inf_ShowInfo (void)
      }
   }
 
+/*****************************************************************************/
+/********** Build validators of the page with the course info to be shown ****/
+/*****************************************************************************/
+// Return false if the time of last modification is unknown
+// (no info, or info stored in database) ==> the page can not be cached
+
+bool Inf_GetValidatorOfInfo (void)
+  {
+   Inf_InfoSrc_t InfoSrc;
+   bool MustBeRead;
+   char PathRelDirHTML[PATH_MAX + 1];
+   char PathFile[PATH_MAX + 1];
+   struct stat FileStatus;
+
+   /***** Set info type *****/
+   Gbl.CurrentCrs.Info.Type = Inf_AsignInfoType ();
+
+   /***** Get info source from database *****/
+   Inf_GetAndCheckInfoSrcFromDB (Gbl.CurrentCrs.Crs.CrsCod,
+                                 Gbl.CurrentCrs.Info.Type,
+                                 &InfoSrc,&MustBeRead);
+
+   /***** Build path to the file with the info *****/
+   switch (InfoSrc)
+     {
+      case Inf_INFO_SRC_EDITOR:
+	 // Only syllabus is edited with the integrated editor,
+	 // and it has been loaded from its XML file when checking it
+         Syl_BuildPathFileSyllabus (PathFile);
+	 break;
+      case Inf_INFO_SRC_PAGE:
+         Inf_BuildPathPage (Gbl.CurrentCrs.Crs.CrsCod,Gbl.CurrentCrs.Info.Type,PathRelDirHTML);
+         if (snprintf (PathFile,sizeof (PathFile),"%s/index.html",
+                       PathRelDirHTML) >= (int) sizeof (PathFile))
+            return false;
+         if (!Fil_CheckIfPathExists (PathFile))
+            if (snprintf (PathFile,sizeof (PathFile),"%s/index.htm",
+                          PathRelDirHTML) >= (int) sizeof (PathFile))
+               return false;
+	 break;
+      case Inf_INFO_SRC_URL:
+         Inf_BuildPathURL (Gbl.CurrentCrs.Crs.CrsCod,Gbl.CurrentCrs.Info.Type,PathFile);
+	 break;
+      default:	// No info, or plain/rich text stored in database
+	 return false;
+     }
+
+   /***** Get time of last modification of the file *****/
+   if (lstat (PathFile,&FileStatus))
+      return false;
+   Lay_SetLastModifiedOfPage (FileStatus.st_mtime);
+   return true;
+  }
+
 /*****************************************************************************/
 /*********************** Put button to edit course info **********************/
 /*****************************************************************************/
@@ -1506,38 +1562,6 @@ void Inf_SetInfoSrcIntoDB (Inf_InfoSrc_t InfoSrc)
 /***** Get and check info source for a type of course info from database *****/
 /*****************************************************************************/
 
-Inf_InfoSrc_t Inf_GetInfoSrcFromDB (long CrsCod,Inf_InfoType_t InfoType)
-  {
-   char Query[512];
-   MYSQL_RES *mysql_res;
-   MYSQL_ROW row;
-   Inf_InfoSrc_t InfoSrc;
-
-   /***** Get info source for a specific type of info from database *****/
-   sprintf (Query,"SELECT InfoSrc FROM crs_info_src"
-	          " WHERE CrsCod=%ld AND InfoType='%s'",
-            CrsCod,Inf_NamesInDBForInfoType[InfoType]);
-   if (DB_QuerySELECT (Query,&mysql_res,"can not get info source"))
-     {
-      /* Get row */
-      row = mysql_fetch_row (mysql_res);
-
-      /* Get info source (row[0]) */
-      InfoSrc = Inf_ConvertFromStrDBToInfoSrc (row[0]);
-     }
-   else
-      InfoSrc = Inf_INFO_SRC_NONE;
-
-   /***** Free structure that stores the query result *****/
-   DB_FreeMySQLResult (&mysql_res);
-
-   return InfoSrc;
-  }
-
-/*****************************************************************************/
-/***** Get and check info source for a type of course info from database *****/
-/*****************************************************************************/
-
 void Inf_GetAndCheckInfoSrcFromDB (long CrsCod,
                                    Inf_InfoType_t InfoType,
                                    Inf_InfoSrc_t *InfoSrc,bool *MustBeRead)
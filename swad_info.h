@@ -68,6 +68,7 @@ typedef enum
 /*****************************************************************************/
 
 void Inf_ShowInfo (void);
+bool Inf_GetValidatorOfInfo (void);
 void Inf_PutIconToEditInfo (void);
 void Inf_WriteMsgYouMustReadInfo (void);
 void Inf_ChangeForceReadInfo (void);
@@ -85,7 +86,6 @@ void Inf_FormToSendPage (Inf_InfoSrc_t InfoSrc);
 void Inf_FormToSendURL (Inf_InfoSrc_t InfoSrc);
 Inf_InfoSrc_t Inf_GetInfoSrcFromForm (void);
 void Inf_SetInfoSrcIntoDB (Inf_InfoSrc_t InfoSrc);
-Inf_InfoSrc_t Inf_GetInfoSrcFromDB (long CrsCod,Inf_InfoType_t InfoType);
 void Inf_GetAndCheckInfoSrcFromDB (long CrsCod,
                                    Inf_InfoType_t InfoType,
                                    Inf_InfoSrc_t *InfoSrc,bool *MustBeRead);
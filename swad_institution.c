@@ -37,6 +37,7 @@
 #include "swad_help.h"
 #include "swad_hierarchy.h"
 #include "swad_institution.h"
+#include "swad_layout.h"
 #include "swad_logo.h"
 #include "swad_parameter.h"
 #include "swad_QR.h"
@@ -282,6 +283,32 @@ void Ins_PrintConfiguration (void)
    Ins_Configuration (true);
   }
 
+/*****************************************************************************/
+/******** Build validators of the information of current institution *********/
+/*****************************************************************************/
+// Data shown have not time of last modification,
+// so they are added to the validator of the page
+
+bool Ins_GetValidatorOfConfiguration (void)
+  {
+   if (Gbl.CurrentIns.Ins.InsCod <= 0)
+      return false;
+
+   Lay_AddStrToPageValidator (Gbl.CurrentIns.Ins.WWW);
+   Lay_AddNumToPageValidator ((unsigned long) Log_CheckIfLogoExists (Sco_SCOPE_INS,Gbl.CurrentIns.Ins.InsCod));
+   Lay_AddNumToPageValidator ((unsigned long) Usr_GetNumUsrsWhoClaimToBelongToIns (Gbl.CurrentIns.Ins.InsCod));
+   Lay_AddNumToPageValidator ((unsigned long) Ctr_GetNumCtrsInIns (Gbl.CurrentIns.Ins.InsCod));
+   Lay_AddNumToPageValidator ((unsigned long) Deg_GetNumDegsInIns (Gbl.CurrentIns.Ins.InsCod));
+   Lay_AddNumToPageValidator ((unsigned long) Crs_GetNumCrssInIns (Gbl.CurrentIns.Ins.InsCod));
+   Lay_AddNumToPageValidator ((unsigned long) Dpt_GetNumDepartmentsInInstitution (Gbl.CurrentIns.Ins.InsCod));
+   Lay_AddNumToPageValidator ((unsigned long) Usr_GetNumUsrsInCrssOfIns (Rol_TCH,Gbl.CurrentIns.Ins.InsCod));
+   Lay_AddNumToPageValidator ((unsigned long) Usr_GetNumUsrsInCrssOfIns (Rol_NET,Gbl.CurrentIns.Ins.InsCod));
+   Lay_AddNumToPageValidator ((unsigned long) Usr_GetNumUsrsInCrssOfIns (Rol_STD,Gbl.CurrentIns.Ins.InsCod));
+   Lay_AddNumToPageValidator ((unsigned long) Usr_GetNumUsrsInCrssOfIns (Rol_UNK,Gbl.CurrentIns.Ins.InsCod));
+
+   return true;
+  }
+
 /*****************************************************************************/
 /***************** Information of the current institution ********************/
 /*****************************************************************************/
@@ -1141,27 +1168,8 @@ bool Ins_GetDataOfInstitutionByCod (struct Instit *Ins,
 	 /* Get row */
 	 row = mysql_fetch_row (mysql_res);
 
-	 /* Get country code (row[0]) */
-	 Ins->CtyCod = Str_ConvertStrCodToLongCod (row[0]);
-
-	 /* Get centre status (row[1]) */
-	 if (sscanf (row[1],"%u",&(Ins->Status)) != 1)
-	    Lay_ShowErrorAndExit ("Wrong institution status.");
-
-	 /* Get requester user's code (row[2]) */
-	 Ins->RequesterUsrCod = Str_ConvertStrCodToLongCod (row[2]);
-
-	 /* Get the short name of the institution (row[3]) */
-	 Str_Copy (Ins->ShrtName,row[3],
-	           Hie_MAX_BYTES_SHRT_NAME);
-
-	 /* Get the full name of the institution (row[4]) */
-	 Str_Copy (Ins->FullName,row[4],
-	           Hie_MAX_BYTES_FULL_NAME);
-
-	 /* Get the URL of the institution (row[5]) */
-	 Str_Copy (Ins->WWW,row[5],
-	           Cns_MAX_BYTES_WWW);
+	 /* Get basic data of the institution (row[0]...row[5]) */
+	 Ins_GetBasicDataOfInstitutionFromRow (Ins,row);
 
 	 /* Get extra data */
 	 if (GetExtraData == Ins_GET_EXTRA_DATA)
@@ -1190,6 +1198,36 @@ bool Ins_GetDataOfInstitutionByCod (struct Instit *Ins,
    return InsFound;
   }
 
+/*****************************************************************************/
+/**** Get basic data of an institution from a row resulting of a query *******/
+/*****************************************************************************/
+// Row must contain CtyCod,Status,RequesterUsrCod,ShortName,FullName,WWW
+
+void Ins_GetBasicDataOfInstitutionFromRow (struct Instit *Ins,MYSQL_ROW row)
+  {
+   /***** Get country code (row[0]) *****/
+   Ins->CtyCod = Str_ConvertStrCodToLongCod (row[0]);
+
+   /***** Get institution status (row[1]) *****/
+   if (sscanf (row[1],"%u",&(Ins->Status)) != 1)
+      Lay_ShowErrorAndExit ("Wrong institution status.");
+
+   /***** Get requester user's code (row[2]) *****/
+   Ins->RequesterUsrCod = Str_ConvertStrCodToLongCod (row[2]);
+
+   /***** Get the short name of the institution (row[3]) *****/
+   Str_Copy (Ins->ShrtName,row[3],
+             Hie_MAX_BYTES_SHRT_NAME);
+
+   /***** Get the full name of the institution (row[4]) *****/
+   Str_Copy (Ins->FullName,row[4],
+             Hie_MAX_BYTES_FULL_NAME);
+
+   /***** Get the URL of the institution (row[5]) *****/
+   Str_Copy (Ins->WWW,row[5],
+             Cns_MAX_BYTES_WWW);
+  }
+
 /*****************************************************************************/
 /*********** Get the short name of an institution from its code **************/
 /*****************************************************************************/
@@ -1717,6 +1755,9 @@ void Ins_RemoveInstitution (void)
 	       (unsigned) Ins.InsCod);
       Fil_RemoveTree (PathIns);
 
+      /***** Remove logo from manifest *****/
+      Log_RemoveLogoFromManifest (Sco_SCOPE_INS,Ins.InsCod);
+
       /***** Remove institution *****/
       sprintf (Query,"DELETE FROM institutions WHERE InsCod=%ld",
                Ins.InsCod);
@@ -27,6 +27,8 @@
 /********************************** Headers **********************************/
 /*****************************************************************************/
 
+#include <mysql/mysql.h>	// To access MySQL databases
+
 #include "swad_constant.h"
 #include "swad_role_type.h"
 
@@ -98,6 +100,7 @@ void Ins_DrawInstitutionLogoAndNameWithLink (struct Instit *Ins,Act_Action_t Act
 
 void Ins_ShowConfiguration (void);
 void Ins_PrintConfiguration (void);
+bool Ins_GetValidatorOfConfiguration (void);
 
 void Ins_ShowInssOfCurrentCty (void);
 void Ins_EditInstitutions (void);
@@ -106,6 +109,7 @@ void Ins_GetListInstitutions (long CtyCod,Ins_GetExtraData_t GetExtraData);
 void Ins_WriteInstitutionNameAndCty (long InsCod);
 bool Ins_GetDataOfInstitutionByCod (struct Instit *Ins,
                                     Ins_GetExtraData_t GetExtraData);
+void Ins_GetBasicDataOfInstitutionFromRow (struct Instit *Ins,MYSQL_ROW row);
 void Ins_FlushCacheShortNameOfInstitution (void);
 void Ins_GetShortNameOfInstitution (struct Instit *Ins);
 void Ins_FlushCacheFullNameAndCtyOfInstitution (void);
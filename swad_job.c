@@ -0,0 +1,660 @@
+// swad_job.c: actions executed in background
+
+/*
+    SWAD (Shared Workspace At a Distance),
+    is a web platform developed at the University of Granada (Spain),
+    and used to support university teaching.
+
+    This file is part of SWAD core.
+    Copyright (C) 1999-2018 Antonio Caas Vargas
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as
+    published by the Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.
+
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/*****************************************************************************/
+/*********************************** Headers *********************************/
+/*****************************************************************************/
+
+#include <linux/limits.h>	// For PATH_MAX
+#include <stdio.h>		// For freopen
+#include <stdlib.h>		// For malloc, free, exit
+#include <string.h>		// For string functions
+#include <unistd.h>		// For fork, setsid, execl
+
+#include "swad_box.h"
+#include "swad_config.h"
+#include "swad_database.h"
+#include "swad_global.h"
+#include "swad_hierarchy.h"
+#include "swad_job.h"
+#include "swad_parameter.h"
+#include "swad_profile.h"
+#include "swad_zip.h"
+
+/*****************************************************************************/
+/****************************** Public constants *****************************/
+/*****************************************************************************/
+
+/*****************************************************************************/
+/***************************** Private constants *****************************/
+/*****************************************************************************/
+
+#define Job_PATH_TO_THIS_PROGRAM "/proc/self/exe"	// The worker is this same program
+
+/*****************************************************************************/
+/****************************** Internal types *******************************/
+/*****************************************************************************/
+
+/*****************************************************************************/
+/************** External global variables from others modules ****************/
+/*****************************************************************************/
+
+extern struct Globals Gbl;
+
+/*****************************************************************************/
+/************************* Internal global variables *************************/
+/*****************************************************************************/
+
+/*****************************************************************************/
+/***************************** Private prototypes ****************************/
+/*****************************************************************************/
+
+static void Job_RemoveOldJobs (void);
+static long Job_GetMyUnfinishedJob (void);
+static void Job_CreateJob (void);
+static void Job_StartWorker (long JobCod);
+
+static void Job_SetPathJobs (char PathJobs[PATH_MAX + 1]);
+static void Job_SetFileNameResult (long JobCod,char FileNameResult[PATH_MAX + 1]);
+static void Job_CreateFileForResult (void);
+
+static bool Job_GetDataOfMyJob (void);
+static bool Job_CheckIfJobIsFinished (void);
+static void Job_ShowJobStatus (void);
+static void Job_WriteJobStatus (void);
+static void Job_ShowJobResult (void);
+
+/*****************************************************************************/
+/************* Check if an action must be executed in background *************/
+/*****************************************************************************/
+// Actions that can take several minutes are executed in background,
+// in order not to reach the timeout of the web server
+
+bool Job_CheckIfActionRunsAsJob (Act_Action_t Action)
+  {
+   switch (Action)
+     {
+      case ActAdmAsgWrkCrs:	// Only when a ZIP file with works is created
+	 return ZIP_GetCreateZIPFromForm ();
+      case ActRemOldUsr:
+      case ActLstDupUsr:
+      case ActCal1stClkTim:
+      case ActCalNumClk:
+      case ActCalNumFilVie:
+      case ActCalNumForPst:
+      case ActCalNumMsgSnt:
+      case ActCalPhoDeg:
+      case ActSeeAllStaCrs:
+	 return true;
+      default:
+	 return false;
+     }
+  }
+
+/*****************************************************************************/
+/************* Store a job for the current action and launch it **************/
+/*****************************************************************************/
+
+void Job_LaunchJob (void)
+  {
+   /***** Remove old jobs *****/
+   Job_RemoveOldJobs ();
+
+   /***** If I have just requested the same job, don't launch it again *****/
+   if ((Gbl.Job.JobCod = Job_GetMyUnfinishedJob ()) > 0)
+      Job_GetDataOfMyJob ();
+   else
+     {
+      /***** Store the job in database *****/
+      Job_CreateJob ();
+
+      /***** Hidden parameters stored in database for this action
+             will be needed by the worker, so don't remove them *****/
+      Gbl.HiddenParamsInsertedIntoDB = true;
+
+      /***** Start a worker to execute the job *****/
+      Job_StartWorker (Gbl.Job.JobCod);
+     }
+  }
+
+/*****************************************************************************/
+/******************** Remove old jobs and their results **********************/
+/*****************************************************************************/
+
+static void Job_RemoveOldJobs (void)
+  {
+   char PathJobs[PATH_MAX + 1];
+   char Query[256];
+
+   /***** Remove old files with results *****/
+   Job_SetPathJobs (PathJobs);
+   Fil_RemoveOldTmpFiles (PathJobs,Cfg_TIME_TO_DELETE_JOBS,false);
+
+   /***** Remove old jobs from database *****/
+   sprintf (Query,"DELETE LOW_PRIORITY FROM jobs"
+		  " WHERE RequestTime<FROM_UNIXTIME(UNIX_TIMESTAMP()-%lu)",
+	    (unsigned long) Cfg_TIME_TO_DELETE_JOBS);
+   DB_QueryDELETE (Query,"can not remove old jobs");
+  }
+
+/*****************************************************************************/
+/****** Get my unfinished job with the same action and same parameters *******/
+/*****************************************************************************/
+// Return -1 if not found
+
+static long Job_GetMyUnfinishedJob (void)
+  {
+   char *ParamsEscaped;
+   char *Query;
+   MYSQL_RES *mysql_res;
+   MYSQL_ROW row;
+   long JobCod = -1L;
+
+   /***** Escape the parameters of the request *****/
+   if ((ParamsEscaped = (char *) malloc (Gbl.Params.ContentLength * 2 + 1)) == NULL)
+      Lay_ShowErrorAndExit ("Not enough memory to store parameters.");
+   mysql_real_escape_string (&Gbl.mysql,ParamsEscaped,
+                             Gbl.Params.QueryString ? Gbl.Params.QueryString :
+                        	                      "",
+			     Gbl.Params.QueryString ? Gbl.Params.ContentLength :
+						      0);
+
+   /***** Get an unfinished job *****/
+   if ((Query = (char *) malloc (256 + strlen (ParamsEscaped))) == NULL)
+      Lay_ShowErrorAndExit ("Not enough memory to store database query.");
+   sprintf (Query,"SELECT JobCod FROM jobs"
+		  " WHERE UsrCod=%ld AND ActCod=%ld"
+		  " AND Status IN (%u,%u)"
+		  " AND Params='%s'",
+	    Gbl.Usrs.Me.UsrDat.UsrCod,
+	    Act_GetActCod (Gbl.Action.Act),
+	    (unsigned) Job_PENDING,(unsigned) Job_RUNNING,
+	    ParamsEscaped);
+   free ((void *) ParamsEscaped);
+   if (DB_QuerySELECT (Query,&mysql_res,"can not get job"))
+     {
+      row = mysql_fetch_row (mysql_res);
+      JobCod = Str_ConvertStrCodToLongCod (row[0]);
+     }
+   free ((void *) Query);
+
+   /***** Free structure that stores the query result *****/
+   DB_FreeMySQLResult (&mysql_res);
+
+   return JobCod;
+  }
+
+/*****************************************************************************/
+/************* Store a new job for the current action in database ************/
+/*****************************************************************************/
+
+static void Job_CreateJob (void)
+  {
+   char *ParamsEscaped;
+   char *Query;
+
+   /***** Escape the parameters of the request,
+          in order to run the action later with the same parameters *****/
+   if ((ParamsEscaped = (char *) malloc (Gbl.Params.ContentLength * 2 + 1)) == NULL)
+      Lay_ShowErrorAndExit ("Not enough memory to store parameters.");
+   mysql_real_escape_string (&Gbl.mysql,ParamsEscaped,
+                             Gbl.Params.QueryString ? Gbl.Params.QueryString :
+                        	                      "",
+			     Gbl.Params.QueryString ? Gbl.Params.ContentLength :
+						      0);
+
+   /***** Insert new job *****/
+   if ((Query = (char *) malloc (256 + strlen (ParamsEscaped))) == NULL)
+      Lay_ShowErrorAndExit ("Not enough memory to store database query.");
+   sprintf (Query,"INSERT INTO jobs"
+		  " (UsrCod,ActCod,Params,Status,Progress,"
+		  "RequestTime,StartTime,EndTime)"
+		  " VALUES"
+		  " (%ld,%ld,'%s',%u,0,"
+		  "NOW(),NOW(),NOW())",
+	    Gbl.Usrs.Me.UsrDat.UsrCod,
+	    Act_GetActCod (Gbl.Action.Act),
+	    ParamsEscaped,
+	    (unsigned) Job_PENDING);
+   free ((void *) ParamsEscaped);
+   Gbl.Job.JobCod = DB_QueryINSERTandReturnCode (Query,"can not create job");
+   free ((void *) Query);
+
+   Gbl.Job.Status = Job_PENDING;
+   Gbl.Job.Progress = 0;
+  }
+
+/*****************************************************************************/
+/***************** Start a worker process to execute a job *******************/
+/*****************************************************************************/
+// The worker is this same program called with the option -job and job code.
+// It must be detached from the web server,
+// which waits until standard output is closed
+
+static void Job_StartWorker (long JobCod)
+  {
+   char JobCodStr[1 + 10 + 1];
+
+   sprintf (JobCodStr,"%ld",JobCod);
+   switch (fork ())
+     {
+      case -1:	// Error
+	 Lay_ShowErrorAndExit ("Can not start a process to execute the job.");
+	 break;
+      case 0:	// Child process
+	 /***** Detach from the web server *****/
+	 setsid ();
+	 if (freopen ("/dev/null","r",stdin ) == NULL ||
+	     freopen ("/dev/null","w",stdout) == NULL ||
+	     freopen ("/dev/null","w",stderr) == NULL)
+	    _exit (1);
+
+	 /***** Replace this process by a worker *****/
+	 execl (Job_PATH_TO_THIS_PROGRAM,"swad",Job_WORKER_OPTION,JobCodStr,(char *) NULL);
+	 _exit (1);	// Only reached when execl fails
+	 break;
+      default:	// Parent process
+	 break;
+     }
+  }
+
+/*****************************************************************************/
+/********************** Execute a job stored in database *********************/
+/*****************************************************************************/
+// This function is executed in a worker process, not in a CGI.
+// The action is executed with the parameters of the request that launched it,
+// and its HTML output is stored in a file to be shown later.
+// This function never returns
+
+void Job_RunWorker (long JobCod)
+  {
+   extern const char *Txt_You_dont_have_permission_to_perform_this_action;
+   char Query[256];
+   MYSQL_RES *mysql_res;
+   MYSQL_ROW row;
+   long UsrCod;
+   Act_Action_t Action;
+   void (*FunctionPriori) (void);
+   void (*FunctionPosteriori) (void);
+
+   /***** Only the content of the action will be generated *****/
+   Gbl.Job.IsWorker = true;
+   Gbl.Layout.HTMLStartWritten =
+   Gbl.Layout.DivsEndWritten   =
+   Gbl.Layout.HTMLEndWritten   = true;
+
+   /***** Get data of the job *****/
+   sprintf (Query,"SELECT UsrCod,ActCod,Params FROM jobs"
+		  " WHERE JobCod=%ld AND Status=%u",
+	    JobCod,(unsigned) Job_PENDING);
+   if (DB_QuerySELECT (Query,&mysql_res,"can not get job") != 1)
+      Lay_ShowErrorAndExit ("Job not found.");
+
+   row = mysql_fetch_row (mysql_res);
+
+   /* Get user who requested the job (row[0]) */
+   UsrCod = Str_ConvertStrCodToLongCod (row[0]);
+
+   /* Get action (row[1]) */
+   Action = Act_GetActionFromActCod (Str_ConvertStrCodToLongCod (row[1]));
+
+   /* Get parameters of the request (row[2]) */
+   Gbl.Params.ContentLength = strlen (row[2]);
+   if ((Gbl.Params.QueryString = (char *) malloc (Gbl.Params.ContentLength + 1)) == NULL)
+      Lay_ShowErrorAndExit ("Not enough memory to store parameters.");
+   Str_Copy (Gbl.Params.QueryString,row[2],
+             Gbl.Params.ContentLength);
+
+   /***** Free structure that stores the query result *****/
+   DB_FreeMySQLResult (&mysql_res);
+
+   /***** Mark the job as running.
+          If another worker has just taken the job, do nothing *****/
+   sprintf (Query,"UPDATE jobs SET Status=%u,StartTime=NOW()"
+		  " WHERE JobCod=%ld AND Status=%u",
+	    (unsigned) Job_RUNNING,
+	    JobCod,(unsigned) Job_PENDING);
+   DB_QueryUPDATE (Query,"can not update job");
+   if (!mysql_affected_rows (&Gbl.mysql))
+      Lay_ShowErrorAndExit ("Job already started.");
+   Gbl.Job.JobCod = JobCod;
+   Gbl.Job.Status = Job_RUNNING;
+   Gbl.Job.Progress = 0;
+
+   /***** Create file for the result of the job *****/
+   Job_CreateFileForResult ();
+
+   /***** Get parameters of the request *****/
+   Gbl.ContentReceivedByCGI = Act_CONT_NORM;
+   Par_CreateListOfParams ();
+   Par_GetMainParameters ();
+   Hie_InitHierarchy ();
+
+   /***** Check user and get user's data *****/
+   Usr_ChkUsrAndGetUsrData ();
+   Gbl.Action.Act = Action;
+   if (Gbl.Usrs.Me.UsrDat.UsrCod != UsrCod ||
+       !Act_CheckIfIHavePermissionToExecuteAction (Gbl.Action.Act))
+      Lay_ShowErrorAndExit (Txt_You_dont_have_permission_to_perform_this_action);
+
+   /***** Execute the action *****/
+   FunctionPriori = Act_GetFunctionPriori (Gbl.Action.Act);
+   if (FunctionPriori != NULL)
+      FunctionPriori ();
+   FunctionPosteriori = Act_GetFunctionPosteriori (Gbl.Action.Act);
+   if (FunctionPosteriori != NULL)
+      FunctionPosteriori ();
+
+   /***** Store result and exit *****/
+   Lay_ShowErrorAndExit (NULL);
+  }
+
+/*****************************************************************************/
+/********************* Update the progress of a job **************************/
+/*****************************************************************************/
+// Called from long loops. Does nothing when not running in a worker
+
+void Job_UpdateProgress (unsigned long NumItemsDone,unsigned long NumItems)
+  {
+   char Query[128];
+   unsigned Progress;
+
+   if (Gbl.Job.IsWorker && Gbl.Job.JobCod > 0 && NumItems)
+     {
+      Progress = (unsigned) ((NumItemsDone * 100UL) / NumItems);
+
+      /***** Update database only when percentage changes *****/
+      if (Progress > Gbl.Job.Progress)
+	{
+	 Gbl.Job.Progress = Progress;
+	 sprintf (Query,"UPDATE jobs SET Progress=%u WHERE JobCod=%ld",
+		  Gbl.Job.Progress,Gbl.Job.JobCod);
+	 DB_QueryUPDATE (Query,"can not update progress of job");
+	}
+     }
+  }
+
+/*****************************************************************************/
+/******************** Store the result of the current job ********************/
+/*****************************************************************************/
+// Txt is the error message, or NULL if the job finished successfully
+
+void Job_EndWorker (const char *Txt)
+  {
+   char Query[256];
+   long JobCod;
+
+   /***** Write possible error message in result *****/
+   if (Txt)
+      Ale_ShowAlert (Ale_ERROR,Txt);
+
+   /***** Close the file with the result *****/
+   if (Gbl.F.Out != stdout)
+     {
+      fclose (Gbl.F.Out);
+      Gbl.F.Out = stdout;
+     }
+
+   /***** Store the final status of the job *****/
+   if ((JobCod = Gbl.Job.JobCod) > 0)
+     {
+      Gbl.Job.JobCod = -1L;	// Don't update again if an error happens here
+      sprintf (Query,"UPDATE jobs SET Status=%u,Progress=100,EndTime=NOW()"
+		     " WHERE JobCod=%ld",
+	       (unsigned) (Txt ? Job_FAILED :
+				 Job_DONE),
+	       JobCod);
+      DB_QueryUPDATE (Query,"can not update job");
+     }
+  }
+
+/*****************************************************************************/
+/****************** Build path to the directory of jobs **********************/
+/*****************************************************************************/
+
+static void Job_SetPathJobs (char PathJobs[PATH_MAX + 1])
+  {
+   sprintf (PathJobs,"%s/%s",
+	    Cfg_PATH_SWAD_PRIVATE,Cfg_FOLDER_JOB);
+  }
+
+/*****************************************************************************/
+/************* Build the name of the file with the result of a job ***********/
+/*****************************************************************************/
+
+static void Job_SetFileNameResult (long JobCod,char FileNameResult[PATH_MAX + 1])
+  {
+   char PathJobs[PATH_MAX + 1];
+
+   Job_SetPathJobs (PathJobs);
+   if (snprintf (FileNameResult,PATH_MAX + 1,"%s/%ld.html",
+		 PathJobs,JobCod) > PATH_MAX)
+      Lay_ShowErrorAndExit ("Path to result of job is too long.");
+  }
+
+/*****************************************************************************/
+/**************** Create the file for the result of a job ********************/
+/*****************************************************************************/
+
+static void Job_CreateFileForResult (void)
+  {
+   char PathJobs[PATH_MAX + 1];
+   char FileNameResult[PATH_MAX + 1];
+   FILE *FileResult;
+
+   /***** Create directory for jobs if not exists *****/
+   Job_SetPathJobs (PathJobs);
+   Fil_CreateDirIfNotExists (PathJobs);
+
+   /***** Open file for writing *****/
+   Job_SetFileNameResult (Gbl.Job.JobCod,FileNameResult);
+   if ((FileResult = fopen (FileNameResult,"wb")) == NULL)
+      Lay_ShowErrorAndExit ("Can not create file for the result of the job.");
+   Gbl.F.Out = FileResult;
+  }
+
+/*****************************************************************************/
+/********************** Get a job requested by me ****************************/
+/*****************************************************************************/
+
+void Job_GetJob (void)
+  {
+   /***** Get job code *****/
+   Gbl.Job.JobCod = Par_GetParToLong ("JobCod");
+
+   /***** Get data of the job *****/
+   Job_GetDataOfMyJob ();
+  }
+
+/*****************************************************************************/
+/*************** Get data of a job requested by me from database *************/
+/*****************************************************************************/
+// If the job does not exist or it was not requested by me, JobCod = -1
+
+static bool Job_GetDataOfMyJob (void)
+  {
+   char Query[256];
+   MYSQL_RES *mysql_res;
+   MYSQL_ROW row;
+   bool JobFound = false;
+   unsigned UnsignedNum;
+
+   if (Gbl.Job.JobCod > 0)
+     {
+      /***** Get data of the job *****/
+      sprintf (Query,"SELECT Status,Progress FROM jobs"
+		     " WHERE JobCod=%ld AND UsrCod=%ld",
+	       Gbl.Job.JobCod,Gbl.Usrs.Me.UsrDat.UsrCod);
+      if (DB_QuerySELECT (Query,&mysql_res,"can not get job"))
+	{
+	 JobFound = true;
+	 row = mysql_fetch_row (mysql_res);
+
+	 /* Get status (row[0]) */
+	 Gbl.Job.Status = Job_FAILED;
+	 if (sscanf (row[0],"%u",&UnsignedNum) == 1)
+	    if (UnsignedNum < Job_NUM_STATUS)
+	       Gbl.Job.Status = (Job_Status_t) UnsignedNum;
+
+	 /* Get progress (row[1]) */
+	 if (sscanf (row[1],"%u",&Gbl.Job.Progress) != 1)
+	    Gbl.Job.Progress = 0;
+	}
+
+      /***** Free structure that stores the query result *****/
+      DB_FreeMySQLResult (&mysql_res);
+     }
+
+   if (!JobFound)
+      Gbl.Job.JobCod = -1L;
+
+   return JobFound;
+  }
+
+/*****************************************************************************/
+/******************** Check if the current job is finished *******************/
+/*****************************************************************************/
+
+static bool Job_CheckIfJobIsFinished (void)
+  {
+   return Gbl.Job.Status == Job_DONE ||
+	  Gbl.Job.Status == Job_FAILED;
+  }
+
+/*****************************************************************************/
+/************ Show the status of a job and its result if finished ************/
+/*****************************************************************************/
+
+void Job_ShowJob (void)
+  {
+   if (Gbl.Job.JobCod <= 0)
+      Lay_ShowErrorAndExit ("Job not found.");
+
+   /***** Show status of the job *****/
+   Job_ShowJobStatus ();
+
+   /***** Show result of the job *****/
+   if (Job_CheckIfJobIsFinished ())
+      Job_ShowJobResult ();
+  }
+
+/*****************************************************************************/
+/*********** Refresh status of a job via AJAX until it is finished ***********/
+/*****************************************************************************/
+
+void Job_RefreshJob (void)
+  {
+   if (Gbl.Session.IsOpen)	// If session has been closed, do not write anything
+     {
+      /***** Get job *****/
+      Job_GetJob ();
+      if (Gbl.Job.JobCod > 0)
+	{
+	 /***** Send, before the HTML, the refresh time,
+		or 0 to stop refreshing when the job is finished *****/
+	 fprintf (Gbl.F.Out,"%lu|",
+		  Job_CheckIfJobIsFinished () ? 0UL :
+						(unsigned long) Cfg_TIME_TO_REFRESH_JOB);
+
+	 /***** Write status of the job *****/
+	 Job_WriteJobStatus ();
+	}
+     }
+
+   /***** All the output is made, so don't write anymore *****/
+   Gbl.Layout.DivsEndWritten = Gbl.Layout.HTMLEndWritten = true;
+  }
+
+/*****************************************************************************/
+/*************************** Show status of a job ****************************/
+/*****************************************************************************/
+
+static void Job_ShowJobStatus (void)
+  {
+   extern const char *Txt_Background_task;
+
+   /***** Start box *****/
+   Box_StartBox (NULL,Txt_Background_task,NULL,
+		 NULL,Box_NOT_CLOSABLE);
+
+   /***** Status of the job, to be refreshed via AJAX *****/
+   fprintf (Gbl.F.Out,"<div id=\"job_status\" class=\"CENTER_MIDDLE\">");
+   Job_WriteJobStatus ();
+   fprintf (Gbl.F.Out,"</div>");
+
+   /***** End box *****/
+   Box_EndBox ();
+  }
+
+/*****************************************************************************/
+/*************************** Write status of a job ***************************/
+/*****************************************************************************/
+
+static void Job_WriteJobStatus (void)
+  {
+   extern const char *Txt_JOB_STATUS[Job_NUM_STATUS];
+   extern const char *Txt_See_result;
+
+   if (Job_CheckIfJobIsFinished ())
+     {
+      fprintf (Gbl.F.Out,"<span class=\"DAT\">%s</span>",
+	       Txt_JOB_STATUS[Gbl.Job.Status]);
+
+      /***** When refreshing, put button to see the result *****/
+      if (Gbl.Action.UsesAJAX)
+	{
+	 Act_FormStart (ActSeeJob);
+	 Par_PutHiddenParamLong ("JobCod",Gbl.Job.JobCod);
+	 Btn_PutConfirmButton (Txt_See_result);
+	 Act_FormEnd ();
+	}
+     }
+   else
+      fprintf (Gbl.F.Out,"<img src=\"%s/working16x16.gif\""
+	                 " alt=\"%s\" title=\"%s\""
+			 " class=\"ICO20x20\" />"
+	                 "<span class=\"DAT\">&nbsp;%s (%u%%)</span>",
+	       Gbl.Prefs.IconsURL,
+	       Txt_JOB_STATUS[Gbl.Job.Status],
+	       Txt_JOB_STATUS[Gbl.Job.Status],
+	       Txt_JOB_STATUS[Gbl.Job.Status],
+	       Gbl.Job.Progress);
+  }
+
+/*****************************************************************************/
+/*************************** Show result of a job ****************************/
+/*****************************************************************************/
+
+static void Job_ShowJobResult (void)
+  {
+   char FileNameResult[PATH_MAX + 1];
+   FILE *FileResult;
+
+   /***** Copy the HTML generated by the job into the page *****/
+   Job_SetFileNameResult (Gbl.Job.JobCod,FileNameResult);
+   if ((FileResult = fopen (FileNameResult,"rb")) != NULL)
+     {
+      Fil_FastCopyOfOpenFiles (FileResult,Gbl.F.Out);
+      fclose (FileResult);
+     }
+  }
@@ -0,0 +1,66 @@
+// swad_job.h: actions executed in background
+
+#ifndef _SWAD_JOB
+#define _SWAD_JOB
+/*
+    SWAD (Shared Workspace At a Distance in Spanish),
+    is a web platform developed at the University of Granada (Spain),
+    and used to support university teaching.
+
+    This file is part of SWAD core.
+    Copyright (C) 1999-2018 Antonio Caas Vargas
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as
+    published by the Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.
+
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/*****************************************************************************/
+/********************************** Headers **********************************/
+/*****************************************************************************/
+
+#include "swad_action.h"
+
+/*****************************************************************************/
+/****************************** Public constants *****************************/
+/*****************************************************************************/
+
+#define Job_WORKER_OPTION	"-job"	// Command line option to run swad as a worker
+
+/*****************************************************************************/
+/******************************** Public types *******************************/
+/*****************************************************************************/
+
+#define Job_NUM_STATUS 4
+typedef enum
+  {
+   Job_PENDING = 0,	// Waiting for a worker
+   Job_RUNNING = 1,	// Being executed by a worker
+   Job_DONE    = 2,	// Finished successfully
+   Job_FAILED  = 3,	// Finished with an error
+  } Job_Status_t;
+
+/*****************************************************************************/
+/****************************** Public prototypes ****************************/
+/*****************************************************************************/
+
+bool Job_CheckIfActionRunsAsJob (Act_Action_t Action);
+void Job_LaunchJob (void);
+
+void Job_RunWorker (long JobCod);
+void Job_UpdateProgress (unsigned long NumItemsDone,unsigned long NumItems);
+void Job_EndWorker (const char *Txt);
+
+void Job_GetJob (void);
+void Job_ShowJob (void);
+void Job_RefreshJob (void);
+
+#endif
@@ -41,6 +41,8 @@
 #include "swad_global.h"
 #include "swad_help.h"
 #include "swad_hierarchy.h"
+#include "swad_info.h"
+#include "swad_job.h"
 #include "swad_language.h"
 #include "swad_logo.h"
 #include "swad_MFU.h"
@@ -67,14 +69,29 @@ extern struct Globals Gbl;
 /***************************** Private constants *****************************/
 /*****************************************************************************/
 
+#define Lay_MAX_BYTES_ETAG (128 - 1)
+
 /*****************************************************************************/
 /******************************* Private types *******************************/
 /*****************************************************************************/
 
+/*****************************************************************************/
+/***************************** Private variables *****************************/
+/*****************************************************************************/
+
+/* Validators of the current page, when it can be cached by the client */
+static bool Lay_PageIsCacheable = false;
+static time_t Lay_LastModifiedOfPage;	// (time_t) 0 if unknown
+static unsigned long Lay_HashOfPageData;	// Hash of the data shown in the page
+static char Lay_ETag[Lay_MAX_BYTES_ETAG + 1];
+static char Lay_LastModified[Fil_MAX_BYTES_HTTP_DATE + 1];
+
 /*****************************************************************************/
 /***************************** Private prototypes ****************************/
 /*****************************************************************************/
 
+static void Lay_AddHierarchyToPageValidator (void);
+
 static void Lay_WriteEndOfPage (void);
 
 static void Lay_WritePageTitle (void);
@@ -96,6 +113,7 @@ static void Lay_WriteTitleAction (void);
 static void Lay_ShowLeftColumn (void);
 static void Lay_ShowRightColumn (void);
 
+static void Lay_WriteEndOfHTTPHeader (void);
 static void Lay_WriteAboutZone (void);
 static void Lay_WriteFootFromHTMLFile (void);
 
@@ -147,9 +165,29 @@ void Lay_WriteStartOfPage (void)
    Gbl.Layout.WritingHTMLStart = true;
 
    /***** Write header to standard output to avoid timeout *****/
-   // Two \r\n are necessary
-   fprintf (stdout,"Content-type: text/html; charset=windows-1252\r\n\r\n"
-                   "<!DOCTYPE html>\n");
+   /* Validators used by the client to ask if the page has changed */
+   if (Lay_PageIsCacheable)
+     {
+      fprintf (stdout,"Cache-Control: no-cache\r\n"
+		      "ETag: %s\r\n",
+	       Lay_ETag);
+      if (Lay_LastModified[0])
+	 fprintf (stdout,"Last-Modified: %s\r\n",
+		  Lay_LastModified);
+     }
+
+   if (Gbl.F.Out != stdout)
+     {
+      /* The page is being written into the HTML output file
+         ==> end of header is written when the page is sent,
+             when its size is known and compression can be decided */
+      fprintf (stdout,"Content-type: text/html; charset=windows-1252\r\n");
+      Gbl.Layout.HTTPHeaderPending = true;
+     }
+   else
+      // Two \r\n are necessary
+      fprintf (stdout,"Content-type: text/html; charset=windows-1252\r\n\r\n");
+   fprintf (Gbl.F.Out,"<!DOCTYPE html>\n");
 
    /***** Write start of HTML code *****/
    // WARNING: It is necessary to comment the line 'AddDefaultCharset UTF8'
@@ -382,6 +420,140 @@ void Lay_WriteHTTPStatus204NoContent (void)
    fprintf (stdout,"Status: 204\r\n\r\n");
   }
 
+/*****************************************************************************/
+/********** Check if the copy of the page that the client has is valid *******/
+/*****************************************************************************/
+// Only pages shown to users not logged can be cached,
+// since the pages shown to logged users contain personal data.
+// Side columns (connected users, notices, banners...) change
+// independently of the page, so pages with side columns are not cached.
+// Each action declares in its validator function if its page can be cached
+
+bool Lay_CheckIfPageIsNotModified (void)
+  {
+   bool (*FunctionValidator) (void);
+
+   /***** Check if the page can be cached *****/
+   if (Gbl.Usrs.Me.Logged ||
+       Gbl.Action.UsesAJAX ||
+       Gbl.WebService.IsWebService ||
+       Gbl.Alert.Type != Ale_NONE ||	// Alert to be shown (for example, session expired)
+       Gbl.Prefs.SideCols ||		// Side columns visible
+       Act_GetBrowserTab (Gbl.Action.Act) != Act_BRW_1ST_TAB)
+      return false;
+
+   if ((FunctionValidator = Act_GetFunctionValidator (Gbl.Action.Act)) == NULL)
+      return false;
+
+   /***** Build validators *****/
+   /* Data shown in the page */
+   Lay_LastModifiedOfPage = (time_t) 0;
+   Lay_HashOfPageData = 5381;
+   if (!FunctionValidator ())
+      return false;
+
+   /* The page depends also on the current hierarchy (shown in heading),
+      on the preferences,
+      on the current date
+      and on the version of the platform (CSS, scripts...) */
+   Lay_AddHierarchyToPageValidator ();
+   Lay_AddStrToPageValidator (Log_PLATFORM_VERSION);
+   snprintf (Lay_ETag,sizeof (Lay_ETag),
+	     "W/\"%lx-%lx-%x%x%x%x-%s-%lx\"",
+	     (unsigned long) Lay_LastModifiedOfPage,
+	     (unsigned long) Act_GetActCod (Gbl.Action.Act),
+	     (unsigned) Gbl.Prefs.Language,
+	     (unsigned) Gbl.Prefs.Theme,
+	     (unsigned) Gbl.Prefs.IconSet,
+	     (unsigned) Gbl.Prefs.Menu,
+	     Gbl.Now.Date.YYYYMMDD,
+	     Lay_HashOfPageData);
+   if (Lay_LastModifiedOfPage)
+      Fil_WriteHTTPDate (Lay_LastModifiedOfPage,Lay_LastModified);
+   else
+      Lay_LastModified[0] = '\0';
+   Lay_PageIsCacheable = true;
+
+   /***** Check if the client has an up-to-date copy of the page *****/
+   // Only the entity tag is checked, since the page depends on more than the date
+   return Fil_CheckIfFileIsNotModified (Lay_ETag,NULL);
+  }
+
+/*****************************************************************************/
+/********* Set time of last modification of the data shown in page ***********/
+/*****************************************************************************/
+// Called from validator functions of actions
+
+void Lay_SetLastModifiedOfPage (time_t LastModified)
+  {
+   if (LastModified > Lay_LastModifiedOfPage)
+      Lay_LastModifiedOfPage = LastModified;
+  }
+
+/*****************************************************************************/
+/************** Add data shown in page to the validator of page **************/
+/*****************************************************************************/
+// Called from validator functions of actions
+// when data shown have not time of last modification
+
+void Lay_AddNumToPageValidator (unsigned long Num)
+  {
+   Lay_HashOfPageData = Lay_HashOfPageData * 33 + Num;
+  }
+
+void Lay_AddStrToPageValidator (const char *Str)
+  {
+   while (*Str)
+      Lay_HashOfPageData = Lay_HashOfPageData * 33 + (unsigned char) *Str++;
+   Lay_HashOfPageData = Lay_HashOfPageData * 33;	// Separator between strings
+  }
+
+/*****************************************************************************/
+/************* Add current hierarchy to the validator of page ****************/
+/*****************************************************************************/
+
+static void Lay_AddHierarchyToPageValidator (void)
+  {
+   Lay_AddNumToPageValidator ((unsigned long) Gbl.CurrentCty.Cty.CtyCod);
+   Lay_AddStrToPageValidator (Gbl.CurrentCty.Cty.Name[Gbl.Prefs.Language]);
+
+   Lay_AddNumToPageValidator ((unsigned long) Gbl.CurrentIns.Ins.InsCod);
+   Lay_AddStrToPageValidator (Gbl.CurrentIns.Ins.ShrtName);
+   Lay_AddStrToPageValidator (Gbl.CurrentIns.Ins.FullName);
+
+   Lay_AddNumToPageValidator ((unsigned long) Gbl.CurrentCtr.Ctr.CtrCod);
+   Lay_AddStrToPageValidator (Gbl.CurrentCtr.Ctr.ShrtName);
+   Lay_AddStrToPageValidator (Gbl.CurrentCtr.Ctr.FullName);
+
+   Lay_AddNumToPageValidator ((unsigned long) Gbl.CurrentDeg.Deg.DegCod);
+   Lay_AddStrToPageValidator (Gbl.CurrentDeg.Deg.ShrtName);
+   Lay_AddStrToPageValidator (Gbl.CurrentDeg.Deg.FullName);
+
+   Lay_AddNumToPageValidator ((unsigned long) Gbl.CurrentCrs.Crs.CrsCod);
+   Lay_AddStrToPageValidator (Gbl.CurrentCrs.Crs.ShrtName);
+   Lay_AddStrToPageValidator (Gbl.CurrentCrs.Crs.FullName);
+  }
+
+/*****************************************************************************/
+/******************** Write HTTP Status 304 Not Modified *********************/
+/*****************************************************************************/
+
+void Lay_WriteHTTPStatus304NotModified (void)
+  {
+   /***** The HTTP response is a code status *****/
+   /* Don't write HTML at all */
+   Gbl.Layout.HTMLStartWritten =
+   Gbl.Layout.DivsEndWritten   =
+   Gbl.Layout.HTMLEndWritten   = true;
+
+   /* Return HTTP status code 304 Not Modified:
+      The client can use its cached copy of the page */
+   fprintf (stdout,"Status: 304 Not Modified\r\n"
+		   "Cache-Control: no-cache\r\n"
+		   "ETag: %s\r\n\r\n",
+	    Lay_ETag);
+  }
+
 /*****************************************************************************/
 /************************ Write the end of the page **************************/
 /*****************************************************************************/
@@ -707,6 +879,13 @@ static void Lay_WriteScriptInit (void)
 	 default:
 	    break;
         }
+   if (Gbl.Job.JobCod > 0 &&
+       (Gbl.Job.Status == Job_PENDING ||
+	Gbl.Job.Status == Job_RUNNING))
+      // Refresh status of job via AJAX
+      fprintf (Gbl.F.Out,"	setTimeout(\"refreshJob()\",%lu);\n",
+	       Cfg_TIME_TO_REFRESH_JOB);
+
    // fprintf (Gbl.F.Out,"	document.getElementById('whole_page').style.opacity='1';\n");
    fprintf (Gbl.F.Out,"}\n"
                       "</script>\n");
@@ -729,6 +908,13 @@ static void Lay_WriteScriptParamsAJAX (void)
    fprintf (Gbl.F.Out,"var RefreshParamNxtActLog = \"act=%ld\";\n",
             Act_GetActCod (ActRefLstClk));
 
+   /***** Parameter to refresh the status of a job executed in background *****/
+   if (Gbl.Job.JobCod > 0)
+      fprintf (Gbl.F.Out,"var RefreshParamNxtActJob = \"act=%ld\";\n"
+			 "var RefreshParamJobCod = \"JobCod=%ld\";\n",
+	       Act_GetActCod (ActRefJob),
+	       Gbl.Job.JobCod);
+
    /***** Parameters related with expanding/contracting folders in file browsers *****/
    if (Gbl.FileBrowser.Type != Brw_UNKNOWN)
       /* In all the actions related to file browsers ==>
@@ -1206,6 +1392,17 @@ void Lay_ShowErrorAndExit (const char *Txt)
       mysql_query (&Gbl.mysql,"UNLOCK TABLES");
      }
 
+   /***** If running a job in background,
+          store its result instead of sending a page *****/
+   if (Gbl.Job.IsWorker)
+     {
+      Job_EndWorker (Txt);
+      Gbl_Cleanup ();
+      DB_CloseDBConnection ();
+      exit (Txt ? 1 :
+		  0);
+     }
+
    if (!Gbl.WebService.IsWebService)
      {
       /****** If start of page is not written yet, do it now ******/
@@ -1225,8 +1422,7 @@ void Lay_ShowErrorAndExit (const char *Txt)
 
    /***** Page is generated (except </body> and </html>).
           Compute time to generate page *****/
-   if (!Gbl.Action.IsAJAXAutoRefresh)
-      Sta_ComputeTimeToGeneratePage ();
+   Sta_ComputeTimeToGeneratePage ();
 
    if (Gbl.WebService.IsWebService)		// Serving a plugin request
      {
@@ -1236,25 +1432,25 @@ void Lay_ShowErrorAndExit (const char *Txt)
      }
    else
      {
+      /***** End HTTP header, compressing the page if it's worth *****/
+      Lay_WriteEndOfHTTPHeader ();
+
       /***** Send page.
              The HTML output is now in Gbl.F.Out file ==>
              ==> copy it to standard output *****/
       rewind (Gbl.F.Out);
-      Fil_FastCopyOfOpenFiles (Gbl.F.Out,stdout);
+      Fil_FastCopyOfOpenFiles (Gbl.F.Out,Gbl.F.Std);
       Fil_CloseAndRemoveFileForHTMLOutput ();
 
+      /***** Compute time to send page *****/
+      Sta_ComputeTimeToSendPage ();
+
       if (!Gbl.Action.IsAJAXAutoRefresh)
 	{
-	 /***** Compute time to send page *****/
-	 Sta_ComputeTimeToSendPage ();
-
-	 /***** Log access *****/
-	 Sta_LogAccess (Txt);
-
 	 /***** End the output *****/
 	 if (!Gbl.Layout.HTMLEndWritten)
 	   {
-	    // Here Gbl.F.Out is stdout
+	    // Here Gbl.F.Out is standard output (compressed or not)
 	    if (Act_GetBrowserTab (Gbl.Action.Act) == Act_BRW_1ST_TAB)
 	       Lay_WriteAboutZone ();
 
@@ -1263,6 +1459,16 @@ void Lay_ShowErrorAndExit (const char *Txt)
 	    Gbl.Layout.HTMLEndWritten = true;
 	   }
 	}
+
+      /***** End compression of output (if compressed) *****/
+      // Bytes sent are known after ending compression
+      Fil_EndCompressedOutput ();
+
+      /***** Log access *****/
+      if (Gbl.Action.IsAJAXAutoRefresh)
+	 Sta_LogRefresh ();
+      else
+	 Sta_LogAccess (Txt);
      }
 
    /***** Close database connection *****/
@@ -1274,6 +1480,37 @@ void Lay_ShowErrorAndExit (const char *Txt)
    exit (0);
   }
 
+/*****************************************************************************/
+/********* Write the end of the HTTP header just before sending page *********/
+/*****************************************************************************/
+// The page is in Gbl.F.Out file, so its size is known here
+
+static void Lay_WriteEndOfHTTPHeader (void)
+  {
+   long PageBytes;
+
+   if (!Gbl.Layout.HTTPHeaderPending)
+      return;
+
+   /***** Get size of the page *****/
+   if ((PageBytes = ftell (Gbl.F.Out)) < 0)
+      PageBytes = 0;
+   Gbl.HTMLOutput.PageBytes =
+   Gbl.HTMLOutput.SentBytes = (unsigned long) PageBytes;
+
+   /***** Compress the page only if it's big enough
+          and the client accepts it *****/
+   if (Gbl.HTMLOutput.PageBytes >= Cfg_MIN_BYTES_TO_COMPRESS_OUTPUT &&
+       Fil_CheckIfClientAcceptsGzip ())
+      if (Fil_StartCompressedOutput ())
+	 fprintf (stdout,"Content-Encoding: gzip\r\n"
+			 "Vary: Accept-Encoding\r\n");
+
+   /***** End of header (an empty line) *****/
+   fprintf (stdout,"\r\n");
+   Gbl.Layout.HTTPHeaderPending = false;
+  }
+
 /*****************************************************************************/
 /***************** Write about zone at the end of the page *******************/
 /*****************************************************************************/
@@ -1344,7 +1581,10 @@ void Lay_RefreshNotifsAndConnected (void)
    else if (!(Gbl.PID % 1019))	// Do this only one of 1019 times (1019 is prime)
       Pre_RemoveOldPrefsFromIP ();		// Remove old preferences from IP
    else if (!(Gbl.PID % 1021))	// Do this only one of 1021 times (1021 is prime)
-      Sta_RemoveOldEntriesRecentLog ();		// Remove old entries in recent log table, it's a slow query
+      Sta_RotateLogTables ();			// Remove old entries in recent log table and add new partitions to log tables
+
+   // Get number of sessions (used to compute the refresh time)
+   Ses_GetNumSessions ();
 
    // Send, before the HTML, the refresh time
    fprintf (Gbl.F.Out,"%lu|",Gbl.Usrs.Connected.TimeToRefreshInMs);
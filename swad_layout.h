@@ -27,6 +27,8 @@
 /********************************* Headers ***********************************/
 /*****************************************************************************/
 
+#include <time.h>		// For time_t
+
 #include "swad_action.h"
 
 /*****************************************************************************/
@@ -51,6 +53,11 @@
 void Lay_WriteStartOfPage (void);
 
 void Lay_WriteHTTPStatus204NoContent (void);
+bool Lay_CheckIfPageIsNotModified (void);
+void Lay_SetLastModifiedOfPage (time_t LastModified);
+void Lay_AddNumToPageValidator (unsigned long Num);
+void Lay_AddStrToPageValidator (const char *Str);
+void Lay_WriteHTTPStatus304NotModified (void);
 
 void Lay_PutContextualLink (Act_Action_t NextAction,const char *Anchor,
                             void (*FuncParams) (),
@@ -25,11 +25,14 @@
 /*********************************** Headers *********************************/
 /*****************************************************************************/
 
+#include <stdlib.h>		// For malloc, realloc, free, bsearch
 #include <string.h>		// For string functions
 
 #include "swad_action.h"
 #include "swad_box.h"
+#include "swad_database.h"
 #include "swad_global.h"
+#include "swad_logo.h"
 #include "swad_scope.h"
 #include "swad_theme.h"
 
@@ -41,10 +44,35 @@
 /***************************** Internal constants ****************************/
 /*****************************************************************************/
 
+static const char *Log_Folder[Sco_NUM_SCOPES] =
+  {
+   NULL,		// Sco_SCOPE_UNK
+   NULL,		// Sco_SCOPE_SYS
+   NULL,		// Sco_SCOPE_CTY
+   Cfg_FOLDER_INS,	// Sco_SCOPE_INS
+   Cfg_FOLDER_CTR,	// Sco_SCOPE_CTR
+   Cfg_FOLDER_DEG,	// Sco_SCOPE_DEG
+   NULL,		// Sco_SCOPE_CRS
+  };
+
 /*****************************************************************************/
 /****************************** Internal types *******************************/
 /*****************************************************************************/
 
+struct Log_Logo
+  {
+   long Cod;		// Institution, centre or degree code
+   bool LogoExists;
+  };
+
+struct Log_LogoCache	// Logos of a scope known in this process
+  {
+   bool Loaded;		// Has the manifest of this scope been read from database?
+   unsigned Num;	// Number of logos in list
+   unsigned Size;	// Number of logos allocated in list
+   struct Log_Logo *Lst;	// List sorted by code
+  };
+
 /*****************************************************************************/
 /************** External global variables from others modules ****************/
 /*****************************************************************************/
@@ -55,10 +83,18 @@ extern struct Globals Gbl;
 /************************* Internal global variables *************************/
 /*****************************************************************************/
 
+static struct Log_LogoCache Log_Cache[Sco_NUM_SCOPES];
+
 /*****************************************************************************/
 /***************************** Internal prototypes ***************************/
 /*****************************************************************************/
 
+static void Log_LoadLogoCache (Sco_Scope_t Scope);
+static struct Log_Logo *Log_GetLogoFromCache (Sco_Scope_t Scope,long Cod);
+static int Log_CompareLogos (const void *Key,const void *Logo);
+static void Log_SetLogoInCache (Sco_Scope_t Scope,long Cod,bool LogoExists);
+static void Log_SetLogoInManifest (Sco_Scope_t Scope,long Cod,bool LogoExists);
+
 /*****************************************************************************/
 /****************************** Draw degree logo *****************************/
 /*****************************************************************************/
@@ -77,7 +113,6 @@ void Log_DrawLogo (Sco_Scope_t Scope,long Cod,const char *AltText,
       NULL,		// Sco_SCOPE_CRS
      };
    const char *Folder = NULL;	// To avoid warning
-   char PathLogo[PATH_MAX + 1];
    bool LogoFound = false;
    long InsCod;
    long CtrCod;
@@ -93,12 +128,7 @@ void Log_DrawLogo (Sco_Scope_t Scope,long Cod,const char *AltText,
 	   {
 	    Folder = Cfg_FOLDER_DEG;
 	    DegCod = Cod;
-	    sprintf (PathLogo,"%s/%s/%02u/%u/logo/%u.png",
-		     Cfg_PATH_SWAD_PUBLIC,Folder,
-		     (unsigned) (DegCod % 100),
-		     (unsigned) DegCod,
-		     (unsigned) DegCod);
-	    LogoFound = Fil_CheckIfPathExists (PathLogo);
+	    LogoFound = Log_CheckIfLogoExists (Sco_SCOPE_DEG,DegCod);
 	    if (LogoFound)
 	       Cod = DegCod;
 	   }
@@ -111,12 +141,7 @@ void Log_DrawLogo (Sco_Scope_t Scope,long Cod,const char *AltText,
 	       CtrCod = Deg_GetCtrCodOfDegreeByCod (Cod);
 	    else
 	       CtrCod = Cod;
-	    sprintf (PathLogo,"%s/%s/%02u/%u/logo/%u.png",
-		     Cfg_PATH_SWAD_PUBLIC,Folder,
-		     (unsigned) (CtrCod % 100),
-		     (unsigned) CtrCod,
-		     (unsigned) CtrCod);
-	    LogoFound = Fil_CheckIfPathExists (PathLogo);
+	    LogoFound = Log_CheckIfLogoExists (Sco_SCOPE_CTR,CtrCod);
 	    if (LogoFound)
 	       Cod = CtrCod;
 	   }
@@ -131,12 +156,7 @@ void Log_DrawLogo (Sco_Scope_t Scope,long Cod,const char *AltText,
 	       InsCod = Ctr_GetInsCodOfCentreByCod (Cod);
 	    else
 	       InsCod = Cod;
-	    sprintf (PathLogo,"%s/%s/%02u/%u/logo/%u.png",
-		     Cfg_PATH_SWAD_PUBLIC,Folder,
-		     (unsigned) (InsCod % 100),
-		     (unsigned) InsCod,
-		     (unsigned) InsCod);
-	    LogoFound = Fil_CheckIfPathExists (PathLogo);
+	    LogoFound = Log_CheckIfLogoExists (Sco_SCOPE_INS,InsCod);
 	    if (LogoFound)
 	       Cod = InsCod;
 	   }
@@ -179,8 +199,6 @@ void Log_PutIconToChangeLogo (Sco_Scope_t Scope)
    extern const char *Txt_Upload_logo;
    Act_Action_t Action;
    long Cod;
-   const char *Folder;
-   char PathLogo[PATH_MAX + 1];
    bool LogoExists;
 
    /***** Set variables depending on scope *****/
@@ -189,29 +207,21 @@ void Log_PutIconToChangeLogo (Sco_Scope_t Scope)
       case Sco_SCOPE_INS:
 	 Action = ActReqInsLog;
 	 Cod = Gbl.CurrentIns.Ins.InsCod;
-	 Folder = Cfg_FOLDER_INS;
 	 break;
       case Sco_SCOPE_CTR:
 	 Action = ActReqCtrLog;
 	 Cod = Gbl.CurrentCtr.Ctr.CtrCod;
-	 Folder = Cfg_FOLDER_CTR;
 	 break;
       case Sco_SCOPE_DEG:
 	 Action = ActReqDegLog;
 	 Cod = Gbl.CurrentDeg.Deg.DegCod;
-	 Folder = Cfg_FOLDER_DEG;
 	 break;
       default:
 	 return;	// Nothing to do
      }
 
    /***** Check if logo exists *****/
-   sprintf (PathLogo,"%s/%s/%02u/%u/logo/%u.png",
-	    Cfg_PATH_SWAD_PUBLIC,Folder,
-	    (unsigned) (Cod % 100),
-	    (unsigned) Cod,
-	    (unsigned) Cod);
-   LogoExists = Fil_CheckIfPathExists (PathLogo);
+   LogoExists = Log_CheckIfLogoExists (Scope,Cod);
 
    /***** Link for changing / uploading the logo *****/
    Lay_PutContextualLink (Action,NULL,NULL,
@@ -233,29 +243,24 @@ void Log_RequestLogo (Sco_Scope_t Scope)
    extern const char *Txt_You_can_send_a_file_with_an_image_in_PNG_format_transparent_background_and_size_X_Y;
    extern const char *Txt_File_with_the_logo;
    long Cod;
-   const char *Folder;
    Act_Action_t ActionRec;
    Act_Action_t ActionRem;
-   char PathLogo[PATH_MAX + 1];
 
    /***** Set action depending on scope *****/
    switch (Scope)
      {
       case Sco_SCOPE_INS:
 	 Cod = Gbl.CurrentIns.Ins.InsCod;
-	 Folder = Cfg_FOLDER_INS;
 	 ActionRec = ActRecInsLog;
 	 ActionRem = ActRemInsLog;
 	 break;
       case Sco_SCOPE_CTR:
 	 Cod = Gbl.CurrentCtr.Ctr.CtrCod;
-	 Folder = Cfg_FOLDER_CTR;
 	 ActionRec = ActRecCtrLog;
 	 ActionRem = ActRemCtrLog;
 	 break;
       case Sco_SCOPE_DEG:
 	 Cod = Gbl.CurrentDeg.Deg.DegCod;
-	 Folder = Cfg_FOLDER_DEG;
 	 ActionRec = ActRecDegLog;
 	 ActionRem = ActRemDegLog;
 	 break;
@@ -264,12 +269,7 @@ void Log_RequestLogo (Sco_Scope_t Scope)
      }
 
    /***** Check if logo exists *****/
-   sprintf (PathLogo,"%s/%s/%02u/%u/logo/%u.png",
-	    Cfg_PATH_SWAD_PUBLIC,Folder,
-	    (unsigned) (Cod % 100),
-	    (unsigned) Cod,
-	    (unsigned) Cod);
-   if (Fil_CheckIfPathExists (PathLogo))
+   if (Log_CheckIfLogoExists (Scope,Cod))
      {
       /***** Form to remove photo *****/
       fprintf (Gbl.F.Out,"<div class=\"CENTER_MIDDLE\">");
@@ -388,7 +388,10 @@ void Log_ReceiveLogo (Sco_Scope_t Scope)
 	       (unsigned) (Cod % 100),
 	       (unsigned) Cod,
 	       (unsigned) Cod);
-      if (!Fil_EndReceptionOfFile (FileNameLogo,Param))
+      if (Fil_EndReceptionOfFile (FileNameLogo,Param))
+	 /* Update manifest of logos */
+	 Log_SetLogoInManifest (Scope,Cod,true);
+      else
 	 Ale_ShowAlert (Ale_WARNING,"Error copying file.");
      }
   }
@@ -429,4 +432,215 @@ void Log_RemoveLogo (Sco_Scope_t Scope)
 	    (unsigned) Cod,
 	    (unsigned) Cod);
    Fil_RemoveTree (FileNameLogo);
+
+   /***** Update manifest of logos *****/
+   Log_SetLogoInManifest (Scope,Cod,false);
+  }
+
+/*****************************************************************************/
+/****** Remove the logo of an institution, centre or degree from manifest ****/
+/*****************************************************************************/
+
+void Log_RemoveLogoFromManifest (Sco_Scope_t Scope,long Cod)
+  {
+   extern const char *Sco_ScopeDB[Sco_NUM_SCOPES];
+   char Query[128];
+
+   /***** Remove logo from database *****/
+   sprintf (Query,"DELETE FROM logos WHERE Scope='%s' AND Cod=%ld",
+	    Sco_ScopeDB[Scope],Cod);
+   DB_QueryDELETE (Query,"can not remove logo from manifest");
+
+   /***** Update cache *****/
+   Log_SetLogoInCache (Scope,Cod,false);
+  }
+
+/*****************************************************************************/
+/************************* Free cache of known logos *************************/
+/*****************************************************************************/
+
+void Log_FreeLogoCache (void)
+  {
+   Sco_Scope_t Scope;
+
+   for (Scope = (Sco_Scope_t) 0;
+	Scope < Sco_NUM_SCOPES;
+	Scope++)
+     {
+      if (Log_Cache[Scope].Lst)
+	{
+	 free ((void *) Log_Cache[Scope].Lst);
+	 Log_Cache[Scope].Lst = NULL;
+	}
+      Log_Cache[Scope].Num = Log_Cache[Scope].Size = 0;
+      Log_Cache[Scope].Loaded = false;
+     }
+  }
+
+/*****************************************************************************/
+/******** Check if the logo of an institution, centre or degree exists *******/
+/*****************************************************************************/
+// The manifest of logos is read from database only once per scope,
+// so lists of institutions, centres or degrees don't access the filesystem.
+// Only logos not yet in manifest are checked in the filesystem
+
+bool Log_CheckIfLogoExists (Sco_Scope_t Scope,long Cod)
+  {
+   struct Log_Logo *Logo;
+   char PathLogo[PATH_MAX + 1];
+   bool LogoExists;
+
+   /***** Get logo from cache *****/
+   if (!Log_Cache[Scope].Loaded)
+      Log_LoadLogoCache (Scope);
+   if ((Logo = Log_GetLogoFromCache (Scope,Cod)))
+      return Logo->LogoExists;
+
+   /***** Logo not in manifest ==> check if file exists *****/
+   sprintf (PathLogo,"%s/%s/%02u/%u/logo/%u.png",
+	    Cfg_PATH_SWAD_PUBLIC,Log_Folder[Scope],
+	    (unsigned) (Cod % 100),
+	    (unsigned) Cod,
+	    (unsigned) Cod);
+   LogoExists = Fil_CheckIfPathExists (PathLogo);
+
+   /***** Add logo to manifest *****/
+   Log_SetLogoInManifest (Scope,Cod,LogoExists);
+
+   return LogoExists;
+  }
+
+/*****************************************************************************/
+/**************** Load the manifest of logos of a scope in cache *************/
+/*****************************************************************************/
+
+static void Log_LoadLogoCache (Sco_Scope_t Scope)
+  {
+   extern const char *Sco_ScopeDB[Sco_NUM_SCOPES];
+   char Query[128];
+   MYSQL_RES *mysql_res;
+   MYSQL_ROW row;
+   unsigned long NumRows;
+   unsigned long NumRow;
+
+   /***** Get logos of this scope from database *****/
+   sprintf (Query,"SELECT Cod,LogoExists FROM logos"
+		  " WHERE Scope='%s' ORDER BY Cod",
+	    Sco_ScopeDB[Scope]);
+   NumRows = DB_QuerySELECT (Query,&mysql_res,"can not get logos");
+
+   /***** Create list sorted by code *****/
+   Log_Cache[Scope].Loaded = true;
+   Log_Cache[Scope].Num = 0;
+   Log_Cache[Scope].Size = (unsigned) NumRows;
+   Log_Cache[Scope].Lst = NULL;
+   if (NumRows)
+     {
+      if ((Log_Cache[Scope].Lst = (struct Log_Logo *) malloc (NumRows *
+	                                                      sizeof (struct Log_Logo))) == NULL)
+	 Lay_ShowErrorAndExit ("Not enough memory to store logos.");
+
+      for (NumRow = 0;
+	   NumRow < NumRows;
+	   NumRow++)
+	{
+	 row = mysql_fetch_row (mysql_res);
+
+	 /* Get code (row[0]) and if logo exists (row[1]) */
+	 Log_Cache[Scope].Lst[NumRow].Cod = Str_ConvertStrCodToLongCod (row[0]);
+	 Log_Cache[Scope].Lst[NumRow].LogoExists = (row[1][0] == 'Y');
+	}
+      Log_Cache[Scope].Num = (unsigned) NumRows;
+     }
+
+   /***** Free structure that stores the query result *****/
+   DB_FreeMySQLResult (&mysql_res);
+  }
+
+/*****************************************************************************/
+/************************* Search a logo in cache ****************************/
+/*****************************************************************************/
+// Return NULL if not found
+
+static struct Log_Logo *Log_GetLogoFromCache (Sco_Scope_t Scope,long Cod)
+  {
+   if (!Log_Cache[Scope].Num)
+      return NULL;
+
+   return (struct Log_Logo *) bsearch (&Cod,Log_Cache[Scope].Lst,
+				       (size_t) Log_Cache[Scope].Num,
+				       sizeof (struct Log_Logo),
+				       Log_CompareLogos);
+  }
+
+static int Log_CompareLogos (const void *Key,const void *Logo)
+  {
+   long Cod = *((const long *) Key);
+   long LogoCod = ((const struct Log_Logo *) Logo)->Cod;
+
+   return Cod < LogoCod ? -1 :
+	  (Cod > LogoCod ? 1 :
+			   0);
+  }
+
+/*****************************************************************************/
+/************** Set if the logo exists in cache, keeping order ***************/
+/*****************************************************************************/
+
+static void Log_SetLogoInCache (Sco_Scope_t Scope,long Cod,bool LogoExists)
+  {
+   struct Log_Logo *Logo;
+   unsigned NumLogo;
+
+   /***** If cache is not loaded, it will be read later from database *****/
+   if (!Log_Cache[Scope].Loaded)
+      return;
+
+   /***** If logo is already in cache, update it *****/
+   if ((Logo = Log_GetLogoFromCache (Scope,Cod)))
+     {
+      Logo->LogoExists = LogoExists;
+      return;
+     }
+
+   /***** Allocate space for one more logo *****/
+   if (Log_Cache[Scope].Num == Log_Cache[Scope].Size)
+     {
+      Log_Cache[Scope].Size = Log_Cache[Scope].Size ? Log_Cache[Scope].Size * 2 :
+	                                               16;
+      if ((Log_Cache[Scope].Lst = (struct Log_Logo *) realloc (Log_Cache[Scope].Lst,
+							       Log_Cache[Scope].Size *
+							       sizeof (struct Log_Logo))) == NULL)
+	 Lay_ShowErrorAndExit ("Not enough memory to store logos.");
+     }
+
+   /***** Insert logo keeping the list sorted by code *****/
+   for (NumLogo = Log_Cache[Scope].Num;
+	NumLogo > 0 && Log_Cache[Scope].Lst[NumLogo - 1].Cod > Cod;
+	NumLogo--)
+      Log_Cache[Scope].Lst[NumLogo] = Log_Cache[Scope].Lst[NumLogo - 1];
+   Log_Cache[Scope].Lst[NumLogo].Cod = Cod;
+   Log_Cache[Scope].Lst[NumLogo].LogoExists = LogoExists;
+   Log_Cache[Scope].Num++;
+  }
+
+/*****************************************************************************/
+/************* Set if the logo exists in manifest and in cache ***************/
+/*****************************************************************************/
+
+static void Log_SetLogoInManifest (Sco_Scope_t Scope,long Cod,bool LogoExists)
+  {
+   extern const char *Sco_ScopeDB[Sco_NUM_SCOPES];
+   char Query[128];
+
+   /***** Replace logo in database *****/
+   sprintf (Query,"REPLACE INTO logos (Scope,Cod,LogoExists)"
+		  " VALUES ('%s',%ld,'%c')",
+	    Sco_ScopeDB[Scope],Cod,
+	    LogoExists ? 'Y' :
+			 'N');
+   DB_QueryREPLACE (Query,"can not update logo in manifest");
+
+   /***** Update cache *****/
+   Log_SetLogoInCache (Scope,Cod,LogoExists);
   }
@@ -45,5 +45,8 @@ void Log_PutIconToChangeLogo (Sco_Scope_t Scope);
 void Log_RequestLogo (Sco_Scope_t Scope);
 void Log_ReceiveLogo (Sco_Scope_t Scope);
 void Log_RemoveLogo (Sco_Scope_t Scope);
+void Log_RemoveLogoFromManifest (Sco_Scope_t Scope,long Cod);
+void Log_FreeLogoCache (void);
+bool Log_CheckIfLogoExists (Sco_Scope_t Scope,long Cod);
 
 #endif
@@ -36,9 +36,11 @@
 #include "swad_database.h"
 #include "swad_global.h"
 #include "swad_hierarchy.h"
+#include "swad_job.h"
 #include "swad_MFU.h"
 #include "swad_parameter.h"
 #include "swad_preference.h"
+#include "swad_session.h"
 #include "swad_notification.h"
 
 /*****************************************************************************/
@@ -67,7 +69,7 @@ extern struct Globals Gbl;
 /****************************** Main function ********************************/
 /*****************************************************************************/
 
-int main (void)
+int main (int argc,char *argv[])
   {
    extern const char *Txt_You_dont_have_permission_to_perform_this_action;
    void (*FunctionPriori) (void);
@@ -104,6 +106,10 @@ int main (void)
    /***** Open database connection *****/
    DB_OpenDBConnection ();
 
+   /***** Execute a job in background if called as a worker *****/
+   if (argc == 3 && !strcmp (argv[1],Job_WORKER_OPTION))
+      Job_RunWorker (Str_ConvertStrCodToLongCod (argv[2]));	// Never returns
+
    /***** Read parameters *****/
    if (Par_GetQueryString ())
      {
@@ -122,22 +128,49 @@ int main (void)
 	 Con_RemoveOldConnected ();
 
 	 /***** Get number of sessions *****/
-	 if (Act_GetBrowserTab (Gbl.Action.Act) == Act_BRW_1ST_TAB)
+	 // Automatic refreshes get it only when needed
+	 if (Act_GetBrowserTab (Gbl.Action.Act) == Act_BRW_1ST_TAB &&
+	     !Gbl.Action.IsAJAXAutoRefresh)
 	    Ses_GetNumSessions ();
 
 	 /***** Check user and get user's data *****/
 	 Usr_ChkUsrAndGetUsrData ();
+
+	 /***** Update most frequently used actions and session *****/
+	 // Clicks not yet added to most frequently used actions are stored in session,
+	 // so both are written in database with only one query, if needed
+	 if (Gbl.Usrs.Me.Logged &&
+	     !Gbl.Action.IsAJAXAutoRefresh)
+	   {
+	    MFU_UpdateMFUActions ();
+	    Ses_UpdateSessionDataInDB ();
+	   }
 	}
 
       /***** Check if the user have permission to execute the action *****/
       if (!Act_CheckIfIHavePermissionToExecuteAction (Gbl.Action.Act))
 	 Lay_ShowErrorAndExit (Txt_You_dont_have_permission_to_perform_this_action);
 
-      /***** Update most frequently used actions *****/
-      MFU_UpdateMFUActions ();
+      /***** If the client has an up-to-date copy of the page,
+             don't generate it again *****/
+      if (Lay_CheckIfPageIsNotModified ())
+	{
+	 Lay_WriteHTTPStatus304NotModified ();
+	 Lay_ShowErrorAndExit (NULL);
+	}
 
       /***** Execute a function depending on the action *****/
-      FunctionPriori = Act_GetFunctionPriori (Gbl.Action.Act);
+      if (Job_CheckIfActionRunsAsJob (Gbl.Action.Act))
+	{
+	 // The action is executed by a worker in background
+	 FunctionPriori     = Job_LaunchJob;
+	 FunctionPosteriori = Job_ShowJob;
+	}
+      else
+	{
+	 FunctionPriori     = Act_GetFunctionPriori     (Gbl.Action.Act);
+	 FunctionPosteriori = Act_GetFunctionPosteriori (Gbl.Action.Act);
+	}
       if (FunctionPriori != NULL)
 	  FunctionPriori ();
 
@@ -149,7 +182,6 @@ int main (void)
       Lay_WriteStartOfPage ();
 
       /***** Make a processing or other depending on the action *****/
-      FunctionPosteriori = Act_GetFunctionPosteriori (Gbl.Action.Act);
       if (FunctionPosteriori != NULL)
 	  FunctionPosteriori ();
      }
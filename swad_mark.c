@@ -25,11 +25,14 @@
 /********************************** Headers **********************************/
 /*****************************************************************************/
 
+#include <fcntl.h>		// For open
 #include <linux/limits.h>	// For PATH_MAX
 #include <linux/stddef.h>	// For NULL
 #include <malloc.h>		// For malloc
+#include <stdlib.h>		// For strtol
 #include <string.h>		// For string functions
-#include <unistd.h>		// For unlink
+#include <sys/stat.h>		// For fstat
+#include <unistd.h>		// For unlink, pread
 
 #include "swad_database.h"
 #include "swad_global.h"
@@ -56,6 +59,39 @@ typedef enum
    Brw_FOOTER = 1,
   } Brw_HeadOrFoot_t;
 
+typedef enum
+  {
+   Mrk_NOT_INDEXED,	// The file of marks has no index (uploaded before indexes existed)
+   Mrk_USR_NOT_FOUND,
+   Mrk_USR_FOUND,
+  } Mrk_UsrInIndex_t;
+
+/* Each row of the table of marks is stored in the index
+   with the range of bytes from "<tr" to "</tr>" (both included)
+   and with an empty user's ID, and once more for each user's ID found in it.
+   The row number 0 stores the range of bytes inside the table,
+   from just after "<table ...>" to just before "</table>" */
+struct Mrk_RowInIndex
+  {
+   unsigned NumRow;
+   long StartPos;
+   long EndPos;
+   char UsrID[ID_MAX_BYTES_USR_ID + 1];
+  };
+
+struct Mrk_Index	// Index of the file of marks being checked in this process
+  {
+   unsigned Num;	// Number of entries in list
+   unsigned Size;	// Number of entries allocated in list
+   struct Mrk_RowInIndex *Lst;
+  };
+
+struct Mrk_Range	// Range of bytes in the file of marks
+  {
+   long Start;
+   long End;
+  };
+
 /*****************************************************************************/
 /**************************** Internal constants *****************************/
 /*****************************************************************************/
@@ -68,20 +104,56 @@ const char *Mrk_HeadOrFootStr[2] =	// Names of columns in database, so don't cha
 
 #define Mrk_MAX_BYTES_IN_CELL_CONTENT	1024	// Cell of a table containing one or several user's IDs
 
+#define Mrk_MAX_ROWS_IN_INDEX_PER_QUERY	100	// Entries of the index inserted in database in each query
+
+#define Mrk_NUM_RANGES_USR_MARKS	4	// Header, user's row, footer and end of file
+
+/*****************************************************************************/
+/************************* Internal global variables *************************/
+/*****************************************************************************/
+
+static struct Mrk_Index Mrk_IndexOfFile =
+  {
+   0,		// Num
+   0,		// Size
+   NULL,	// Lst
+  };
+
 /*****************************************************************************/
 /*************************** Internal prototypes *****************************/
 /*****************************************************************************/
 
 static void Mrk_GetNumRowsHeaderAndFooter (struct MarksProperties *Marks);
 static void Mrk_ChangeNumRowsHeaderOrFooter (Brw_HeadOrFoot_t HeaderOrFooter);
+static void Mrk_AddRowToIndex (FILE *FileAllMarks,unsigned NumRow,long StartPos,
+                               const char *CellContent);
+static void Mrk_AddEntryToIndex (unsigned NumRow,long StartPos,long EndPos,
+                                 const char *UsrID);
+static void Mrk_StoreIndexInDB (long FilCod);
 static bool Mrk_CheckIfCellContainsOnlyIDs (const char *CellContent);
-static bool Mrk_GetUsrMarks (FILE *FileUsrMarks,struct UsrData *UsrDat,
+static bool Mrk_GetUsrMarks (long FilCod,struct UsrData *UsrDat,
                              const char *PathFileAllMarks,
-                             struct MarksProperties *Marks);
+                             struct MarksProperties *Marks,
+                             char **UsrMarks,size_t *Length);
+static Mrk_UsrInIndex_t Mrk_GetUsrMarksFromIndex (long FilCod,struct UsrData *UsrDat,
+                                                  const char *PathFileAllMarks,
+                                                  struct MarksProperties *Marks,
+                                                  char **UsrMarks,size_t *Length);
+static bool Mrk_ReadRangesFromFile (const char *Path,
+                                    struct Mrk_Range Ranges[Mrk_NUM_RANGES_USR_MARKS],
+                                    char **Content,size_t *Length);
+static bool Mrk_GetUsrMarksFromFile (struct UsrData *UsrDat,
+                                     const char *PathFileAllMarks,
+                                     struct MarksProperties *Marks,
+                                     char **UsrMarks,size_t *Length);
+static bool Mrk_WriteUsrMarksFromFile (FILE *FileUsrMarks,struct UsrData *UsrDat,
+                                       const char *PathFileAllMarks,
+                                       struct MarksProperties *Marks);
 
 /*****************************************************************************/
 /****************** Add a new entry of marks into database *******************/
 /*****************************************************************************/
+// The index built when checking the file of marks is stored too
 
 void Mrk_AddMarksToDB (long FilCod,struct MarksProperties *Marks)
   {
@@ -98,6 +170,52 @@ void Mrk_AddMarksToDB (long FilCod,struct MarksProperties *Marks)
 	    Marks->Header,
 	    Marks->Footer);
    DB_QueryINSERT (Query,"can not add properties of marks to database");
+
+   /***** Add index of the file of marks to the database *****/
+   Mrk_StoreIndexInDB (FilCod);
+   Mrk_FreeIndexOfMarks ();
+  }
+
+/*****************************************************************************/
+/************** Store in database the index of a file of marks ***************/
+/*****************************************************************************/
+
+static void Mrk_StoreIndexInDB (long FilCod)
+  {
+   char Query[128 + Mrk_MAX_ROWS_IN_INDEX_PER_QUERY * (64 + ID_MAX_BYTES_USR_ID)];
+   char *Ptr;
+   unsigned NumEntry;
+   unsigned NumEntryInQuery;
+   struct Mrk_RowInIndex *Entry;
+
+   /***** Remove old index, if any *****/
+   sprintf (Query,"DELETE FROM marks_rows WHERE FilCod=%ld",
+	    FilCod);
+   DB_QueryDELETE (Query,"can not remove index of marks");
+
+   /***** Insert entries in groups of several rows *****/
+   for (NumEntry = 0;
+	NumEntry < Mrk_IndexOfFile.Num;
+	)
+     {
+      Ptr = Query;
+      Ptr += sprintf (Ptr,"INSERT IGNORE INTO marks_rows"
+			  " (FilCod,NumRow,UsrID,StartPos,EndPos)"
+			  " VALUES");
+      for (NumEntryInQuery = 0;
+	   NumEntry < Mrk_IndexOfFile.Num &&
+	   NumEntryInQuery < Mrk_MAX_ROWS_IN_INDEX_PER_QUERY;
+	   NumEntry++, NumEntryInQuery++)
+	{
+	 Entry = &Mrk_IndexOfFile.Lst[NumEntry];
+	 Ptr += sprintf (Ptr,"%s(%ld,%u,'%s',%ld,%ld)",
+			 NumEntryInQuery ? "," :
+					   " ",
+			 FilCod,Entry->NumRow,Entry->UsrID,
+			 Entry->StartPos,Entry->EndPos);
+	}
+      DB_QueryINSERT (Query,"can not add index of marks to database");
+     }
   }
 
 /*****************************************************************************/
@@ -310,9 +428,16 @@ bool Mrk_CheckFileOfMarks (const char *Path,struct MarksProperties *Marks)
    bool EndOfTable = false;
    bool FileIsCorrect = true;
    unsigned NumRowsStds = 0;
+   unsigned NumRow = 0;
+   long StartOfTable;
+   long StartOfRow;
+   long EndOfLastRow;
 
    Marks->Header = Marks->Footer = 0;
 
+   /***** The file is indexed while checking it *****/
+   Mrk_FreeIndexOfMarks ();
+
    /***** Open file with the table of marks *****/
    if ((FileAllMarks = fopen (Path,"rb")))
      {
@@ -334,6 +459,7 @@ bool Mrk_CheckFileOfMarks (const char *Path,struct MarksProperties *Marks)
             rewind (FileAllMarks);
             Str_FindStrInFile (FileAllMarks,"<table",Str_NO_SKIP_HTML_COMMENTS);
             Str_FindStrInFile (FileAllMarks,">",Str_NO_SKIP_HTML_COMMENTS);
+            StartOfTable = EndOfLastRow = ftell (FileAllMarks);
 
             /* We assume that the structure of the table has several rows of header until the first row of students is found,
 	       then it has a number of rows of students, including some dummy rows without students,
@@ -343,8 +469,12 @@ bool Mrk_CheckFileOfMarks (const char *Path,struct MarksProperties *Marks)
             while (!EndOfHead)
                if (Str_FindStrInFile (FileAllMarks,"<tr",Str_NO_SKIP_HTML_COMMENTS))   // Go to the next row
                  {
+                  StartOfRow = ftell (FileAllMarks) - 3;
+
         	  // All user's IDs must be in the first column of the row
 		  Str_GetCellFromHTMLTableSkipComments (FileAllMarks,CellContent,Mrk_MAX_BYTES_IN_CELL_CONTENT);
+		  Mrk_AddRowToIndex (FileAllMarks,++NumRow,StartOfRow,CellContent);
+		  EndOfLastRow = Mrk_IndexOfFile.Lst[Mrk_IndexOfFile.Num - 1].EndPos;
 
 		  /* Check if only user's IDs
 		     or other stuff found in this table cell */
@@ -365,8 +495,12 @@ bool Mrk_CheckFileOfMarks (const char *Path,struct MarksProperties *Marks)
             while (!EndOfTable)
                if (Str_FindStrInFile (FileAllMarks,"<tr",Str_NO_SKIP_HTML_COMMENTS))   // Go to the next row
                  {
+                  StartOfRow = ftell (FileAllMarks) - 3;
+
         	  // All user's IDs must be in the first column of the row
 		  Str_GetCellFromHTMLTableSkipComments (FileAllMarks,CellContent,Mrk_MAX_BYTES_IN_CELL_CONTENT);
+		  Mrk_AddRowToIndex (FileAllMarks,++NumRow,StartOfRow,CellContent);
+		  EndOfLastRow = Mrk_IndexOfFile.Lst[Mrk_IndexOfFile.Num - 1].EndPos;
 
 		  /* Check if only user's IDs
 		     or other stuff found in this table cell */
@@ -382,6 +516,11 @@ bool Mrk_CheckFileOfMarks (const char *Path,struct MarksProperties *Marks)
                  }
                else
 	          EndOfTable = true;	// No more rows
+
+            /***** Add the range inside the table to the index *****/
+            fseek (FileAllMarks,EndOfLastRow,SEEK_SET);
+            Str_FindStrInFile (FileAllMarks,"</table>",Str_NO_SKIP_HTML_COMMENTS);
+            Mrk_AddEntryToIndex (0,StartOfTable,ftell (FileAllMarks) - 8,"");
            }
         }
       else
@@ -399,9 +538,94 @@ bool Mrk_CheckFileOfMarks (const char *Path,struct MarksProperties *Marks)
                Marks->Header,NumRowsStds,Marks->Footer);
    */
 
+   /***** A wrong file is not indexed *****/
+   if (!FileIsCorrect)
+      Mrk_FreeIndexOfMarks ();
+
    return FileIsCorrect;
   }
 
+/*****************************************************************************/
+/********* Add a row of the table of marks to the index of the file **********/
+/*****************************************************************************/
+// FileAllMarks is positioned just after the first cell of the row
+
+static void Mrk_AddRowToIndex (FILE *FileAllMarks,unsigned NumRow,long StartPos,
+                               const char *CellContent)
+  {
+   char UsrIDFromTable[ID_MAX_BYTES_USR_ID + 1];
+   const char *Ptr;
+   long CurPos;
+   long EndPos;
+
+   /***** Get the end of the row *****/
+   CurPos = ftell (FileAllMarks);
+   Str_FindStrInFile (FileAllMarks,"</tr>",Str_NO_SKIP_HTML_COMMENTS);
+   EndPos = ftell (FileAllMarks);	// Just after "</tr>"
+   fseek (FileAllMarks,CurPos,SEEK_SET);
+
+   /***** Add the range of the row *****/
+   Mrk_AddEntryToIndex (NumRow,StartPos,EndPos,"");
+
+   /***** Add the user's IDs in the first cell of the row *****/
+   Ptr = CellContent;
+   while (*Ptr)
+     {
+      /* Find next string in text until comma or semicolon (leading and trailing spaces are removed) */
+      Str_GetNextStringUntilSeparator (&Ptr,UsrIDFromTable,ID_MAX_BYTES_USR_ID);
+
+      // Users' IDs are always stored internally in capitals and without leading zeros
+      Str_RemoveLeadingZeros (UsrIDFromTable);
+      Str_ConvertToUpperText (UsrIDFromTable);
+      if (ID_CheckIfUsrIDIsValid (UsrIDFromTable))
+	 Mrk_AddEntryToIndex (NumRow,StartPos,EndPos,UsrIDFromTable);
+     }
+  }
+
+/*****************************************************************************/
+/************** Add an entry to the index of the file of marks ***************/
+/*****************************************************************************/
+
+static void Mrk_AddEntryToIndex (unsigned NumRow,long StartPos,long EndPos,
+                                 const char *UsrID)
+  {
+   struct Mrk_RowInIndex *Entry;
+
+   /***** Allocate more space if necessary *****/
+   if (Mrk_IndexOfFile.Num == Mrk_IndexOfFile.Size)
+     {
+      Mrk_IndexOfFile.Size = Mrk_IndexOfFile.Size ? Mrk_IndexOfFile.Size * 2 :
+	                                            64;
+      if ((Mrk_IndexOfFile.Lst = (struct Mrk_RowInIndex *)
+	                         realloc ((void *) Mrk_IndexOfFile.Lst,
+	                                  Mrk_IndexOfFile.Size *
+	                                  sizeof (struct Mrk_RowInIndex))) == NULL)
+	 Lay_ShowErrorAndExit ("Not enough memory to store index of marks.");
+     }
+
+   /***** Add entry *****/
+   Entry = &Mrk_IndexOfFile.Lst[Mrk_IndexOfFile.Num++];
+   Entry->NumRow   = NumRow;
+   Entry->StartPos = StartPos;
+   Entry->EndPos   = EndPos;
+   Str_Copy (Entry->UsrID,UsrID,
+             ID_MAX_BYTES_USR_ID);
+  }
+
+/*****************************************************************************/
+/********** Free index of the file of marks checked in this process **********/
+/*****************************************************************************/
+
+void Mrk_FreeIndexOfMarks (void)
+  {
+   if (Mrk_IndexOfFile.Lst)
+     {
+      free ((void *) Mrk_IndexOfFile.Lst);
+      Mrk_IndexOfFile.Lst = NULL;
+     }
+   Mrk_IndexOfFile.Num = Mrk_IndexOfFile.Size = 0;
+  }
+
 /*****************************************************************************/
 /******* Check if only user's IDs or other stuff found in a table cell *******/
 /*****************************************************************************/
@@ -438,12 +662,287 @@ static bool Mrk_CheckIfCellContainsOnlyIDs (const char *CellContent)
   }
 
 /*****************************************************************************/
-/*************************** Show the marks of a user ************************/
+/**************************** Get the marks of a user ************************/
 /*****************************************************************************/
+// On success, UsrMarks will point to an allocated string with the HTML
+// On error, Gbl.Alert.Txt will contain feedback
 
-static bool Mrk_GetUsrMarks (FILE *FileUsrMarks,struct UsrData *UsrDat,
+static bool Mrk_GetUsrMarks (long FilCod,struct UsrData *UsrDat,
                              const char *PathFileAllMarks,
-                             struct MarksProperties *Marks)
+                             struct MarksProperties *Marks,
+                             char **UsrMarks,size_t *Length)
+  {
+   extern const char *Txt_THE_USER_X_is_not_found_in_the_file_of_marks;
+
+   switch (Mrk_GetUsrMarksFromIndex (FilCod,UsrDat,PathFileAllMarks,Marks,
+                                     UsrMarks,Length))
+     {
+      case Mrk_USR_FOUND:
+	 return true;
+      case Mrk_USR_NOT_FOUND:
+	 sprintf (Gbl.Alert.Txt,Txt_THE_USER_X_is_not_found_in_the_file_of_marks,
+		  UsrDat->FullName);
+	 return false;
+      case Mrk_NOT_INDEXED:
+      default:
+	 // Files of marks uploaded before indexes existed are scanned
+	 return Mrk_GetUsrMarksFromFile (UsrDat,PathFileAllMarks,Marks,
+	                                 UsrMarks,Length);
+     }
+  }
+
+/*****************************************************************************/
+/************* Get the marks of a user using the index in database ***********/
+/*****************************************************************************/
+
+static Mrk_UsrInIndex_t Mrk_GetUsrMarksFromIndex (long FilCod,struct UsrData *UsrDat,
+                                                  const char *PathFileAllMarks,
+                                                  struct MarksProperties *Marks,
+                                                  char **UsrMarks,size_t *Length)
+  {
+   char *Query;
+   char *Ptr;
+   MYSQL_RES *mysql_res;
+   MYSQL_ROW row;
+   unsigned long NumRows;
+   unsigned long NumRow;
+   unsigned NumRowInFile;
+   unsigned NumID;
+   unsigned NumConfirmedIDs = 0;
+   bool TableFound = false;
+   struct Mrk_Range Ranges[Mrk_NUM_RANGES_USR_MARKS];	// Header, user's row, footer and end of file
+
+   if (FilCod <= 0)
+      return Mrk_NOT_INDEXED;
+
+   /***** Allocate space for query *****/
+   if ((Query = (char *) malloc (512 + UsrDat->IDs.Num * (ID_MAX_BYTES_USR_ID + 3))) == NULL)
+      Lay_ShowErrorAndExit ("Not enough memory for query.");
+
+   /***** Get range inside the table and end of header *****/
+   sprintf (Query,"SELECT NumRow,StartPos,EndPos FROM marks_rows"
+		  " WHERE FilCod=%ld AND NumRow IN (0,%u) AND UsrID=''"
+		  " ORDER BY NumRow",
+	    FilCod,Marks->Header);
+   NumRows = DB_QuerySELECT (Query,&mysql_res,"can not get index of marks");
+   for (NumRow = 0;
+	NumRow < NumRows;
+	NumRow++)
+     {
+      row = mysql_fetch_row (mysql_res);
+      if (sscanf (row[0],"%u",&NumRowInFile) == 1)
+	{
+	 if (NumRowInFile == 0)			// Range inside the table
+	   {
+	    TableFound = true;
+	    Ranges[0].End   = strtol (row[1],NULL,10);	// Until start of rows
+	    Ranges[3].Start = strtol (row[2],NULL,10);	// From "</table>"
+	   }
+	 else					// Last row of header
+	    Ranges[0].End = strtol (row[2],NULL,10);
+	}
+     }
+   DB_FreeMySQLResult (&mysql_res);
+
+   if (!TableFound)
+     {
+      free ((void *) Query);
+      return Mrk_NOT_INDEXED;
+     }
+   Ranges[0].Start = 0;
+   Ranges[3].End = -1L;	// Until end of file
+
+   /***** Get range of footer *****/
+   Ranges[2].Start = Ranges[2].End = 0;
+   if (Marks->Footer)
+     {
+      sprintf (Query,"SELECT MIN(StartPos),MAX(EndPos) FROM marks_rows"
+		     " WHERE FilCod=%ld AND UsrID=''"
+		     " AND NumRow>(SELECT MAX(NumRow) FROM marks_rows"
+				 " WHERE FilCod=%ld)-%u",
+	       FilCod,FilCod,Marks->Footer);
+      if (DB_QuerySELECT (Query,&mysql_res,"can not get index of marks"))
+	{
+	 row = mysql_fetch_row (mysql_res);
+	 if (row[0] && row[1])
+	   {
+	    Ranges[2].Start = strtol (row[0],NULL,10);
+	    Ranges[2].End   = strtol (row[1],NULL,10);
+	   }
+	}
+      DB_FreeMySQLResult (&mysql_res);
+     }
+
+   /***** Get range of the row of the user, searching any of his/her confirmed IDs *****/
+   Ptr = Query;
+   Ptr += sprintf (Ptr,"SELECT StartPos,EndPos FROM marks_rows"
+		       " WHERE FilCod=%ld AND NumRow>%u AND UsrID IN (",
+		   FilCod,Marks->Header);
+   for (NumID = 0;
+	NumID < UsrDat->IDs.Num;
+	NumID++)
+      if (UsrDat->IDs.List[NumID].Confirmed)
+	 Ptr += sprintf (Ptr,"%s'%s'",
+			 NumConfirmedIDs++ ? "," :
+					     "",
+			 UsrDat->IDs.List[NumID].ID);
+   sprintf (Ptr,") ORDER BY NumRow LIMIT 1");
+   NumRows = NumConfirmedIDs ? DB_QuerySELECT (Query,&mysql_res,"can not get index of marks") :
+	                       0;
+   if (NumRows)
+     {
+      row = mysql_fetch_row (mysql_res);
+      Ranges[1].Start = strtol (row[0],NULL,10);
+      Ranges[1].End   = strtol (row[1],NULL,10);
+     }
+   if (NumConfirmedIDs)
+      DB_FreeMySQLResult (&mysql_res);
+   free ((void *) Query);
+
+   if (!NumRows)
+      return Mrk_USR_NOT_FOUND;
+
+   /***** Read only the ranges needed from the file of marks *****/
+   if (!Mrk_ReadRangesFromFile (PathFileAllMarks,Ranges,UsrMarks,Length))
+      return Mrk_NOT_INDEXED;	// The index does not match the file ==> scan the file
+
+   return Mrk_USR_FOUND;
+  }
+
+/*****************************************************************************/
+/****** Read several ranges of a file of marks into an allocated string ******/
+/*****************************************************************************/
+// A range ending in -1 goes until the end of file
+
+static bool Mrk_ReadRangesFromFile (const char *Path,
+                                    struct Mrk_Range Ranges[Mrk_NUM_RANGES_USR_MARKS],
+                                    char **Content,size_t *Length)
+  {
+   int FileAllMarks;
+   struct stat FileStatus;
+   unsigned NumRange;
+   size_t TotalLength = 0;
+   size_t RangeLength;
+   char *Ptr;
+
+   /***** Open file of marks *****/
+   if ((FileAllMarks = open (Path,O_RDONLY)) < 0)
+      return false;
+   if (fstat (FileAllMarks,&FileStatus))
+     {
+      close (FileAllMarks);
+      return false;
+     }
+
+   /***** Check ranges and compute total length *****/
+   for (NumRange = 0;
+	NumRange < Mrk_NUM_RANGES_USR_MARKS;
+	NumRange++)
+     {
+      if (Ranges[NumRange].End < 0)
+	 Ranges[NumRange].End = (long) FileStatus.st_size;
+      if (Ranges[NumRange].Start < 0 ||
+	  Ranges[NumRange].Start > Ranges[NumRange].End ||
+	  Ranges[NumRange].End > (long) FileStatus.st_size)
+	{
+	 close (FileAllMarks);
+	 return false;
+	}
+      TotalLength += (size_t) (Ranges[NumRange].End - Ranges[NumRange].Start);
+     }
+
+   /***** Read ranges *****/
+   if ((*Content = (char *) malloc (TotalLength + 1)) == NULL)
+      Lay_ShowErrorAndExit ("Not enough memory to store user's marks.");
+   for (NumRange = 0, Ptr = *Content;
+	NumRange < Mrk_NUM_RANGES_USR_MARKS;
+	NumRange++, Ptr += RangeLength)
+     {
+      RangeLength = (size_t) (Ranges[NumRange].End - Ranges[NumRange].Start);
+      if (RangeLength)
+	 if (pread (FileAllMarks,(void *) Ptr,RangeLength,
+	            (off_t) Ranges[NumRange].Start) != (ssize_t) RangeLength)
+	   {
+	    free ((void *) *Content);
+	    *Content = NULL;
+	    close (FileAllMarks);
+	    return false;
+	   }
+     }
+   *Ptr = '\0';
+   *Length = TotalLength;
+
+   close (FileAllMarks);
+   return true;
+  }
+
+/*****************************************************************************/
+/************ Get the marks of a user scanning the file of marks *************/
+/*****************************************************************************/
+
+static bool Mrk_GetUsrMarksFromFile (struct UsrData *UsrDat,
+                                     const char *PathFileAllMarks,
+                                     struct MarksProperties *Marks,
+                                     char **UsrMarks,size_t *Length)
+  {
+   char PathMarksPriv[PATH_MAX + 1];
+   char FileNameUsrMarks[PATH_MAX + 1];
+   FILE *FileUsrMarks;
+   bool UsrFound;
+
+   /***** Create temporal file to store user's marks (in HTML) *****/
+   /* If the private directory does not exist, create it */
+   sprintf (PathMarksPriv,"%s/%s",
+	    Cfg_PATH_SWAD_PRIVATE,Cfg_FOLDER_MARK);
+   Fil_CreateDirIfNotExists (PathMarksPriv);
+
+   /* First of all, we remove the oldest temporary files.
+      Such temporary files have been created by me or by other users.
+      This is a bit sloppy, but they must be removed by someone.
+      Here "oldest" means more than x time from their creation */
+   Fil_RemoveOldTmpFiles (PathMarksPriv,Cfg_TIME_TO_DELETE_MARKS_TMP_FILES,false);
+
+   /* Create a new temporary file *****/
+   sprintf (FileNameUsrMarks,"%s/%s.html",PathMarksPriv,Gbl.UniqueNameEncrypted);
+   if ((FileUsrMarks = fopen (FileNameUsrMarks,"w+b")) == NULL)
+     {
+      sprintf (Gbl.Alert.Txt,"%s","Can not open file with user's marks!");	// TODO: Need translation!
+      return false;
+     }
+
+   /***** Write user's marks into temporary file *****/
+   if ((UsrFound = Mrk_WriteUsrMarksFromFile (FileUsrMarks,UsrDat,PathFileAllMarks,Marks)))
+     {
+      *Length = (size_t) ftell (FileUsrMarks);
+
+      /***** Read user's marks from temporary file *****/
+      if ((*UsrMarks = (char *) malloc (*Length + 1)) == NULL)
+	 Lay_ShowErrorAndExit ("Not enough memory to store user's marks.");
+      rewind (FileUsrMarks);
+      if (fread ((void *) *UsrMarks,sizeof (char),*Length,FileUsrMarks) != *Length)
+	{
+	 sprintf (Gbl.Alert.Txt,"%s","Can not open file with user's marks!");	// TODO: Need translation!
+	 free ((void *) *UsrMarks);
+	 *UsrMarks = NULL;
+	 UsrFound = false;
+	}
+      else
+	 (*UsrMarks)[*Length] = '\0';
+     }
+   fclose (FileUsrMarks);
+
+   unlink (FileNameUsrMarks);	// File with marks is no longer necessary
+
+   return UsrFound;
+  }
+
+/*****************************************************************************/
+/************** Write the marks of a user scanning the file of marks *********/
+/*****************************************************************************/
+
+static bool Mrk_WriteUsrMarksFromFile (FILE *FileUsrMarks,struct UsrData *UsrDat,
+                                       const char *PathFileAllMarks,
+                                       struct MarksProperties *Marks)
   {
    extern const char *Txt_THE_USER_X_is_not_found_in_the_file_of_marks;
    unsigned Row;
@@ -605,9 +1104,9 @@ static bool Mrk_GetUsrMarks (FILE *FileUsrMarks,struct UsrData *UsrDat,
 void Mrk_ShowMyMarks (void)
   {
    struct MarksProperties Marks;
-   char FileNameUsrMarks[PATH_MAX + 1];
-   FILE *FileUsrMarks;
-   char PathMarksPriv[PATH_MAX + 1];
+   long FilCod;
+   char *UsrMarks;
+   size_t Length;
    char PathPrivate[PATH_MAX + 1];
    struct UsrData *UsrDat;
    bool UsrIsOK = true;
@@ -623,6 +1122,9 @@ void Mrk_ShowMyMarks (void)
    /***** Get number of rows of header or footer *****/
    Mrk_GetNumRowsHeaderAndFooter (&Marks);
 
+   /***** Get code of the file of marks, used to find its index *****/
+   FilCod = Brw_GetFilCodByPath (Gbl.FileBrowser.Priv.FullPathInTree,false);
+
    /***** Set the student whose marks will be shown *****/
    if (Gbl.Usrs.Me.Role.Logged == Rol_STD)	// If I am logged as student...
       UsrDat = &Gbl.Usrs.Me.UsrDat;		// ...use my list of IDs
@@ -656,30 +1158,9 @@ void Mrk_ShowMyMarks (void)
       /***** Get list of user's IDs *****/
       Usr_GetAllUsrDataFromUsrCod (UsrDat);
 
-      /***** Create temporal file to store my marks (in HTML) *****/
-      /* If the private directory does not exist, create it */
-      sprintf (PathMarksPriv,"%s/%s",
-               Cfg_PATH_SWAD_PRIVATE,Cfg_FOLDER_MARK);
-      Fil_CreateDirIfNotExists (PathMarksPriv);
-
-      /* First of all, we remove the oldest temporary files.
-         Such temporary files have been created by me or by other users.
-         This is a bit sloppy, but they must be removed by someone.
-         Here "oldest" means more than x time from their creation */
-      Fil_RemoveOldTmpFiles (PathMarksPriv,Cfg_TIME_TO_DELETE_MARKS_TMP_FILES,false);
-
-      /* Create a new temporary file *****/
-      sprintf (FileNameUsrMarks,"%s/%s.html",PathMarksPriv,Gbl.UniqueNameEncrypted);
-      if ((FileUsrMarks = fopen (FileNameUsrMarks,"wb")) == NULL)
-         Lay_ShowErrorAndExit ("Can not open file for my marks.");
-
       /***** Show my marks *****/
-      if (Mrk_GetUsrMarks (FileUsrMarks,UsrDat,PathPrivate,&Marks))
+      if (Mrk_GetUsrMarks (FilCod,UsrDat,PathPrivate,&Marks,&UsrMarks,&Length))
         {
-         fclose (FileUsrMarks);
-         if ((FileUsrMarks = fopen (FileNameUsrMarks,"rb")) == NULL)
-            Lay_ShowErrorAndExit ("Can not open file with my marks.");
-
          /* Start HTML output */
          /*  Do not write charset here.
              Instead, delegate to the meta directive
@@ -689,18 +1170,13 @@ void Mrk_ShowMyMarks (void)
          Gbl.Layout.HTMLStartWritten = true;
 
          /* Copy HTML to output file */
-         Fil_FastCopyOfOpenFiles (FileUsrMarks,Gbl.F.Out);
-         fclose (FileUsrMarks);
+         fwrite ((void *) UsrMarks,sizeof (char),Length,Gbl.F.Out);
+         free ((void *) UsrMarks);
 
          Gbl.Layout.DivsEndWritten = Gbl.Layout.HTMLEndWritten = true;
         }
       else	// Problems in table of marks or user's ID not found
-        {
-         fclose (FileUsrMarks);
 	 Ale_ShowAlert (Ale_WARNING,Gbl.Alert.Txt);
-        }
-
-      unlink (FileNameUsrMarks);	// File with marks is no longer necessary
      }
    else
       /***** Show warning indicating no students found *****/
@@ -732,14 +1208,9 @@ void Mrk_GetNotifMyMarks (char SummaryStr[Ntf_MAX_BYTES_SUMMARY + 1],
    char FullPathInTreeFromDBMarksTable[PATH_MAX + 1];
    char PathUntilFileName[PATH_MAX + 1];
    char FileName[NAME_MAX + 1];
-   char PathMarksPriv[PATH_MAX + 1];
    char PathMarks[PATH_MAX + 1];
-   char FileNameUsrMarks[PATH_MAX + 1];
-   FILE *FileUsrMarks;
-   size_t SizeOfMyMarks;
+   char *UsrMarks;
    size_t Length;
-   size_t i;
-   char *Ptr;
 
    SummaryStr[0] = '\0';	// Return nothing on error
 
@@ -807,65 +1278,15 @@ void Mrk_GetNotifMyMarks (char SummaryStr[Ntf_MAX_BYTES_SUMMARY + 1],
                               Cfg_PATH_SWAD_PRIVATE,Cfg_FOLDER_CRS,CrsCod,
                               FullPathInTreeFromDBMarksTable);
 
-                  /***** Create temporal file to store my marks (in HTML) *****/
-                  /* If the private directory does not exist, create it */
-                  sprintf (PathMarksPriv,"%s/%s",
-                           Cfg_PATH_SWAD_PRIVATE,Cfg_FOLDER_MARK);
-                  Fil_CreateDirIfNotExists (PathMarksPriv);
-
-                  /* First of all, we remove the oldest temporary files.
-                     Such temporary files have been created by me or by other users.
-                     This is a bit sloppy, but they must be removed by someone.
-                     Here "oldest" means more than x time from their creation */
-                  Fil_RemoveOldTmpFiles (PathMarksPriv,Cfg_TIME_TO_DELETE_MARKS_TMP_FILES,false);
-
-                  /* Create a new temporary file *****/
-                  sprintf (FileNameUsrMarks,"%s/%s.html",PathMarksPriv,Gbl.UniqueNameEncrypted);
-                  if ((FileUsrMarks = fopen (FileNameUsrMarks,"wb")))
+                  /***** Get user's marks *****/
+                  if (Mrk_GetUsrMarks (MrkCod,&UsrDat,PathMarks,&Marks,&UsrMarks,&Length))
                     {
-                     /***** Get user's marks *****/
-                     if (Mrk_GetUsrMarks (FileUsrMarks,&UsrDat,PathMarks,&Marks))
-                       {
-                        SizeOfMyMarks = (size_t) ftell (FileUsrMarks);
-                        fclose (FileUsrMarks);
-
-                        Length = 9 + SizeOfMyMarks + 3;
-                        if ((*ContentStr = (char *) malloc (Length + 1)))
-                          {
-                           /* 9 starting chars */
-                           Str_Copy (*ContentStr,"<![CDATA[",
-                                     9);
-
-                           /* Content */
-                           Ptr = (*ContentStr) + 9;
-                           if ((FileUsrMarks = fopen (FileNameUsrMarks,"rb")))
-                             {
-                              for (i = 0;
-                        	   i < SizeOfMyMarks;
-                        	   i++)
-                                 *Ptr++ = (char) fgetc (FileUsrMarks);
-                              fclose (FileUsrMarks);
-                             }
-
-                           /* 3 ending chars */
-                           Str_Copy (Ptr,"]]>",
-                                     3);
-                          }
-                       }
-                     else
-                       {
-                        fclose (FileUsrMarks);
-                        if ((*ContentStr = (char *) malloc (9 + strlen (Gbl.Alert.Txt) + 3 + 1)))
-                           sprintf (*ContentStr,"<![CDATA[%s]]>",Gbl.Alert.Txt);
-                       }
+                     if ((*ContentStr = (char *) malloc (9 + Length + 3 + 1)))
+                        sprintf (*ContentStr,"<![CDATA[%s]]>",UsrMarks);
+                     free ((void *) UsrMarks);
                     }
-                  else
-                    {
-                     sprintf (Gbl.Alert.Txt,"%s","Can not open file with user's marks!");	// TODO: Need translation!
-                     if ((*ContentStr = (char *) malloc (9 + strlen (Gbl.Alert.Txt) + 3 + 1)))
-                        sprintf (*ContentStr,"<![CDATA[%s]]>",Gbl.Alert.Txt);
-                    }
-                  unlink (FileNameUsrMarks);	// File with marks is no longer necessary
+                  else if ((*ContentStr = (char *) malloc (9 + strlen (Gbl.Alert.Txt) + 3 + 1)))
+                     sprintf (*ContentStr,"<![CDATA[%s]]>",Gbl.Alert.Txt);
                  }
                else
                  {
@@ -51,6 +51,7 @@ void Mrk_ChangeNumRowsHeader (void);
 void Mrk_ChangeNumRowsFooter (void);
 
 bool Mrk_CheckFileOfMarks (const char *Path,struct MarksProperties *Marks);
+void Mrk_FreeIndexOfMarks (void);
 void Mrk_ShowMyMarks (void);
 void Mrk_GetNotifMyMarks (char SummaryStr[Ntf_MAX_BYTES_SUMMARY + 1],
                           char **ContentStr,
@@ -59,6 +59,7 @@ extern struct Globals Gbl;
 /*****************************************************************************/
 
 #define Msg_MAX_BYTES_MESSAGES_QUERY (4 * 1024 - 1)
+#define Msg_MAX_BYTES_MESSAGES_PAGE_QUERY (Msg_MAX_BYTES_MESSAGES_QUERY + 2 * 1024)
 
 // Forum images will be saved with:
 // - maximum width of Msg_IMAGE_SAVED_MAX_HEIGHT
@@ -99,9 +100,12 @@ static void Msg_PutHiddenParamsOneMsg (void);
 
 static void Msg_ShowFormToShowOnlyUnreadMessages (void);
 static void Msg_GetParamOnlyUnreadMsgs (void);
-static void Msg_ShowASentOrReceivedMessage (long MsgNum,long MsgCod);
-static void Msg_GetStatusOfSentMsg (long MsgCod,bool *Expanded);
-static void Msg_GetStatusOfReceivedMsg (long MsgCod,bool *Open,bool *Replied,bool *Expanded);
+static unsigned Msg_GetNumMsgsAndRowOfMsg (const char *SubQuery,long MsgCod,
+                                           unsigned long *NumRowMsg);
+static unsigned long Msg_GetMsgsInPage (const char *SubQuery,
+                                        const struct Pagination *Pagination,
+                                        MYSQL_RES **mysql_res);
+static void Msg_ShowASentOrReceivedMessage (long MsgNum,MYSQL_ROW row);
 static long Msg_GetParamMsgCod (void);
 static void Msg_PutLinkToShowMorePotentialRecipients (void);
 static void Msg_PutParamsShowMorePotentialRecipients (void);
@@ -131,12 +135,6 @@ static bool Msg_CheckIfSentMsgIsDeleted (long MsgCod);
 static bool Msg_CheckIfReceivedMsgIsDeletedForAllItsRecipients (long MsgCod);
 static unsigned Msg_GetNumUnreadMsgs (long FilterCrsCod,const char *FilterFromToSubquery);
 
-static void Msg_GetMsgSntData (long MsgCod,long *CrsCod,long *UsrCod,
-                               time_t *CreatTimeUTC,
-                               char Subject[Cns_MAX_BYTES_SUBJECT + 1],
-                               bool *Deleted);
-static void Msg_GetMsgContent (long MsgCod,char Content[Cns_MAX_BYTES_LONG_TEXT + 1],
-                               struct Image *Image);
 
 static void Msg_WriteSentOrReceivedMsgSubject (long MsgCod,const char *Subject,bool Open,bool Expanded);
 static void Msg_WriteFormToReply (long MsgCod,long CrsCod,
@@ -1604,6 +1602,17 @@ static unsigned Msg_GetNumUnreadMsgs (long FilterCrsCod,const char *FilterFromTo
    char SubQuery[Msg_MAX_BYTES_MESSAGES_QUERY + 1];
    char Query[Msg_MAX_BYTES_MESSAGES_QUERY + 1];
 
+   /***** Without filters, count directly using index (UsrCod,Open,MsgCod) *****/
+   if (FilterCrsCod < 0 &&
+       !FilterFromToSubquery[0] &&
+       !Gbl.Msg.FilterContent[0])
+     {
+      sprintf (Query,"SELECT COUNT(*) FROM msg_rcv"
+		     " WHERE UsrCod=%ld AND Open='N'",
+	       Gbl.Usrs.Me.UsrDat.UsrCod);
+      return (unsigned) DB_QueryCOUNT (Query,"can not get number of unread messages");
+     }
+
    /***** Get number of unread messages from database *****/
    if (FilterCrsCod >= 0)	// If origin course selected
      {
@@ -1695,15 +1704,15 @@ static void Msg_ShowSentOrReceivedMessages (void)
    extern const char *Txt_Filter;
    extern const char *Txt_Update_messages;
    char FilterFromToSubquery[Msg_MAX_BYTES_MESSAGES_QUERY + 1];
-   char Query[Msg_MAX_BYTES_MESSAGES_QUERY + 1];
+   char SubQuery[Msg_MAX_BYTES_MESSAGES_QUERY + 1];
    MYSQL_RES *mysql_res;
    MYSQL_ROW row;
    unsigned long NumRow;
    unsigned long NumRows;
-   unsigned long NumMsg = 0;		// Initialized to avoid warning
+   unsigned long NumRowExpandedMsg;
+   unsigned long NumMsg;
    unsigned NumUnreadMsgs = 0;		// Initialized to avoid warning
    struct Pagination Pagination;
-   long MsgCod;
    static const Act_Action_t ActionSee[Msg_NUM_TYPES_OF_MSGS] =
      {
       ActSeeRcvMsg,
@@ -1747,11 +1756,14 @@ static void Msg_ShowSentOrReceivedMessages (void)
          break;
      }
 
-   /***** Get messages from database *****/
-   Msg_ConstructQueryToSelectSentOrReceivedMsgs (Query,Gbl.Usrs.Me.UsrDat.UsrCod,
+   /***** Get number of messages and, if a message is being expanded,
+          the row where it is *****/
+   Msg_ConstructQueryToSelectSentOrReceivedMsgs (SubQuery,Gbl.Usrs.Me.UsrDat.UsrCod,
                                                  Gbl.Msg.FilterCrsCod,FilterFromToSubquery);
-   NumRows = DB_QuerySELECT (Query,&mysql_res,"can not get messages");
-   Gbl.Msg.NumMsgs = (unsigned) NumRows;
+   Gbl.Msg.NumMsgs = Msg_GetNumMsgsAndRowOfMsg (SubQuery,
+                                                Gbl.Action.Act == ActExpRcvMsg ? Gbl.Msg.ExpandedMsgCod :
+                                                                                 -1L,
+                                                &NumRowExpandedMsg);
 
    /***** Start box with messages *****/
    Box_StartBox ("97%",Msg_WriteNumMsgs (NumUnreadMsgs),Msg_PutIconsListMsgs,
@@ -1787,25 +1799,11 @@ static void Msg_ShowSentOrReceivedMessages (void)
 
    if (Gbl.Msg.NumMsgs)		// If there are messages...
      {
-      if (Gbl.Action.Act == ActExpRcvMsg)	// Expanding a message, perhaps it is the result of following a link
+      if (Gbl.Action.Act == ActExpRcvMsg &&	// Expanding a message, perhaps it is the result of following a link
 						// from a notification of received message, so show the page where the message is inside
-        {
+	  NumRowExpandedMsg)			// Expanded message found
          /***** Get the page where the expanded message is inside *****/
-         for (NumRow = 0;
-              NumRow < NumRows;
-              NumRow++)
-           {
-            row = mysql_fetch_row (mysql_res);
-            if (sscanf (row[0],"%ld",&MsgCod) != 1)
-               Lay_ShowErrorAndExit ("Wrong code of message when searching for a page.");
-
-            if (MsgCod == Gbl.Msg.ExpandedMsgCod)	// Expanded message found
-              {
-               Gbl.Msg.CurrentPage = (unsigned) (NumRow / Pag_ITEMS_PER_PAGE) + 1;
-               break;
-              }
-           }
-        }
+	 Gbl.Msg.CurrentPage = (unsigned) ((NumRowExpandedMsg - 1) / Pag_ITEMS_PER_PAGE) + 1;
 
       /***** Compute variables related to pagination *****/
       Pagination.NumItems = Gbl.Msg.NumMsgs;
@@ -1823,24 +1821,27 @@ static void Msg_ShowSentOrReceivedMessages (void)
                                         0,
                                         &Pagination);
 
+      /***** Get data of all the messages in this page *****/
+      NumRows = Msg_GetMsgsInPage (SubQuery,&Pagination,&mysql_res);
+
       /***** Show received / sent messages in this page *****/
       Tbl_StartTableWide (2);
 
-      mysql_data_seek (mysql_res,(my_ulonglong) (Pagination.FirstItemVisible - 1));
-      for (NumRow = Pagination.FirstItemVisible;
-           NumRow <= Pagination.LastItemVisible;
+      for (NumRow = 0;
+           NumRow < NumRows;
            NumRow++)
         {
          row = mysql_fetch_row (mysql_res);
-
-         if (sscanf (row[0],"%ld",&MsgCod) != 1)
-            Lay_ShowErrorAndExit ("Wrong code of message when listing the messages in a page.");
-         NumMsg = NumRows - NumRow + 1;
-         Msg_ShowASentOrReceivedMessage (NumMsg,MsgCod);
+         NumMsg = (unsigned long) Gbl.Msg.NumMsgs -
+                  ((unsigned long) Pagination.FirstItemVisible + NumRow) + 1;
+         Msg_ShowASentOrReceivedMessage (NumMsg,row);
         }
 
       Tbl_EndTable ();
 
+      /***** Free structure that stores the query result *****/
+      DB_FreeMySQLResult (&mysql_res);
+
       /***** Write again links to pages *****/
       if (Pagination.MoreThanOnePage)
          Pag_WriteLinksToPagesCentered (WhatPaginate[Gbl.Msg.TypeOfMessages],
@@ -1850,9 +1851,121 @@ static void Msg_ShowSentOrReceivedMessages (void)
 
    /***** End box *****/
    Box_EndBox ();
+  }
+
+/*****************************************************************************/
+/*** Get number of messages and the row (1, 2...) where a message is inside **/
+/*****************************************************************************/
+// Messages are ordered from most recent to oldest,
+// so the row of a message is the number of more recent messages plus one.
+// *NumRowMsg is 0 if the message is not inside the list
+
+static unsigned Msg_GetNumMsgsAndRowOfMsg (const char *SubQuery,long MsgCod,
+                                           unsigned long *NumRowMsg)
+  {
+   char Query[Msg_MAX_BYTES_MESSAGES_PAGE_QUERY + 1];
+   MYSQL_RES *mysql_res;
+   MYSQL_ROW row;
+   unsigned NumMsgs = 0;
+   unsigned long NumMoreRecentMsgs;
+   unsigned long MsgFound;
+
+   *NumRowMsg = 0;
+
+   /***** Count all messages and messages more recent than the given one
+          without retrieving the list of messages *****/
+   sprintf (Query,"SELECT COUNT(*),"
+	          "SUM(MsgCod>%ld),"
+	          "SUM(MsgCod=%ld)"
+	          " FROM (%s) AS M",
+	    MsgCod,
+	    MsgCod,
+	    SubQuery);
+   if (DB_QuerySELECT (Query,&mysql_res,"can not get number of messages"))
+     {
+      row = mysql_fetch_row (mysql_res);
+
+      /* Get number of messages (row[0]) */
+      if (sscanf (row[0],"%u",&NumMsgs) != 1)
+	 NumMsgs = 0;
+
+      /* Get number of messages more recent than the given one (row[1])
+         and if the given message is in the list (row[2]) */
+      if (row[1] && row[2])	// Sums are NULL when there are no messages
+	 if (sscanf (row[1],"%lu",&NumMoreRecentMsgs) == 1 &&
+	     sscanf (row[2],"%lu",&MsgFound) == 1)
+	    if (MsgFound)
+	       *NumRowMsg = NumMoreRecentMsgs + 1;
+     }
 
    /***** Free structure that stores the query result *****/
    DB_FreeMySQLResult (&mysql_res);
+
+   return NumMsgs;
+  }
+
+/*****************************************************************************/
+/************* Get data of the messages shown in the current page ************/
+/*****************************************************************************/
+// Status, author, date, subject and content of all the messages in the page
+// are got in only one query. Content is got only for expanded messages
+
+static unsigned long Msg_GetMsgsInPage (const char *SubQuery,
+                                        const struct Pagination *Pagination,
+                                        MYSQL_RES **mysql_res)
+  {
+   char Query[Msg_MAX_BYTES_MESSAGES_PAGE_QUERY + 1];
+   const char *StatusFields;
+   const char *ExpandedField;
+   char StatusJoin[128];
+
+   /***** Status of the message for me *****/
+   switch (Gbl.Msg.TypeOfMessages)
+     {
+      case Msg_MESSAGES_RECEIVED:
+	 StatusFields  = "msg_rcv.Open,msg_rcv.Replied,msg_rcv.Expanded";
+	 ExpandedField = "msg_rcv.Expanded";
+	 sprintf (StatusJoin," JOIN msg_rcv"
+	                     " ON (msg_rcv.MsgCod=M.MsgCod"
+	                     " AND msg_rcv.UsrCod=%ld)",
+		  Gbl.Usrs.Me.UsrDat.UsrCod);
+	 break;
+      case Msg_MESSAGES_SENT:
+      default:
+	 // A sent message is always open and not replied
+	 StatusFields  = "'Y','N',msg_snt.Expanded";
+	 ExpandedField = "msg_snt.Expanded";
+	 StatusJoin[0] = '\0';
+	 break;
+     }
+
+   /***** Get messages in page from database *****/
+   // The subquery is ordered from most recent to oldest message
+   sprintf (Query,"SELECT M.MsgCod,"						// row[ 0]
+	          "COALESCE(msg_snt.CrsCod,msg_snt_deleted.CrsCod),"		// row[ 1]
+	          "COALESCE(msg_snt.UsrCod,msg_snt_deleted.UsrCod),"		// row[ 2]
+	          "UNIX_TIMESTAMP(COALESCE(msg_snt.CreatTime,"
+	                                  "msg_snt_deleted.CreatTime)),"	// row[ 3]
+	          "msg_snt.MsgCod IS NULL,"					// row[ 4]
+	          "msg_content.Subject,"					// row[ 5]
+	          "%s,"								// row[ 6], row[ 7], row[ 8]
+	          "IF(%s='Y',msg_content.Content,''),"			// row[ 9]
+	          "msg_content.ImageName,"					// row[10]
+	          "msg_content.ImageTitle,"					// row[11]
+	          "msg_content.ImageURL"					// row[12]
+	          " FROM (%s LIMIT %u,%u) AS M"
+	          " JOIN msg_content ON M.MsgCod=msg_content.MsgCod"
+	          " LEFT JOIN msg_snt ON M.MsgCod=msg_snt.MsgCod"
+	          " LEFT JOIN msg_snt_deleted ON M.MsgCod=msg_snt_deleted.MsgCod"
+	          "%s"
+	          " ORDER BY M.MsgCod DESC",
+	    StatusFields,
+	    ExpandedField,
+	    SubQuery,
+	    (unsigned) (Pagination->FirstItemVisible - 1),
+	    (unsigned) (Pagination->LastItemVisible - Pagination->FirstItemVisible + 1),
+	    StatusJoin);
+   return DB_QuerySELECT (Query,mysql_res,"can not get messages");
   }
 
 /*****************************************************************************/
@@ -2031,22 +2144,6 @@ static void Msg_ConstructQueryToSelectSentOrReceivedMsgs (char Query[Msg_MAX_BYT
    Str_Concat (Query," ORDER BY MsgCod DESC",Msg_MAX_BYTES_MESSAGES_QUERY);
   }
 
-/*****************************************************************************/
-/**** Get the number of unique messages sent by any teacher from a course ****/
-/*****************************************************************************/
-
-unsigned Msg_GetNumMsgsSentByTchsCrs (long CrsCod)
-  {
-   char Query[1024];
-
-   /***** Get the number of unique messages sent by any teacher from this course *****/
-   sprintf (Query,"SELECT COUNT(*) FROM msg_snt,crs_usr"
-                  " WHERE msg_snt.CrsCod=%ld AND crs_usr.CrsCod=%ld AND crs_usr.Role=%u"
-                  " AND msg_snt.UsrCod=crs_usr.UsrCod",
-                  CrsCod,CrsCod,(unsigned) Rol_TCH);
-   return (unsigned) DB_QueryCOUNT (Query,"can not get the number of messages sent by teachers");
-  }
-
 /*****************************************************************************/
 /************** Get the number of unique messages sent by a user *************/
 /*****************************************************************************/
@@ -2640,61 +2737,6 @@ static void Msg_GetParamOnlyUnreadMsgs (void)
    Gbl.Msg.ShowOnlyUnreadMsgs = Par_GetParToBool ("OnlyUnreadMsgs");
   }
 
-/*****************************************************************************/
-/***************************** Get data of a message *************************/
-/*****************************************************************************/
-
-static void Msg_GetMsgSntData (long MsgCod,long *CrsCod,long *UsrCod,
-                               time_t *CreatTimeUTC,
-                               char Subject[Cns_MAX_BYTES_SUBJECT + 1],
-                               bool *Deleted)
-  {
-   char Query[512];
-   MYSQL_RES *mysql_res;
-   MYSQL_ROW row;
-   unsigned long NumRows;
-
-   /***** Get data of message from table msg_snt *****/
-   *Deleted = false;
-   sprintf (Query,"SELECT CrsCod,UsrCod,UNIX_TIMESTAMP(CreatTime)"
-                  " FROM msg_snt WHERE MsgCod=%ld",
-            MsgCod);
-   NumRows = DB_QuerySELECT (Query,&mysql_res,"can not get data of a message");
-
-   if (NumRows == 0)   // If not result ==> sent message is deleted
-     {
-      /***** Get data of message from table msg_snt_deleted *****/
-      sprintf (Query,"SELECT CrsCod,UsrCod,UNIX_TIMESTAMP(CreatTime)"
-                     " FROM msg_snt_deleted WHERE MsgCod=%ld",
-               MsgCod);
-      NumRows = DB_QuerySELECT (Query,&mysql_res,"can not get data of a message");
-
-      *Deleted = true;
-     }
-
-   /* Result should have a unique row */
-   if (NumRows != 1)
-      Lay_ShowErrorAndExit ("Error when getting data of a message.");
-
-   /* Get number of rows */
-   row = mysql_fetch_row (mysql_res);
-
-   /* Get location (row[0]) */
-   *CrsCod = Str_ConvertStrCodToLongCod (row[0]);
-
-   /* Get author code (row[1]) */
-   *UsrCod = Str_ConvertStrCodToLongCod (row[1]);
-
-   /* Get creation time (row[2]) */
-   *CreatTimeUTC = Dat_GetUNIXTimeFromStr (row[2]);
-
-   /* Free structure that stores the query result */
-   DB_FreeMySQLResult (&mysql_res);
-
-   /***** Get subject of message from database *****/
-   Msg_GetMsgSubject (MsgCod,Subject);
-  }
-
 /*****************************************************************************/
 /************************ Get the subject of a message ***********************/
 /*****************************************************************************/
@@ -2723,115 +2765,11 @@ void Msg_GetMsgSubject (long MsgCod,char Subject[Cns_MAX_BYTES_SUBJECT + 1])
    DB_FreeMySQLResult (&mysql_res);
   }
 
-/*****************************************************************************/
-/*************** Get content and optional image of a message *****************/
-/*****************************************************************************/
-
-static void Msg_GetMsgContent (long MsgCod,char Content[Cns_MAX_BYTES_LONG_TEXT + 1],
-                               struct Image *Image)
-  {
-   char Query[256];
-   MYSQL_RES *mysql_res;
-   MYSQL_ROW row;
-   unsigned long NumRows;
-
-   /***** Get content of message from database *****/
-   sprintf (Query,"SELECT Content,ImageName,ImageTitle,ImageURL"
-	          " FROM msg_content WHERE MsgCod=%ld",
-            MsgCod);
-   NumRows = DB_QuerySELECT (Query,&mysql_res,"can not get the content of a message");
-
-   /***** Result should have a unique row *****/
-   if (NumRows != 1)
-      Lay_ShowErrorAndExit ("Error when getting content of a message.");
-
-   /***** Get number of rows *****/
-   row = mysql_fetch_row (mysql_res);
-
-   /****** Get content (row[0]) *****/
-   Str_Copy (Content,row[0],
-             Cns_MAX_BYTES_LONG_TEXT);
-
-   /****** Get image name (row[1]), title (row[2]) and URL (row[3]) *****/
-   Img_GetImageNameTitleAndURLFromRow (row[1],row[2],row[3],Image);
-
-   /***** Free structure that stores the query result *****/
-   DB_FreeMySQLResult (&mysql_res);
-  }
-
-/*****************************************************************************/
-/********************** Get if a sent message is expanded ********************/
-/*****************************************************************************/
-
-static void Msg_GetStatusOfSentMsg (long MsgCod,bool *Expanded)
-  {
-   char Query[512];
-   MYSQL_RES *mysql_res;
-   MYSQL_ROW row;
-   unsigned long NumRows;
-
-   /***** Get if sent message has been replied/expanded from database *****/
-   sprintf (Query,"SELECT Expanded FROM msg_snt"
-                  " WHERE MsgCod=%ld AND UsrCod=%ld",
-            MsgCod,Gbl.Usrs.Me.UsrDat.UsrCod);
-   NumRows = DB_QuerySELECT (Query,&mysql_res,"can not get if a sent message has been replied/expanded");
-
-   /***** Result should have a unique row *****/
-   if (NumRows != 1)
-      Lay_ShowErrorAndExit ("Error when getting if a sent message has been replied/expanded.");
-
-   /***** Get number of rows *****/
-   row = mysql_fetch_row (mysql_res);
-
-   /***** Get if message is expanded *****/
-   *Expanded = (row[0][0] == 'Y');
-
-   /***** Free structure that stores the query result *****/
-   DB_FreeMySQLResult (&mysql_res);
-  }
-
-/*****************************************************************************/
-/***************** Get if a received message has been replied ****************/
-/*****************************************************************************/
-
-static void Msg_GetStatusOfReceivedMsg (long MsgCod,bool *Open,bool *Replied,bool *Expanded)
-  {
-   char Query[512];
-   MYSQL_RES *mysql_res;
-   MYSQL_ROW row;
-   unsigned long NumRows;
-
-   /***** Get if received message has been replied/expanded from database *****/
-   sprintf (Query,"SELECT Open,Replied,Expanded FROM msg_rcv"
-                  " WHERE MsgCod=%ld AND UsrCod=%ld",
-            MsgCod,Gbl.Usrs.Me.UsrDat.UsrCod);
-   NumRows = DB_QuerySELECT (Query,&mysql_res,"can not get if a received message has been replied/expanded");
-
-   /***** Result should have a unique row *****/
-   if (NumRows != 1)
-      Lay_ShowErrorAndExit ("Error when getting if a received message has been replied/expanded.");
-
-   /***** Get number of rows *****/
-   row = mysql_fetch_row (mysql_res);
-
-   /***** Get if message has been read by me *****/
-   *Open     = (row[0][0] == 'Y');
-
-   /***** Get if message has been replied *****/
-   *Replied  = (row[1][0] == 'Y');
-
-   /***** Get if message is expanded *****/
-   *Expanded = (row[2][0] == 'Y');
-
-   /***** Free structure that stores the query result *****/
-   DB_FreeMySQLResult (&mysql_res);
-  }
-
 /*****************************************************************************/
 /******** Show a sent or a received message (from a user to another) *********/
 /*****************************************************************************/
 
-static void Msg_ShowASentOrReceivedMessage (long MsgNum,long MsgCod)
+static void Msg_ShowASentOrReceivedMessage (long MsgNum,MYSQL_ROW row)
   {
    extern const char *Txt_MSG_Replied;
    extern const char *Txt_MSG_Not_replied;
@@ -2848,6 +2786,7 @@ static void Msg_ShowASentOrReceivedMessage (long MsgNum,long MsgCod)
    struct UsrData UsrDat;
    const char *Title = NULL;	// Initialized to avoid warning
    bool FromThisCrs = false;	// Initialized to avoid warning
+   long MsgCod;
    time_t CreatTimeUTC;		// Creation time of a message
    long CrsCod;
    char Subject[Cns_MAX_BYTES_SUBJECT + 1];
@@ -2861,17 +2800,33 @@ static void Msg_ShowASentOrReceivedMessage (long MsgNum,long MsgCod)
    /***** Initialize structure with user's data *****/
    Usr_UsrDataConstructor (&UsrDat);
 
-   /***** Get data of message *****/
-   Msg_GetMsgSntData (MsgCod,&CrsCod,&UsrDat.UsrCod,&CreatTimeUTC,Subject,&Deleted);
-   switch (Gbl.Msg.TypeOfMessages)
-     {
-      case Msg_MESSAGES_RECEIVED:
-         Msg_GetStatusOfReceivedMsg (MsgCod,&Open,&Replied,&Expanded);
-         break;
-      case Msg_MESSAGES_SENT:
-         Msg_GetStatusOfSentMsg (MsgCod,&Expanded);
-         break;
-     }
+   /***** Get data of message from row *****/
+   /* Get message code (row[0]) */
+   if (sscanf (row[0],"%ld",&MsgCod) != 1)
+      Lay_ShowErrorAndExit ("Wrong code of message when listing the messages in a page.");
+
+   /* Get location (row[1]) */
+   CrsCod = Str_ConvertStrCodToLongCod (row[1]);
+
+   /* Get author code (row[2]) */
+   UsrDat.UsrCod = Str_ConvertStrCodToLongCod (row[2]);
+
+   /* Get creation time (row[3]) */
+   CreatTimeUTC = Dat_GetUNIXTimeFromStr (row[3]);
+
+   /* Get if sent message is deleted (row[4]) */
+   Deleted = (row[4][0] == '1');
+
+   /* Get subject (row[5]) */
+   Str_Copy (Subject,row[5],
+             Cns_MAX_BYTES_SUBJECT);
+
+   /* Get if message has been read by me (row[6]),
+      if message has been replied (row[7])
+      and if message is expanded (row[8]) */
+   Open     = (row[6][0] == 'Y');
+   Replied  = (row[7][0] == 'Y');
+   Expanded = (row[8][0] == 'Y');
 
    /***** Put an icon with message status *****/
    switch (Gbl.Msg.TypeOfMessages)
@@ -2987,8 +2942,11 @@ static void Msg_ShowASentOrReceivedMessage (long MsgNum,long MsgCod)
       /***** Initialize image *****/
       Img_ImageConstructor (&Image);
 
-      /***** Get message content and optional image *****/
-      Msg_GetMsgContent (MsgCod,Content,&Image);
+      /***** Get message content (row[9])
+             and optional image name (row[10]), title (row[11]) and URL (row[12]) *****/
+      Str_Copy (Content,row[9],
+                Cns_MAX_BYTES_LONG_TEXT);
+      Img_GetImageNameTitleAndURLFromRow (row[10],row[11],row[12],&Image);
 
       /***** Show content and image *****/
       fprintf (Gbl.F.Out,"<td colspan=\"2\" class=\"MSG_TXT LEFT_TOP\">");
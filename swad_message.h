@@ -85,7 +85,6 @@ void Msg_MoveUnusedMsgsContentToDeleted (void);
 void Msg_ShowSntMsgs (void);
 void Msg_ShowRecMsgs (void);
 
-unsigned Msg_GetNumMsgsSentByTchsCrs (long CrsCod);
 unsigned long Msg_GetNumMsgsSentByUsr (long UsrCod);
 unsigned Msg_GetNumMsgsSent (Sco_Scope_t Scope,Msg_Status_t MsgStatus);
 unsigned Msg_GetNumMsgsReceived (Sco_Scope_t Scope,Msg_Status_t MsgStatus);
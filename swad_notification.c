@@ -26,7 +26,7 @@
 /*****************************************************************************/
 
 #include <linux/stddef.h>	// For NULL
-#include <stdlib.h>		// For system
+#include <stdlib.h>		// For system, malloc, free
 #include <string.h>
 #include <sys/wait.h>		// For the macro WEXITSTATUS
 #include <unistd.h>		// For unlink
@@ -279,6 +279,11 @@ static bool Ntf_StartFormGoToAction (Ntf_NotifyEvent_t NotifyEvent,
                                      long CrsCod,struct UsrData *UsrDat,long Cod);
 static void Ntf_PutHiddenParamNotifyEvent (Ntf_NotifyEvent_t NotifyEvent);
 
+static unsigned Ntf_StoreNotifyEventToUsrsInSubQuery (Ntf_NotifyEvent_t NotifyEvent,
+                                                      const char *SubQuery,long Cod);
+static void Ntf_GetLocationOfNotifyEvent (Ntf_NotifyEvent_t NotifyEvent,
+                                          long *InsCod,long *CtrCod,
+                                          long *DegCod,long *CrsCod);
 static void Ntf_UpdateMyLastAccessToNotifications (void);
 static void Ntf_SendPendingNotifByEMailToOneUsr (struct UsrData *ToUsrDat,unsigned *NumNotif,unsigned *NumMails);
 static void Ntf_GetNumNotifSent (long DegCod,long CrsCod,
@@ -289,8 +294,7 @@ static void Ntf_UpdateNumNotifSent (long DegCod,long CrsCod,
                                     unsigned NumEvents,unsigned NumMails);
 
 static void Ntf_GetParamsNotifyEvents (void);
-static unsigned Ntf_GetNumberOfAllMyUnseenNtfs (void);
-static unsigned Ntf_GetNumberOfMyNewUnseenNtfs (void);
+static unsigned Ntf_GetNumberOfMyUnseenNtfs (unsigned *NumNewNtfs);
 
 /*****************************************************************************/
 /*************************** Show my notifications ***************************/
@@ -1005,6 +1009,31 @@ void Ntf_MarkNotifToOneUsrAsRemoved (Ntf_NotifyEvent_t NotifyEvent,long Cod,long
    DB_QueryUPDATE (Query,"can not set notification(s) as removed");
   }
 
+/*****************************************************************************/
+/*** Set all notifications of a type to several users in course as removed ***/
+/*****************************************************************************/
+// UsrCodsList is a list of users' codes separated by commas
+
+void Ntf_MarkNotifToSeveralUsrsAsRemoved (Ntf_NotifyEvent_t NotifyEvent,
+                                          const char *UsrCodsList)
+  {
+   char *Query;
+
+   /***** Allocate space for query *****/
+   if ((Query = (char *) malloc (256 + strlen (UsrCodsList))) == NULL)
+      Lay_ShowErrorAndExit ("Not enough memory to store database query.");
+
+   /***** Set all notifications of this type, in the current course for the users, as removed *****/
+   sprintf (Query,"UPDATE notif SET Status=(Status | %u)"
+		  " WHERE ToUsrCod IN (%s) AND NotifyEvent=%u AND CrsCod=%ld",
+	    (unsigned) Ntf_STATUS_BIT_REMOVED,
+	    UsrCodsList,(unsigned) NotifyEvent,Gbl.CurrentCrs.Crs.CrsCod);
+   DB_QueryUPDATE (Query,"can not set notification(s) as removed");
+
+   /***** Free space used for query *****/
+   free ((void *) Query);
+  }
+
 /*****************************************************************************/
 /*********** Set possible notifications from a course as removed *************/
 /*****************************************************************************/
@@ -1186,17 +1215,10 @@ void Ntf_MarkNotifFilesInGroupAsRemoved (long GrpCod)
 unsigned Ntf_StoreNotifyEventsToAllUsrs (Ntf_NotifyEvent_t NotifyEvent,long Cod)
   {
    extern const char *Sco_ScopeDB[Sco_NUM_SCOPES];
-   char Query[1024];
-   MYSQL_RES *mysql_res;
-   MYSQL_ROW row;
-   unsigned long NumRow;
-   unsigned long NumRows;
-   struct UsrData UsrDat;
+   char SubQuery[1024];
    struct Forum ForumSelected;
-   unsigned NumUsrsToBeNotifiedByEMail = 0;
-   unsigned NotifyEventMask = (1 << NotifyEvent);
 
-   /***** Get users who want to be notified from database ******/
+   /***** Build subquery to get users to be notified ******/
    switch (NotifyEvent)
      {
       case Ntf_EVENT_UNKNOWN:	// This function should not be called in this case
@@ -1210,14 +1232,14 @@ unsigned Ntf_StoreNotifyEventsToAllUsrs (Ntf_NotifyEvent_t NotifyEvent,long Cod)
             case Brw_ADMI_DOC_CRS:
             case Brw_ADMI_SHR_CRS:
             case Brw_ADMI_MRK_CRS:	// Notify all users in course except me
-               sprintf (Query,"SELECT UsrCod FROM crs_usr"
+               sprintf (SubQuery,"SELECT UsrCod FROM crs_usr"
                               " WHERE CrsCod=%ld"
                               " AND UsrCod<>%ld",
                         Gbl.CurrentCrs.Crs.CrsCod,
                         Gbl.Usrs.Me.UsrDat.UsrCod);
                break;
             case Brw_ADMI_TCH_CRS:	// Notify all teachers in course except me
-               sprintf (Query,"SELECT UsrCod FROM crs_usr"
+               sprintf (SubQuery,"SELECT UsrCod FROM crs_usr"
                               " WHERE CrsCod=%ld"
                               " AND UsrCod<>%ld"
                               " AND Role=%u",	// Notify teachers only
@@ -1228,14 +1250,14 @@ unsigned Ntf_StoreNotifyEventsToAllUsrs (Ntf_NotifyEvent_t NotifyEvent,long Cod)
             case Brw_ADMI_DOC_GRP:
             case Brw_ADMI_SHR_GRP:
             case Brw_ADMI_MRK_GRP:	// Notify all users in group except me
-               sprintf (Query,"SELECT UsrCod FROM crs_grp_usr"
+               sprintf (SubQuery,"SELECT UsrCod FROM crs_grp_usr"
                               " WHERE crs_grp_usr.GrpCod=%ld"
                               " AND crs_grp_usr.UsrCod<>%ld",
                         Gbl.CurrentCrs.Grps.GrpCod,
                         Gbl.Usrs.Me.UsrDat.UsrCod);
                break;
             case Brw_ADMI_TCH_GRP:	// Notify all teachers in group except me
-               sprintf (Query,"SELECT crs_grp_usr.UsrCod"
+               sprintf (SubQuery,"SELECT crs_grp_usr.UsrCod"
         	              " FROM crs_grp_usr,crs_grp,crs_grp_types,crs_usr"
                               " WHERE crs_grp_usr.GrpCod=%ld"
                               " AND crs_grp_usr.UsrCod<>%ld"
@@ -1255,7 +1277,7 @@ unsigned Ntf_StoreNotifyEventsToAllUsrs (Ntf_NotifyEvent_t NotifyEvent,long Cod)
          // 1. If the assignment is available for the whole course ==> get all users enroled in the course except me
          // 2. If the assignment is available only for some groups ==> get all users who belong to any of the groups except me
          // Cases 1 and 2 are mutually exclusive, so the union returns the case 1 or 2
-         sprintf (Query,"(SELECT crs_usr.UsrCod"
+         sprintf (SubQuery,"(SELECT crs_usr.UsrCod"
                         " FROM assignments,crs_usr"
                         " WHERE assignments.AsgCod=%ld"
                         " AND assignments.AsgCod NOT IN"
@@ -1273,7 +1295,7 @@ unsigned Ntf_StoreNotifyEventsToAllUsrs (Ntf_NotifyEvent_t NotifyEvent,long Cod)
          break;
       case Ntf_EVENT_EXAM_ANNOUNCEMENT:
       case Ntf_EVENT_NOTICE:
-         sprintf (Query,"SELECT UsrCod FROM crs_usr"
+         sprintf (SubQuery,"SELECT UsrCod FROM crs_usr"
                         " WHERE CrsCod=%ld AND UsrCod<>%ld",
                   Gbl.CurrentCrs.Crs.CrsCod,
                   Gbl.Usrs.Me.UsrDat.UsrCod);
@@ -1285,7 +1307,7 @@ unsigned Ntf_StoreNotifyEventsToAllUsrs (Ntf_NotifyEvent_t NotifyEvent,long Cod)
       case Ntf_EVENT_ENROLMENT_REQUEST:
 	 if (Gbl.CurrentCrs.Crs.NumUsrs[Rol_TCH])
 	    // If this course has teachers ==> send notification to teachers
-	    sprintf (Query,"SELECT UsrCod FROM crs_usr"
+	    sprintf (SubQuery,"SELECT UsrCod FROM crs_usr"
 			   " WHERE CrsCod=%ld"
 			   " AND UsrCod<>%ld"
 			   " AND Role=%u",	// Notify teachers only
@@ -1297,7 +1319,7 @@ unsigned Ntf_StoreNotifyEventsToAllUsrs (Ntf_NotifyEvent_t NotifyEvent,long Cod)
 	    // and I want to be a teacher (checked before calling this function
 	    // to not send requests to be a student to admins)
 	    // ==> send notification to administrators or superusers
-	    sprintf (Query,"SELECT UsrCod FROM admin"
+	    sprintf (SubQuery,"SELECT UsrCod FROM admin"
 	 		   " WHERE (Scope='%s'"
 	 		   " OR (Scope='%s' AND Cod=%ld)"
 	 		   " OR (Scope='%s' AND Cod=%ld)"
@@ -1311,7 +1333,7 @@ unsigned Ntf_StoreNotifyEventsToAllUsrs (Ntf_NotifyEvent_t NotifyEvent,long Cod)
          break;
       case Ntf_EVENT_TIMELINE_COMMENT:	// New comment to one of my social notes or comments
          // Cod is the code of the social publishing
-	 sprintf (Query,"SELECT DISTINCT(PublisherCod) FROM social_pubs"
+	 sprintf (SubQuery,"SELECT DISTINCT PublisherCod AS UsrCod FROM social_pubs"
                         " WHERE NotCod = (SELECT NotCod FROM social_pubs"
                         " WHERE PubCod=%ld)"
                         " AND PublisherCod<>%ld",
@@ -1329,13 +1351,13 @@ unsigned Ntf_StoreNotifyEventsToAllUsrs (Ntf_NotifyEvent_t NotifyEvent,long Cod)
 	 switch (ForumSelected.Type)
 	   {
 	    case For_FORUM_COURSE_USRS:
-	       sprintf (Query,"SELECT UsrCod FROM crs_usr"
+	       sprintf (SubQuery,"SELECT UsrCod FROM crs_usr"
 			      " WHERE CrsCod=%ld AND UsrCod<>%ld",
 			Gbl.CurrentCrs.Crs.CrsCod,
 			Gbl.Usrs.Me.UsrDat.UsrCod);
 	       break;
 	    case For_FORUM_COURSE_TCHS:
-	       sprintf (Query,"SELECT UsrCod FROM crs_usr"
+	       sprintf (SubQuery,"SELECT UsrCod FROM crs_usr"
 			      " WHERE CrsCod=%ld AND Role=%u AND UsrCod<>%ld",
 			Gbl.CurrentCrs.Crs.CrsCod,
 			(unsigned) Rol_TCH,
@@ -1346,7 +1368,7 @@ unsigned Ntf_StoreNotifyEventsToAllUsrs (Ntf_NotifyEvent_t NotifyEvent,long Cod)
 	   }
          break;
       case Ntf_EVENT_FORUM_REPLY:
-         sprintf (Query,"SELECT DISTINCT(UsrCod) FROM forum_post"
+         sprintf (SubQuery,"SELECT DISTINCT UsrCod FROM forum_post"
                         " WHERE ThrCod = (SELECT ThrCod FROM forum_post"
                         " WHERE PstCod=%ld)"
                         " AND UsrCod<>%ld",
@@ -1358,7 +1380,7 @@ unsigned Ntf_StoreNotifyEventsToAllUsrs (Ntf_NotifyEvent_t NotifyEvent,long Cod)
          // 1. If the survey is available for the whole course ==> get users enroled in the course whose role is available in survey, except me
          // 2. If the survey is available only for some groups ==> get users who belong to any of the groups and whose role is available in survey, except me
          // Cases 1 and 2 are mutually exclusive, so the union returns the case 1 or 2
-         sprintf (Query,"(SELECT crs_usr.UsrCod"
+         sprintf (SubQuery,"(SELECT crs_usr.UsrCod"
                         " FROM surveys,crs_usr"
                         " WHERE surveys.SvyCod=%ld"
                         " AND surveys.SvyCod NOT IN"
@@ -1386,42 +1408,99 @@ unsigned Ntf_StoreNotifyEventsToAllUsrs (Ntf_NotifyEvent_t NotifyEvent,long Cod)
          break;
      }
 
-   if ((NumRows = DB_QuerySELECT (Query,&mysql_res,"can not get users to be notified"))) // Users found
-     {
-      /***** Initialize structure with user's data *****/
-      Usr_UsrDataConstructor (&UsrDat);
+   /***** Store notify event to all users who want to be notified *****/
+   return Ntf_StoreNotifyEventToUsrsInSubQuery (NotifyEvent,SubQuery,Cod);
+  }
 
-      /***** Notify the users one by one *****/
-      for (NumRow = 0;
-	   NumRow < NumRows;
-	   NumRow++)
-	{
-         /* Get next user */
-         row = mysql_fetch_row (mysql_res);
+/*****************************************************************************/
+/************ Store a notify event to several users into database ************/
+/*****************************************************************************/
+// UsrCodsList is a list of users' codes separated by commas
+// Return the number of users notified by email
 
-         /* Get user code */
-         UsrDat.UsrCod = Str_ConvertStrCodToLongCod (row[0]);
+unsigned Ntf_StoreNotifyEventToSeveralUsrs (Ntf_NotifyEvent_t NotifyEvent,
+                                            const char *UsrCodsList,long Cod)
+  {
+   char *SubQuery;
+   unsigned NumUsrsToBeNotifiedByEMail;
+
+   /***** Allocate space for subquery *****/
+   if ((SubQuery = (char *) malloc (128 + strlen (UsrCodsList))) == NULL)
+      Lay_ShowErrorAndExit ("Not enough memory to store database query.");
+
+   /***** Build subquery to get users to be notified, except me ******/
+   sprintf (SubQuery,"SELECT UsrCod FROM usr_data"
+		     " WHERE UsrCod IN (%s)"
+		     " AND UsrCod<>%ld",
+	    UsrCodsList,
+	    Gbl.Usrs.Me.UsrDat.UsrCod);
 
-	 if (Usr_ChkUsrCodAndGetAllUsrDataFromUsrCod (&UsrDat))		// Get user's data from the database
-            if ((UsrDat.Prefs.NotifNtfEvents & NotifyEventMask))	// Create notification
-              {
-	       if ((UsrDat.Prefs.EmailNtfEvents & NotifyEventMask))	// Send notification by email
-		 {
-		  Ntf_StoreNotifyEventToOneUser (NotifyEvent,&UsrDat,Cod,
-						 (Ntf_Status_t) Ntf_STATUS_BIT_EMAIL);
-		  NumUsrsToBeNotifiedByEMail++;
-		 }
-	       else							// Don't send notification by email
-		  Ntf_StoreNotifyEventToOneUser (NotifyEvent,&UsrDat,Cod,(Ntf_Status_t) 0);
-              }
-        }
+   /***** Store notify event to all users who want to be notified *****/
+   NumUsrsToBeNotifiedByEMail = Ntf_StoreNotifyEventToUsrsInSubQuery (NotifyEvent,SubQuery,Cod);
 
-      /***** Free memory used for user's data *****/
-      Usr_UsrDataDestructor (&UsrDat);
-     }
+   /***** Free space used for subquery *****/
+   free ((void *) SubQuery);
 
-   /***** Free structure that stores the query result *****/
-   DB_FreeMySQLResult (&mysql_res);
+   return NumUsrsToBeNotifiedByEMail;
+  }
+
+/*****************************************************************************/
+/******* Store a notify event to the users got by a subquery into database ***/
+/*****************************************************************************/
+// SubQuery must return a column UsrCod
+// Return the number of users notified by email
+
+static unsigned Ntf_StoreNotifyEventToUsrsInSubQuery (Ntf_NotifyEvent_t NotifyEvent,
+                                                      const char *SubQuery,long Cod)
+  {
+   char *Query;
+   unsigned NumUsrsToBeNotifiedByEMail;
+   unsigned NotifyEventMask = (1 << NotifyEvent);
+   long InsCod;
+   long CtrCod;
+   long DegCod;
+   long CrsCod;
+
+   /***** Allocate space for query *****/
+   if ((Query = (char *) malloc (1024 + strlen (SubQuery))) == NULL)
+      Lay_ShowErrorAndExit ("Not enough memory to store database query.");
+
+   /***** Get number of users who want to be notified by email *****/
+   // Users with a wrong value in EmailNtfEvents are not notified by email
+   sprintf (Query,"SELECT COUNT(*) FROM (%s) AS U,usr_data"
+	          " WHERE U.UsrCod=usr_data.UsrCod"
+	          " AND (usr_data.NotifNtfEvents & %u)<>0"
+	          " AND usr_data.EmailNtfEvents<%u"
+	          " AND (usr_data.EmailNtfEvents & %u)<>0",
+	    SubQuery,
+	    NotifyEventMask,
+	    (unsigned) (1 << Ntf_NUM_NOTIFY_EVENTS),
+	    NotifyEventMask);
+   NumUsrsToBeNotifiedByEMail = (unsigned) DB_QueryCOUNT (Query,"can not get number of users to be notified");
+
+   /***** Store notify event to all users who want to be notified,
+          in only one query *****/
+   Ntf_GetLocationOfNotifyEvent (NotifyEvent,&InsCod,&CtrCod,&DegCod,&CrsCod);
+   sprintf (Query,"INSERT INTO notif"
+	          " (NotifyEvent,ToUsrCod,FromUsrCod,"
+	          "InsCod,CtrCod,DegCod,CrsCod,Cod,TimeNotif,Status)"
+                  " SELECT %u,usr_data.UsrCod,%ld,"
+                  "%ld,%ld,%ld,%ld,%ld,NOW(),"
+                  "IF(usr_data.EmailNtfEvents<%u"
+                  " AND (usr_data.EmailNtfEvents & %u)<>0,%u,0)"
+                  " FROM (%s) AS U,usr_data"
+	          " WHERE U.UsrCod=usr_data.UsrCod"
+	          " AND (usr_data.NotifNtfEvents & %u)<>0",
+            (unsigned) NotifyEvent,Gbl.Usrs.Me.UsrDat.UsrCod,
+            InsCod,CtrCod,DegCod,CrsCod,Cod,
+            (unsigned) (1 << Ntf_NUM_NOTIFY_EVENTS),
+            NotifyEventMask,(unsigned) Ntf_STATUS_BIT_EMAIL,
+            SubQuery,
+            NotifyEventMask);
+   DB_QueryINSERT (Query,"can not create new notification events");
+
+   /***** Free space used for query *****/
+   free ((void *) Query);
 
    return NumUsrsToBeNotifiedByEMail;
   }
@@ -1440,27 +1519,50 @@ void Ntf_StoreNotifyEventToOneUser (Ntf_NotifyEvent_t NotifyEvent,
    long DegCod;
    long CrsCod;
 
+   /***** Get location of notify event *****/
+   Ntf_GetLocationOfNotifyEvent (NotifyEvent,&InsCod,&CtrCod,&DegCod,&CrsCod);
+
+   /***** Store notify event *****/
+   sprintf (Query,"INSERT INTO notif"
+	          " (NotifyEvent,ToUsrCod,FromUsrCod,"
+	          "InsCod,CtrCod,DegCod,CrsCod,Cod,TimeNotif,Status)"
+                  " VALUES"
+                  " (%u,%ld,%ld,"
+                  "%ld,%ld,%ld,%ld,%ld,NOW(),%u)",
+            (unsigned) NotifyEvent,UsrDat->UsrCod,Gbl.Usrs.Me.UsrDat.UsrCod,
+            InsCod,CtrCod,DegCod,CrsCod,Cod,(unsigned) Status);
+   DB_QueryINSERT (Query,"can not create new notification event");
+  }
+
+/*****************************************************************************/
+/*** Get institution, centre, degree and course where a notify event is ******/
+/*****************************************************************************/
+
+static void Ntf_GetLocationOfNotifyEvent (Ntf_NotifyEvent_t NotifyEvent,
+                                          long *InsCod,long *CtrCod,
+                                          long *DegCod,long *CrsCod)
+  {
    if (NotifyEvent == Ntf_EVENT_FORUM_POST_COURSE ||
        NotifyEvent == Ntf_EVENT_FORUM_REPLY)
      {
-      InsCod = CtrCod = DegCod = CrsCod = -1L;
+      *InsCod = *CtrCod = *DegCod = *CrsCod = -1L;
       switch (Gbl.Forum.ForumSelected.Type)
         {
 	 case For_FORUM_INSTIT_USRS:
 	 case For_FORUM_INSTIT_TCHS:
-            InsCod = Gbl.Forum.ForumSelected.Location;
+            *InsCod = Gbl.Forum.ForumSelected.Location;
             break;
 	 case For_FORUM_CENTRE_USRS:
 	 case For_FORUM_CENTRE_TCHS:
-            CtrCod = Gbl.Forum.ForumSelected.Location;
+            *CtrCod = Gbl.Forum.ForumSelected.Location;
             break;
 	 case For_FORUM_DEGREE_USRS:
 	 case For_FORUM_DEGREE_TCHS:
-            DegCod = Gbl.Forum.ForumSelected.Location;
+            *DegCod = Gbl.Forum.ForumSelected.Location;
             break;
 	 case For_FORUM_COURSE_USRS:
 	 case For_FORUM_COURSE_TCHS:
-            CrsCod = Gbl.Forum.ForumSelected.Location;
+            *CrsCod = Gbl.Forum.ForumSelected.Location;
             break;
 	 default:
 	    break;
@@ -1468,22 +1570,11 @@ void Ntf_StoreNotifyEventToOneUser (Ntf_NotifyEvent_t NotifyEvent,
      }
    else
      {
-      InsCod = Gbl.CurrentIns.Ins.InsCod;
-      CtrCod = Gbl.CurrentCtr.Ctr.CtrCod;
-      DegCod = Gbl.CurrentDeg.Deg.DegCod;
-      CrsCod = Gbl.CurrentCrs.Crs.CrsCod;
+      *InsCod = Gbl.CurrentIns.Ins.InsCod;
+      *CtrCod = Gbl.CurrentCtr.Ctr.CtrCod;
+      *DegCod = Gbl.CurrentDeg.Deg.DegCod;
+      *CrsCod = Gbl.CurrentCrs.Crs.CrsCod;
      }
-
-   /***** Store notify event *****/
-   sprintf (Query,"INSERT INTO notif"
-	          " (NotifyEvent,ToUsrCod,FromUsrCod,"
-	          "InsCod,CtrCod,DegCod,CrsCod,Cod,TimeNotif,Status)"
-                  " VALUES"
-                  " (%u,%ld,%ld,"
-                  "%ld,%ld,%ld,%ld,%ld,NOW(),%u)",
-            (unsigned) NotifyEvent,UsrDat->UsrCod,Gbl.Usrs.Me.UsrDat.UsrCod,
-            InsCod,CtrCod,DegCod,CrsCod,Cod,(unsigned) Status);
-   DB_QueryINSERT (Query,"can not create new notification event");
   }
 
 /*****************************************************************************/
@@ -2030,11 +2121,10 @@ void Ntf_WriteNumberOfNewNtfs (void)
    extern const char *Txt_NOTIF_new_SINGULAR;
    extern const char *Txt_NOTIF_new_PLURAL;
    unsigned NumUnseenNtfs;
-   unsigned NumNewNtfs = 0;
+   unsigned NumNewNtfs;
 
    /***** Get my number of unseen notifications *****/
-   if ((NumUnseenNtfs = Ntf_GetNumberOfAllMyUnseenNtfs ()))
-      NumNewNtfs = Ntf_GetNumberOfMyNewUnseenNtfs ();
+   NumUnseenNtfs = Ntf_GetNumberOfMyUnseenNtfs (&NumNewNtfs);
 
    /***** Start form *****/
    Act_FormStartId (ActSeeNewNtf,"form_ntf");
@@ -2066,36 +2156,46 @@ void Ntf_WriteNumberOfNewNtfs (void)
   }
 
 /*****************************************************************************/
-/************* Get the number of (all) my unseen notifications ***************/
+/************ Get the number of (all and new) unseen notifications ***********/
 /*****************************************************************************/
+// Return the number of all my unseen notifications
+// and get the number of new ones (after my last access to notifications)
 
-static unsigned Ntf_GetNumberOfAllMyUnseenNtfs (void)
+static unsigned Ntf_GetNumberOfMyUnseenNtfs (unsigned *NumNewNtfs)
   {
    char Query[512];
+   MYSQL_RES *mysql_res;
+   MYSQL_ROW row;
+   unsigned NumUnseenNtfs = 0;
+
+   *NumNewNtfs = 0;
 
-   /***** Get number of places with a name from database *****/
-   sprintf (Query,"SELECT COUNT(*) FROM notif"
+   /***** Get number of all and new unseen notifications from database *****/
+   sprintf (Query,"SELECT COUNT(*),"
+	          "SUM(TimeNotif>FROM_UNIXTIME(%ld))"
+	          " FROM notif"
                   " WHERE ToUsrCod=%ld AND (Status & %u)=0",
-            Gbl.Usrs.Me.UsrDat.UsrCod,(unsigned) (Ntf_STATUS_BIT_READ | Ntf_STATUS_BIT_REMOVED));
-   return DB_QueryCOUNT (Query,"can not get number of unseen notifications");
-  }
+            Gbl.Usrs.Me.UsrLast.LastAccNotif,
+            Gbl.Usrs.Me.UsrDat.UsrCod,
+            (unsigned) (Ntf_STATUS_BIT_READ | Ntf_STATUS_BIT_REMOVED));
+   if (DB_QuerySELECT (Query,&mysql_res,"can not get number of unseen notifications"))
+     {
+      row = mysql_fetch_row (mysql_res);
 
-/*****************************************************************************/
-/************** Get the number of my new unseen notifications ****************/
-/*****************************************************************************/
+      /* Get number of all unseen notifications (row[0]) */
+      if (sscanf (row[0],"%u",&NumUnseenNtfs) != 1)
+	 NumUnseenNtfs = 0;
 
-static unsigned Ntf_GetNumberOfMyNewUnseenNtfs (void)
-  {
-   char Query[256];
+      /* Get number of new unseen notifications (row[1]) */
+      if (row[1])	// Sum is NULL when there are no notifications
+	 if (sscanf (row[1],"%u",NumNewNtfs) != 1)
+	    *NumNewNtfs = 0;
+     }
 
-   /***** Get number of places with a name from database *****/
-   sprintf (Query,"SELECT COUNT(*) FROM notif"
-                  " WHERE ToUsrCod=%ld AND (Status & %u)=0"
-                  " AND TimeNotif>FROM_UNIXTIME(%ld)",
-            Gbl.Usrs.Me.UsrDat.UsrCod,
-            (unsigned) (Ntf_STATUS_BIT_READ | Ntf_STATUS_BIT_REMOVED),
-            Gbl.Usrs.Me.UsrLast.LastAccNotif);
-   return DB_QueryCOUNT (Query,"can not get number of unseen notifications");
+   /***** Free structure that stores the query result *****/
+   DB_FreeMySQLResult (&mysql_res);
+
+   return NumUnseenNtfs;
   }
 
 /*****************************************************************************/
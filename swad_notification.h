@@ -126,11 +126,15 @@ void Ntf_GetNotifSummaryAndContent (char SummaryStr[Ntf_MAX_BYTES_SUMMARY + 1],
 void Ntf_MarkNotifAsSeen (Ntf_NotifyEvent_t NotifyEvent,long Cod,long CrsCod,long ToUsrCod);
 void Ntf_MarkNotifAsRemoved (Ntf_NotifyEvent_t NotifyEvent,long Cod);
 void Ntf_MarkNotifToOneUsrAsRemoved (Ntf_NotifyEvent_t NotifyEvent,long Cod,long ToUsrCod);
+void Ntf_MarkNotifToSeveralUsrsAsRemoved (Ntf_NotifyEvent_t NotifyEvent,
+                                          const char *UsrCodsList);
 void Ntf_MarkNotifInCrsAsRemoved (long ToUsrCod,long CrsCod);
 void Ntf_MarkNotifOneFileAsRemoved (const char *Path);
 void Ntf_MarkNotifChildrenOfFolderAsRemoved (const char *Path);
 void Ntf_MarkNotifFilesInGroupAsRemoved (long GrpCod);
 unsigned Ntf_StoreNotifyEventsToAllUsrs (Ntf_NotifyEvent_t NotifyEvent,long Cod);
+unsigned Ntf_StoreNotifyEventToSeveralUsrs (Ntf_NotifyEvent_t NotifyEvent,
+                                            const char *UsrCodsList,long Cod);
 void Ntf_StoreNotifyEventToOneUser (Ntf_NotifyEvent_t NotifyEvent,
                                     struct UsrData *UsrDat,
                                     long Cod,Ntf_Status_t Status);
@@ -25,6 +25,7 @@
 /********************************** Headers **********************************/
 /*****************************************************************************/
 
+#define _GNU_SOURCE 		// For memmem
 #include <ctype.h>		// For isprint, isspace, etc.
 #include <linux/stddef.h>	// For NULL
 #include <stdlib.h>		// For calloc
@@ -61,8 +62,8 @@ static void Par_GetBoundary (void);
 
 static void Par_CreateListOfParamsFromQueryString (void);
 static void Par_CreateListOfParamsFromTmpFile (void);
-static int Par_ReadTmpFileUntilQuote (void);
-static int Par_ReadTmpFileUntilReturn (void);
+static bool Par_SkipStrInTmpFile (const char **Ptr,const char *End,
+                                  const char *Str,size_t Length);
 
 static bool Par_CheckIsParamCanBeUsedInGETMethod (const char *ParamName);
 
@@ -291,162 +292,127 @@ static void Par_CreateListOfParamsFromQueryString (void)
 /*****************************************************************************/
 /*************** Create list of parameters from temporary file ***************/
 /*****************************************************************************/
+// The temporary file is mapped in memory (Gbl.F.TmpMap),
+// so it is scanned looking for boundaries without reading it again
 // TODO: Rename Gbl.F.Tmp to Gbl.F.In (InFile, QueryFile)?
 
 #define Par_LENGTH_OF_STR_BEFORE_PARAM	38		// Length of "Content-Disposition: form-data; name=\""
 #define Par_LENGTH_OF_STR_FILENAME	12		// Length of "; filename=\""
 #define Par_LENGTH_OF_STR_CONTENT_TYPE	14		// Length of "Content-Type: "
-#define Par_MAX_BYTES_STR_AUX		(38 + 1)	// Space to read any of the three preceding strings
 
 static void Par_CreateListOfParamsFromTmpFile (void)
   {
    static const char *StringBeforeParam = "Content-Disposition: form-data; name=\"";
    static const char *StringFilename = "; filename=\"";
    static const char *StringContentType = "Content-Type: ";
-   unsigned long CurPos;	// Current position in temporal file
-   struct Param *Param = NULL;	// Initialized to avoid warning
+   const char *Start = Gbl.F.TmpMap;			// Start of temporary file
+   const char *End = Gbl.F.TmpMap + Gbl.F.TmpSize;	// End of temporary file
+   const char *Ptr;		// Current position in temporary file
+   const char *PtrEnd;		// End of name, filename, content type or value
+   const char *PtrContentType;	// Used to check if content type is present
+   struct Param *Param = NULL;
    struct Param *NewParam;
-   int Ch;
-   char StrAux[Par_MAX_BYTES_STR_AUX + 1];
+
+   /***** Check if temporary file is empty *****/
+   if (Gbl.F.TmpMap == NULL)
+      return;
+
+   /***** Go to just after first delimiter string *****/
+   if ((Ptr = memmem (Start,Gbl.F.TmpSize,
+                      Gbl.Boundary.StrWithoutCRLF,
+                      Gbl.Boundary.LengthWithoutCRLF)) == NULL)	// Delimiter string not found
+      return;
+   Ptr += Gbl.Boundary.LengthWithoutCRLF;
 
    /***** Go over the file
           getting start positions and lengths of parameters *****/
-   if (Str_ReadFileUntilBoundaryStr (Gbl.F.Tmp,NULL,
-                                     Gbl.Boundary.StrWithoutCRLF,
-                                     Gbl.Boundary.LengthWithoutCRLF,
-                                     Fil_MAX_FILE_SIZE) == 1)	// Delimiter string found
-
-      for (CurPos = 0;
-	   CurPos < Gbl.Params.ContentLength;
-	   )
-	{
-	 /***** Skip \r\n after delimiter string *****/
-	 if (fgetc (Gbl.F.Tmp) != 0x0D) break;	// '\r'
-	 if (fgetc (Gbl.F.Tmp) != 0x0A) break;	// '\n'
+   while (Ptr < End)
+     {
+      /***** Skip \r\n after delimiter string *****/
+      if (!Par_SkipStrInTmpFile (&Ptr,End,"\r\n",2))
+	 break;
 
-	 Str_GetNextStrFromFileConvertingToLower (Gbl.F.Tmp,StrAux,
-	                                          Par_LENGTH_OF_STR_BEFORE_PARAM);
-	 if (!strcasecmp (StrAux,StringBeforeParam)) // Start of a parameter
-	   {
-	    /* Allocate space for a new parameter initialized to 0 */
-	    if ((NewParam = (struct Param *) calloc (1,sizeof (struct Param))) == NULL)
-	       Lay_ShowErrorAndExit ("Error allocating memory for parameter");
-
-	    /* Link the previous element in list with the current element */
-	    if (CurPos == 0)
-	       Gbl.Params.List = NewParam;	// Pointer to first param
-	    else
-	       Param->Next = NewParam;	// Pointer from former param to new param
-
-	    /* Make the current element to be the just created */
-	    Param = NewParam;
-
-	    /***** Get parameter name *****/
-	    CurPos = (unsigned long) ftell (Gbl.F.Tmp);	// At start of parameter name
-	    Param->Name.Start = CurPos;
-	    Ch = Par_ReadTmpFileUntilQuote ();
-	    CurPos = (unsigned long) ftell (Gbl.F.Tmp);	// Just after quote
-	    Param->Name.Length = CurPos - 1 - Param->Name.Start;
-
-	    /* Check if last character read after parameter name is a quote */
-	    if (Ch != (int) '\"') break;		// '\"'
-
-	    /* Get next char after parameter name */
-	    Ch = fgetc (Gbl.F.Tmp);
-
-	    /***** Check if filename is present *****/
-	    if (Ch == (int) StringFilename[0])
-	      {
-	       Str_GetNextStrFromFileConvertingToLower (Gbl.F.Tmp,StrAux,
-	                                                Par_LENGTH_OF_STR_FILENAME-1);
-	       if (!strcasecmp (StrAux,StringFilename + 1))	// Start of filename
-		 {
-		  /* Get filename */
-		  CurPos = (unsigned long) ftell (Gbl.F.Tmp);	// At start of filename
-		  Param->FileName.Start = CurPos;
-		  Ch = Par_ReadTmpFileUntilQuote ();
-		  CurPos = (unsigned long) ftell (Gbl.F.Tmp);	// Just after quote
-		  Param->FileName.Length = CurPos - 1 - Param->FileName.Start;
-
-		  /* Check if last character read after filename is a quote */
-		  if (Ch != (int) '\"') break;		// '\"'
-
-		  /* Skip \r\n */
-		  if (fgetc (Gbl.F.Tmp) != 0x0D) break;	// '\r'
-		  if (fgetc (Gbl.F.Tmp) != 0x0A) break;	// '\n'
-
-		  /* Check if Content-Type is present */
-		  Str_GetNextStrFromFileConvertingToLower (Gbl.F.Tmp,StrAux,
-		                                           Par_LENGTH_OF_STR_CONTENT_TYPE);
-		  if (!strcasecmp (StrAux,StringContentType)) // Start of Content-Type
-		    {
-		     /* Get content type */
-		     CurPos = (unsigned long) ftell (Gbl.F.Tmp);	// At start of content type
-		     Param->ContentType.Start = CurPos;
-		     Ch = Par_ReadTmpFileUntilReturn ();
-		     CurPos = (unsigned long) ftell (Gbl.F.Tmp);	// Just after return
-		     Param->ContentType.Length = CurPos - 1 - Param->ContentType.Start;
-		    }
-		 }
-	      }
+      /***** Check start of a parameter *****/
+      if (!Par_SkipStrInTmpFile (&Ptr,End,StringBeforeParam,Par_LENGTH_OF_STR_BEFORE_PARAM))
+	 break;
 
-	    /***** Now \r\n\r\n is expected just before parameter value or file content *****/
-	    /* Check if last character read is '\r' */
-	    if (Ch != 0x0D) break;			// '\r'
-
-	    /* Skip \n\r\n */
-	    if (fgetc (Gbl.F.Tmp) != 0x0A) break;	// '\n'
-	    if (fgetc (Gbl.F.Tmp) != 0x0D) break;	// '\r'
-	    if (fgetc (Gbl.F.Tmp) != 0x0A) break;	// '\n'
-
-	    /***** Get parameter value or file content *****/
-	    CurPos = (unsigned long) ftell (Gbl.F.Tmp);	// At start of value or file content
-	    if (Str_ReadFileUntilBoundaryStr (Gbl.F.Tmp,NULL,
-					      Gbl.Boundary.StrWithCRLF,
-					      Gbl.Boundary.LengthWithCRLF,
-					      Fil_MAX_FILE_SIZE) != 1) break;	// Boundary string not found
-
-	    // Delimiter string found
-	    Param->Value.Start = CurPos;
-	    CurPos = (unsigned long) ftell (Gbl.F.Tmp);	// Just after delimiter string
-	    Param->Value.Length = CurPos - Gbl.Boundary.LengthWithCRLF -
-		                  Param->Value.Start;
-	   }
-        }
-  }
+      /* Allocate space for a new parameter initialized to 0 */
+      if ((NewParam = (struct Param *) calloc (1,sizeof (struct Param))) == NULL)
+	 Lay_ShowErrorAndExit ("Error allocating memory for parameter");
 
-/*****************************************************************************/
-/******************** Read from file until quote '\"' ************************/
-/*****************************************************************************/
-// Return last char read
+      /* Link the previous element in list with the current element */
+      if (Param == NULL)
+	 Gbl.Params.List = NewParam;	// Pointer to first param
+      else
+	 Param->Next = NewParam;	// Pointer from former param to new param
 
-static int Par_ReadTmpFileUntilQuote (void)
-  {
-   int Ch;
+      /* Make the current element to be the just created */
+      Param = NewParam;
 
-   /***** Read until quote if found *****/
-   do
-      Ch = fgetc (Gbl.F.Tmp);
-   while (Ch != EOF && Ch != (int) '\"');
+      /***** Get parameter name *****/
+      if ((PtrEnd = memchr (Ptr,(int) '\"',(size_t) (End - Ptr))) == NULL)
+	 break;
+      Param->Name.Start  = (unsigned long) (Ptr - Start);	// At start of parameter name
+      Param->Name.Length = (unsigned long) (PtrEnd - Ptr);
+      Ptr = PtrEnd + 1;						// Just after quote
+
+      /***** Check if filename is present *****/
+      if (Par_SkipStrInTmpFile (&Ptr,End,StringFilename,Par_LENGTH_OF_STR_FILENAME))
+	{
+	 /* Get filename */
+	 if ((PtrEnd = memchr (Ptr,(int) '\"',(size_t) (End - Ptr))) == NULL)
+	    break;
+	 Param->FileName.Start  = (unsigned long) (Ptr - Start);	// At start of filename
+	 Param->FileName.Length = (unsigned long) (PtrEnd - Ptr);
+	 Ptr = PtrEnd + 1;						// Just after quote
+
+	 /* Content-Type may be missing ==> content type is left empty */
+	 PtrContentType = Ptr;
+	 if (Par_SkipStrInTmpFile (&PtrContentType,End,"\r\n",2) &&
+	     Par_SkipStrInTmpFile (&PtrContentType,End,StringContentType,Par_LENGTH_OF_STR_CONTENT_TYPE))
+	   {
+	    /* Get content type */
+	    if ((PtrEnd = memchr (PtrContentType,0x0D,(size_t) (End - PtrContentType))) == NULL)	// '\r'
+	       break;
+	    Param->ContentType.Start  = (unsigned long) (PtrContentType - Start);	// At start of content type
+	    Param->ContentType.Length = (unsigned long) (PtrEnd - PtrContentType);
+	    Ptr = PtrEnd;							// At return
+	   }
+	}
+
+      /***** Now \r\n\r\n is expected just before parameter value or file content *****/
+      if (!Par_SkipStrInTmpFile (&Ptr,End,"\r\n\r\n",4))
+	 break;
+
+      /***** Get parameter value or file content *****/
+      if ((PtrEnd = memmem (Ptr,(size_t) (End - Ptr),
+			    Gbl.Boundary.StrWithCRLF,
+			    Gbl.Boundary.LengthWithCRLF)) == NULL)	// Boundary string not found
+	 break;
 
-   return Ch;
+      // Delimiter string found
+      Param->Value.Start  = (unsigned long) (Ptr - Start);	// At start of value or file content
+      Param->Value.Length = (unsigned long) (PtrEnd - Ptr);
+      Ptr = PtrEnd + Gbl.Boundary.LengthWithCRLF;		// Just after delimiter string
+     }
   }
 
 /*****************************************************************************/
-/*************************** Read from file until \r *************************/
+/*********** Skip a string at current position of temporary file *************/
 /*****************************************************************************/
-// Return last char read
+// Comparison is case insensitive
+// Return true and advance current position if string is found
 
-static int Par_ReadTmpFileUntilReturn (void)
+static bool Par_SkipStrInTmpFile (const char **Ptr,const char *End,
+                                  const char *Str,size_t Length)
   {
-   int Ch;
-
-   /***** Read until \r if found *****/
-   do
-      Ch = fgetc (Gbl.F.Tmp);
-   while (Ch != EOF && Ch != 0x0D);	// '\r'
+   if ((size_t) (End - *Ptr) < Length)
+      return false;
+   if (strncasecmp (*Ptr,Str,Length))
+      return false;
 
-   return Ch;
+   *Ptr += Length;
+   return true;
   }
 
 /*****************************************************************************/
@@ -484,7 +450,6 @@ unsigned Par_GetParameter (tParamType ParamType,const char *ParamName,
                            struct Param **ParamPtr)	// NULL if not used
   {
    size_t BytesAlreadyCopied = 0;
-   unsigned i;
    struct Param *Param;
    char *PtrDst;
    unsigned NumTimes;
@@ -527,12 +492,9 @@ unsigned Par_GetParameter (tParamType ParamType,const char *ParamName,
 					 Param->Name.Length);
 		  break;
 	       case Act_CONT_DATA:
-		  fseek (Gbl.F.Tmp,Param->Name.Start,SEEK_SET);
-		  for (i = 0, ParamFound = true;
-		       i < Param->Name.Length && ParamFound;
-		       i++)
-		     if (ParamName[i] != (char) fgetc (Gbl.F.Tmp))
-			ParamFound = false;
+		  ParamFound = !memcmp ((const void *) ParamName,
+		                        (const void *) &Gbl.F.TmpMap[Param->Name.Start],
+					Param->Name.Length);
 		  break;
 	      }
 
@@ -591,10 +553,9 @@ unsigned Par_GetParameter (tParamType ParamType,const char *ParamName,
 		        if (Param->FileName.Start == 0 &&	// Copy into destination only if it's not a file
 		            PtrDst)
 		          {
-			   fseek (Gbl.F.Tmp,Param->Value.Start,SEEK_SET);
-			   if (fread ((void *) PtrDst,sizeof (char),Param->Value.Length,Gbl.F.Tmp) !=
-			       Param->Value.Length)
-			      Lay_ShowErrorAndExit ("Error while getting value of parameter.");
+			   memcpy ((void *) PtrDst,
+			           (const void *) &Gbl.F.TmpMap[Param->Value.Start],
+			           Param->Value.Length);
 		          }
 			break;
 		    }
@@ -725,12 +686,14 @@ void Par_GetMainParameters (void)
        Gbl.Action.Act == ActRefLstClk       ||
        Gbl.Action.Act == ActRefNewSocPubGbl ||
        Gbl.Action.Act == ActRefOldSocPubGbl ||
-       Gbl.Action.Act == ActRefOldSocPubUsr)
+       Gbl.Action.Act == ActRefOldSocPubUsr ||
+       Gbl.Action.Act == ActRefJob)
      {
       Gbl.Action.UsesAJAX = true;
       if (Gbl.Action.Act == ActRefCon       ||
 	  Gbl.Action.Act == ActRefLstClk    ||
-	  Gbl.Action.Act == ActRefNewSocPubGbl)
+	  Gbl.Action.Act == ActRefNewSocPubGbl ||
+	  Gbl.Action.Act == ActRefJob)
          Gbl.Action.IsAJAXAutoRefresh = true;
      }
 
@@ -28,10 +28,14 @@
 #include <linux/limits.h>	// For PATH_MAX
 #include <linux/stddef.h>	// For NULL
 #include <math.h>		// For log10, floor, ceil, modf, sqrt...
+#include <stdint.h>		// For uint32_t, int32_t
 #include <stdlib.h>		// For system, getenv, etc.
 #include <string.h>		// For string functions
-#include <sys/wait.h>		// For the macro WEXITSTATUS
-#include <unistd.h>		// For unlink
+#include <sys/socket.h>		// For socket, connect, setsockopt
+#include <sys/time.h>		// For gettimeofday
+#include <sys/un.h>		// For sockaddr_un
+#include <sys/wait.h>		// For waitpid and the macro WEXITSTATUS
+#include <unistd.h>		// For unlink, fork, execl
 
 #include "swad_action.h"
 #include "swad_box.h"
@@ -41,6 +45,7 @@
 #include "swad_file.h"
 #include "swad_file_browser.h"
 #include "swad_global.h"
+#include "swad_job.h"
 #include "swad_logo.h"
 #include "swad_parameter.h"
 #include "swad_photo.h"
@@ -63,6 +68,9 @@ extern struct Globals Gbl;
 /***************************** Private constants *****************************/
 /*****************************************************************************/
 
+#define Pho_MAX_DETECTED_FACES			64
+#define Pho_FACE_DETECTION_BYTES_FILE_NAME	64	// Bytes of a file name in a response of face detection service
+
 const char *Pho_StrAvgPhotoDirs[Pho_NUM_AVERAGE_PHOTO_TYPES] =
   {
    Cfg_FOLDER_DEGREE_PHOTO_MEDIAN,
@@ -78,6 +86,28 @@ const char *Pho_StrAvgPhotoPrograms[Pho_NUM_AVERAGE_PHOTO_TYPES] =
 /******************************* Private types *******************************/
 /*****************************************************************************/
 
+struct Pho_DetectedFace
+  {
+   unsigned X;
+   unsigned Y;
+   unsigned Radius;
+   unsigned BackgroundCode;		// 1 ==> face marked in green, suitable as photo
+   char FileName[NAME_MAX + 1];		// Example: "4924a838630e_016"
+  };
+
+struct Pho_DetectedFaces
+  {
+   unsigned Num;
+   struct Pho_DetectedFace Lst[Pho_MAX_DETECTED_FACES];
+  };
+
+struct Pho_AvgPhotoProcess
+  {
+   pid_t PID;			// Process computing the average photo
+   Usr_Sex_t Sex;		// Sex of the students in the average photo
+   struct timeval tvStart;	// When the process was launched
+  };
+
 /*****************************************************************************/
 /***************************** Private variables *****************************/
 /*****************************************************************************/
@@ -94,6 +124,12 @@ static void Pho_ReqOtherUsrPhoto (void);
 static void Pho_ReqPhoto (const struct UsrData *UsrDat,const char *PhotoURL);
 
 static bool Pho_ReceivePhotoAndDetectFaces (bool ItsMe,const struct UsrData *UsrDat);
+static int Pho_DetectFaces (const char *FileNamePhotoTmp,struct Pho_DetectedFaces *Faces);
+static bool Pho_DetectFacesUsingService (const char *FileNamePhotoTmp,
+                                         int *ReturnCode,struct Pho_DetectedFaces *Faces);
+static bool Pho_SendToFaceDetectionService (int Sock,const void *Buffer,size_t Size);
+static bool Pho_ReceiveFromFaceDetectionService (int Sock,void *Buffer,size_t Size);
+static int Pho_DetectFacesUsingCommand (const char *FileNamePhotoTmp,struct Pho_DetectedFaces *Faces);
 
 static void Pho_UpdatePhoto1 (struct UsrData *UsrDat);
 static void Pho_UpdatePhoto2 (void);
@@ -102,9 +138,16 @@ static void Pho_ClearPhotoName (long UsrCod);
 static long Pho_GetDegWithAvgPhotoLeastRecentlyUpdated (void);
 static long Pho_GetTimeAvgPhotoWasComputed (long DegCod);
 static long Pho_GetTimeToComputeAvgPhoto (long DegCod);
-static void Pho_ComputeAveragePhoto (long DegCod,Usr_Sex_t Sex,Rol_Role_t Role,
-                                     Pho_AvgPhotoTypeOfAverage_t TypeOfAverage,const char *DirAvgPhotosRelPath,
-                                     unsigned *NumStds,unsigned *NumStdsWithPhoto,long *TimeToComputeAvgPhotoInMicroseconds);
+static void Pho_ComputeAveragePhotos (long DegCod,Rol_Role_t Role,
+                                      char DirAvgPhotosRelPath[Pho_NUM_AVERAGE_PHOTO_TYPES][PATH_MAX + 1],
+                                      unsigned NumStds[Usr_NUM_SEXS],
+                                      unsigned NumStdsWithPhoto[Usr_NUM_SEXS],
+                                      long TimeToComputeAvgPhotoInMicroseconds[Usr_NUM_SEXS]);
+static void Pho_WaitForAvgPhotoProcess (struct Pho_AvgPhotoProcess *Processes,
+                                        unsigned *NumProcesses,
+                                        long TimeToComputeAvgPhotoInMicroseconds[Usr_NUM_SEXS],
+                                        bool *Error);
+static long Pho_GetElapsedMicroseconds (const struct timeval *tvStart);
 static void Pho_PutSelectorForTypeOfAvg (void);
 static Pho_AvgPhotoTypeOfAverage_t Pho_GetPhotoAvgTypeFromForm (void);
 static void Pho_PutSelectorForHowComputePhotoSize (void);
@@ -595,12 +638,10 @@ static bool Pho_ReceivePhotoAndDetectFaces (bool ItsMe,const struct UsrData *Usr
    char FileNamePhotoSrc[PATH_MAX + 1];
    char FileNamePhotoTmp[PATH_MAX + 1];	// Full name (including path and .jpg) of the destination temporary file
    char FileNamePhotoMap[PATH_MAX + 1];	// Full name (including path) of the temporary file with the original image with faces
-   char FileNameTxtMap[PATH_MAX + 1];	// Full name (including path) of the temporary file with the text neccesary to make the image map
    char PathRelPhoto[PATH_MAX + 1];
-   FILE *FileTxtMap = NULL;		// Temporary file with the text neccesary to make the image map. Initialized to avoid warning
    char MIMEType[Brw_MAX_BYTES_MIME_TYPE + 1];
    bool WrongType = false;
-   char Command[256 + PATH_MAX];	// Command to call the program of preprocessing of photos
+   struct Pho_DetectedFaces Faces;
    int ReturnCode;
    int NumLastForm = 0;	// Initialized to avoid warning
    char FormId[32];
@@ -608,11 +649,7 @@ static bool Pho_ReceivePhotoAndDetectFaces (bool ItsMe,const struct UsrData *Usr
    unsigned NumFacesGreen = 0;
    unsigned NumFacesRed = 0;
    unsigned NumFace;
-   unsigned X;
-   unsigned Y;
-   unsigned Radius;
-   unsigned BackgroundCode;
-   char StrFileName[NAME_MAX + 1];
+   unsigned NumFaceGreen;
    Act_Action_t NextAction;
 
    /***** Creates directories if not exist *****/
@@ -674,32 +711,20 @@ static bool Pho_ReceivePhotoAndDetectFaces (bool ItsMe,const struct UsrData *Usr
             (unsigned) (UsrDat->UsrCod % 100),UsrDat->UsrCod);
    Fil_FastCopyOfFiles (FileNamePhotoTmp,PathRelPhoto);
 
-   /***** Call to program that makes photo processing / face detection *****/
-   sprintf (Command,Cfg_COMMAND_FACE_DETECTION,FileNamePhotoTmp);
-   ReturnCode = system (Command);
-   if (ReturnCode == -1)
-      Lay_ShowErrorAndExit ("Error when running command to process photo and detect faces.");
+   /***** Photo processing / face detection *****/
+   ReturnCode = Pho_DetectFaces (FileNamePhotoTmp,&Faces);
 
    /***** Write message depending on return code *****/
-   ReturnCode = WEXITSTATUS(ReturnCode);
    switch (ReturnCode)
      {
       case 0:        // Faces detected
-         /***** Open text file with text for image map *****/
-         sprintf (FileNameTxtMap,"%s/%s/%s/%s_map.txt",
-                  Cfg_PATH_SWAD_PUBLIC,Cfg_FOLDER_PHOTO,
-                  Cfg_FOLDER_PHOTO_TMP,Gbl.UniqueNameEncrypted);
-         if ((FileTxtMap = fopen (FileNameTxtMap,"rb")) == NULL)
-            Lay_ShowErrorAndExit ("Can not read text file with coordinates of detected faces.");
-
-         /***** Read file with coordinates for image map and compute the number of faces *****/
+         /***** Put a form for each face and compute the number of faces *****/
          NumLastForm = Gbl.Form.Num;
-         while (!feof (FileTxtMap))
+         for (NumFace = 0;
+              NumFace < Faces.Num;
+              NumFace++)
            {
-            if (fscanf (FileTxtMap,"%u %u %u %u %s\n",&X,&Y,&Radius,&BackgroundCode,StrFileName) != 5)        // Example of StrFileName = "4924a838630e_016"
-
-               break;
-            if (BackgroundCode == 1)
+            if (Faces.Lst[NumFace].BackgroundCode == 1)
               {
                NumFacesGreen++;
                if (ItsMe)
@@ -722,7 +747,7 @@ static bool Pho_ReceivePhotoAndDetectFaces (bool ItsMe,const struct UsrData *Usr
 		  Act_FormStart (NextAction);
                   Usr_PutParamUsrCodEncrypted (UsrDat->EncryptedUsrCod);
         	 }
-               Par_PutHiddenParamString ("FileName",StrFileName);
+               Par_PutHiddenParamString ("FileName",Faces.Lst[NumFace].FileName);
                Act_FormEnd ();
               }
             else
@@ -781,24 +806,22 @@ static bool Pho_ReceivePhotoAndDetectFaces (bool ItsMe,const struct UsrData *Usr
    fprintf (Gbl.F.Out,"<map name=\"faces_map\">\n");
    if (NumFacesTotal)
      {
-      /***** Read again the file with coordinates and create area shapes *****/
-      rewind (FileTxtMap);
-      for (NumFace = 0; !feof (FileTxtMap);)
-        {
-         if (fscanf (FileTxtMap,"%u %u %u %u %s\n",&X,&Y,&Radius,&BackgroundCode,StrFileName) != 5)
-            break;
-         if (BackgroundCode == 1)
+      /***** Create area shapes from coordinates of faces *****/
+      for (NumFace = 0, NumFaceGreen = 0;
+           NumFace < Faces.Num;
+           NumFace++)
+         if (Faces.Lst[NumFace].BackgroundCode == 1)
            {
-            NumFace++;
-            sprintf (FormId,"form_%d",NumLastForm + NumFace);
+            NumFaceGreen++;
+            sprintf (FormId,"form_%d",NumLastForm + NumFaceGreen);
             fprintf (Gbl.F.Out,"<area shape=\"circle\""
                                " href=\"javascript:document.getElementById('%s').submit();\""
                                " coords=\"%u,%u,%u\">\n",
-                     FormId,X,Y,Radius);
+                     FormId,
+                     Faces.Lst[NumFace].X,
+                     Faces.Lst[NumFace].Y,
+                     Faces.Lst[NumFace].Radius);
            }
-        }
-      /***** Close text file with text for image map *****/
-      fclose (FileTxtMap);
      }
    fprintf (Gbl.F.Out,"</map>\n");
 
@@ -818,6 +841,199 @@ static bool Pho_ReceivePhotoAndDetectFaces (bool ItsMe,const struct UsrData *Usr
    return (NumFacesGreen != 0);
   }
 
+/*****************************************************************************/
+/********************** Detect faces in a received photo *********************/
+/*****************************************************************************/
+// Return 0 if faces detected, 1 if no faces detected, other value on error
+
+static int Pho_DetectFaces (const char *FileNamePhotoTmp,struct Pho_DetectedFaces *Faces)
+  {
+   int ReturnCode;
+
+   /***** Try first the face detection service,
+          a long-lived process with the detection model already loaded *****/
+   Faces->Num = 0;
+   if (Pho_DetectFacesUsingService (FileNamePhotoTmp,&ReturnCode,Faces))
+      return ReturnCode;
+
+   /***** Service not available ==> run the command *****/
+   Faces->Num = 0;
+   return Pho_DetectFacesUsingCommand (FileNamePhotoTmp,Faces);
+  }
+
+/*****************************************************************************/
+/*************** Detect faces using the face detection service ***************/
+/*****************************************************************************/
+/*
+Protocol over the UNIX socket Cfg_FACE_DETECTION_SOCKET,
+with 32-bit integers in host byte order:
+Request:  Length of path to photo (uint32), path to photo (without '\0')
+Response: Return code (int32), number of faces (uint32),
+          and for each face X, Y, Radius, BackgroundCode (4 x uint32)
+          followed by the file name padded with '\0'
+          (Pho_FACE_DETECTION_BYTES_FILE_NAME bytes)
+*/
+// Return false if the service is not available or it does not respond in time
+
+static bool Pho_DetectFacesUsingService (const char *FileNamePhotoTmp,
+                                         int *ReturnCode,struct Pho_DetectedFaces *Faces)
+  {
+   int Sock;
+   struct sockaddr_un Addr;
+   struct timeval Timeout;
+   uint32_t Length;
+   int32_t Code;
+   uint32_t NumFaces;
+   uint32_t NumFace;
+   uint32_t Coords[4];
+   char FileName[Pho_FACE_DETECTION_BYTES_FILE_NAME + 1];
+   bool Success = false;
+
+   /***** Check if the service is running *****/
+   if (!Fil_CheckIfPathExists (Cfg_FACE_DETECTION_SOCKET))
+      return false;
+
+   /***** Create socket with timeouts,
+          so a busy service with its queue full does not block us *****/
+   if ((Sock = socket (AF_UNIX,SOCK_STREAM,0)) < 0)
+      return false;
+   Timeout.tv_sec  = Cfg_TIME_TO_WAIT_FACE_DETECTION;
+   Timeout.tv_usec = 0;
+   setsockopt (Sock,SOL_SOCKET,SO_SNDTIMEO,&Timeout,sizeof (Timeout));
+   setsockopt (Sock,SOL_SOCKET,SO_RCVTIMEO,&Timeout,sizeof (Timeout));
+
+   /***** Connect to the service *****/
+   memset (&Addr,0,sizeof (Addr));
+   Addr.sun_family = AF_UNIX;
+   Str_Copy (Addr.sun_path,Cfg_FACE_DETECTION_SOCKET,
+             sizeof (Addr.sun_path) - 1);
+   if (connect (Sock,(struct sockaddr *) &Addr,sizeof (Addr)) == 0)
+     {
+      /***** Send request and receive header of response *****/
+      Length = (uint32_t) strlen (FileNamePhotoTmp);
+      if (Pho_SendToFaceDetectionService (Sock,&Length,sizeof (Length)) &&
+          Pho_SendToFaceDetectionService (Sock,FileNamePhotoTmp,(size_t) Length) &&
+          Pho_ReceiveFromFaceDetectionService (Sock,&Code,sizeof (Code)) &&
+          Pho_ReceiveFromFaceDetectionService (Sock,&NumFaces,sizeof (NumFaces)))
+	{
+	 *ReturnCode = (int) Code;
+	 Success = true;
+
+	 /***** Receive faces *****/
+	 for (NumFace = 0;
+	      Success && NumFace < NumFaces;
+	      NumFace++)
+	    if (Pho_ReceiveFromFaceDetectionService (Sock,Coords,sizeof (Coords)) &&
+		Pho_ReceiveFromFaceDetectionService (Sock,FileName,Pho_FACE_DETECTION_BYTES_FILE_NAME))
+	      {
+	       if (Faces->Num < Pho_MAX_DETECTED_FACES)
+		 {
+		  Faces->Lst[Faces->Num].X              = (unsigned) Coords[0];
+		  Faces->Lst[Faces->Num].Y              = (unsigned) Coords[1];
+		  Faces->Lst[Faces->Num].Radius         = (unsigned) Coords[2];
+		  Faces->Lst[Faces->Num].BackgroundCode = (unsigned) Coords[3];
+		  FileName[Pho_FACE_DETECTION_BYTES_FILE_NAME] = '\0';
+		  Str_Copy (Faces->Lst[Faces->Num].FileName,FileName,
+			    NAME_MAX);
+		  Faces->Num++;
+		 }
+	      }
+	    else
+	       Success = false;
+	}
+     }
+
+   /***** Close socket *****/
+   close (Sock);
+
+   return Success;
+  }
+
+/*****************************************************************************/
+/****************** Send data to the face detection service ******************/
+/*****************************************************************************/
+
+static bool Pho_SendToFaceDetectionService (int Sock,const void *Buffer,size_t Size)
+  {
+   const char *Ptr = (const char *) Buffer;
+   ssize_t NumBytes;
+
+   while (Size)
+     {
+      if ((NumBytes = send (Sock,Ptr,Size,MSG_NOSIGNAL)) <= 0)
+	 return false;	// Error or timeout
+      Ptr  += NumBytes;
+      Size -= (size_t) NumBytes;
+     }
+   return true;
+  }
+
+/*****************************************************************************/
+/*************** Receive data from the face detection service ****************/
+/*****************************************************************************/
+
+static bool Pho_ReceiveFromFaceDetectionService (int Sock,void *Buffer,size_t Size)
+  {
+   char *Ptr = (char *) Buffer;
+   ssize_t NumBytes;
+
+   while (Size)
+     {
+      if ((NumBytes = recv (Sock,Ptr,Size,0)) <= 0)
+	 return false;	// Error, timeout or connection closed
+      Ptr  += NumBytes;
+      Size -= (size_t) NumBytes;
+     }
+   return true;
+  }
+
+/*****************************************************************************/
+/********** Detect faces running the face detection command program **********/
+/*****************************************************************************/
+// Return 0 if faces detected, 1 if no faces detected, other value on error
+
+static int Pho_DetectFacesUsingCommand (const char *FileNamePhotoTmp,struct Pho_DetectedFaces *Faces)
+  {
+   char Command[256 + PATH_MAX];	// Command to call the program of preprocessing of photos
+   int ReturnCode;
+   char FileNameTxtMap[PATH_MAX + 1];	// Full name (including path) of the temporary file with the text neccesary to make the image map
+   FILE *FileTxtMap;			// Temporary file with the text neccesary to make the image map
+   struct Pho_DetectedFace *Face;
+
+   /***** Call to program that makes photo processing / face detection *****/
+   sprintf (Command,Cfg_COMMAND_FACE_DETECTION,FileNamePhotoTmp);
+   ReturnCode = system (Command);
+   if (ReturnCode == -1)
+      Lay_ShowErrorAndExit ("Error when running command to process photo and detect faces.");
+   ReturnCode = WEXITSTATUS(ReturnCode);
+
+   if (ReturnCode == 0)	// Faces detected
+     {
+      /***** Open text file with text for image map *****/
+      sprintf (FileNameTxtMap,"%s/%s/%s/%s_map.txt",
+	       Cfg_PATH_SWAD_PUBLIC,Cfg_FOLDER_PHOTO,
+	       Cfg_FOLDER_PHOTO_TMP,Gbl.UniqueNameEncrypted);
+      if ((FileTxtMap = fopen (FileNameTxtMap,"rb")) == NULL)
+	 Lay_ShowErrorAndExit ("Can not read text file with coordinates of detected faces.");
+
+      /***** Read file with coordinates for image map *****/
+      while (Faces->Num < Pho_MAX_DETECTED_FACES)
+	{
+	 Face = &Faces->Lst[Faces->Num];
+	 if (fscanf (FileTxtMap,"%u %u %u %u %255s\n",
+		     &Face->X,&Face->Y,&Face->Radius,&Face->BackgroundCode,
+		     Face->FileName) != 5)
+	    break;
+	 Faces->Num++;
+	}
+
+      /***** Close text file with text for image map *****/
+      fclose (FileTxtMap);
+     }
+
+   return ReturnCode;
+  }
+
 /*****************************************************************************/
 /***************************** Update my photo *******************************/
 /*****************************************************************************/
@@ -1009,33 +1225,17 @@ bool Pho_ShowingUsrPhotoIsAllowed (struct UsrData *UsrDat,char *PhotoURL)
   }
 
 /*****************************************************************************/
-/***************** Create a public link to a private photo *******************/
+/****************** Build the public URL of a user's photo *******************/
 /*****************************************************************************/
 // Returns false if photo does not exist
-// Returns true if link is created successfully
+// Returns true if photo exists
+// The public link to the private photo is created when the photo is updated
+// (see Pho_UpdatePhotoName), so the filesystem is not accessed here
 
 bool Pho_BuildLinkToPhoto (const struct UsrData *UsrDat,char *PhotoURL)
   {
-   char PathPublPhoto[PATH_MAX + 1];
-   char PathPrivPhoto[PATH_MAX + 1];
-
    if (UsrDat->Photo[0])
      {
-      /***** Make path to public photo *****/
-      sprintf (PathPublPhoto,"%s/%s/%s.jpg",
-               Cfg_PATH_SWAD_PUBLIC,Cfg_FOLDER_PHOTO,UsrDat->Photo);
-
-      /***** Make path to private photo from public directory *****/
-      sprintf (PathPrivPhoto,"%s/%s/%02u/%ld.jpg",
-               Cfg_PATH_SWAD_PRIVATE,Cfg_FOLDER_PHOTO,
-               (unsigned) (UsrDat->UsrCod % 100),UsrDat->UsrCod);
-
-      /***** Create a symbolic link to the private photo, if not exists *****/
-      if (!Fil_CheckIfPathExists (PathPublPhoto))
-         if (symlink (PathPrivPhoto,PathPublPhoto) != 0)
-            Lay_ShowErrorAndExit ("Can not create public link"
-                                 " to access to user's private photo");
-
       /***** Create the public URL of the photo *****/
       sprintf (PhotoURL,"%s/%s/%s.jpg",
                Cfg_URL_SWAD_PUBLIC,Cfg_FOLDER_PHOTO,UsrDat->Photo);
@@ -1148,6 +1348,7 @@ void Pho_UpdatePhotoName (struct UsrData *UsrDat)
   {
    char Query[512];
    char PathPublPhoto[PATH_MAX + 1];
+   char PathPrivPhoto[PATH_MAX + 1];
 
    /***** Update photo name in database *****/
    sprintf (Query,"UPDATE usr_data SET Photo='%s'"
@@ -1163,6 +1364,17 @@ void Pho_UpdatePhotoName (struct UsrData *UsrDat)
    /***** Update photo name in user's data *****/
    Str_Copy (UsrDat->Photo,Gbl.UniqueNameEncrypted,
              Cry_BYTES_ENCRYPTED_STR_SHA256_BASE64);
+
+   /***** Create the new symbolic link to photo now,
+          instead of checking it when the photo is shown *****/
+   sprintf (PathPublPhoto,"%s/%s/%s.jpg",
+            Cfg_PATH_SWAD_PUBLIC,Cfg_FOLDER_PHOTO,UsrDat->Photo);
+   sprintf (PathPrivPhoto,"%s/%s/%02u/%ld.jpg",
+            Cfg_PATH_SWAD_PRIVATE,Cfg_FOLDER_PHOTO,
+            (unsigned) (UsrDat->UsrCod % 100),UsrDat->UsrCod);
+   if (symlink (PathPrivPhoto,PathPublPhoto) != 0)
+      Lay_ShowErrorAndExit ("Can not create public link"
+                           " to access to user's private photo");
   }
 
 /*****************************************************************************/
@@ -1305,9 +1517,10 @@ void Pho_CalcPhotoDegree (void)
    Pho_AvgPhotoTypeOfAverage_t TypeOfAverage;
    long DegCod = -1L;
    char DirAvgPhotosRelPath[Pho_NUM_AVERAGE_PHOTO_TYPES][PATH_MAX + 1];
-   unsigned NumStds,NumStdsWithPhoto;
+   unsigned NumStds[Usr_NUM_SEXS];
+   unsigned NumStdsWithPhoto[Usr_NUM_SEXS];
+   long TimeToComputeAvgPhotoInMicroseconds[Usr_NUM_SEXS];
    Usr_Sex_t Sex;
-   long TotalTimeToComputeAvgPhotoInMicroseconds,PartialTimeToComputeAvgPhotoInMicroseconds;
 
    /***** Get type of average *****/
    Gbl.Stat.DegPhotos.TypeOfAverage = Pho_GetPhotoAvgTypeFromForm ();
@@ -1344,25 +1557,16 @@ void Pho_CalcPhotoDegree (void)
    /***** Get list of students in this degree *****/
    Usr_GetUnorderedStdsCodesInDeg (DegCod);
 
+   /***** Compute average photos of students belonging this degree *****/
+   Pho_ComputeAveragePhotos (DegCod,Rol_STD,DirAvgPhotosRelPath,
+                             NumStds,NumStdsWithPhoto,TimeToComputeAvgPhotoInMicroseconds);
+
+   /***** Store stats in database *****/
    for (Sex = (Usr_Sex_t) 0;
 	Sex < Usr_NUM_SEXS;
 	Sex++)
-     {
-      TotalTimeToComputeAvgPhotoInMicroseconds = 0;
-      for (TypeOfAverage = (Pho_AvgPhotoTypeOfAverage_t) 0;
-	   TypeOfAverage < Pho_NUM_AVERAGE_PHOTO_TYPES;
-	   TypeOfAverage++)
-        {
-         /***** Compute average photos of students belonging this degree *****/
-         Pho_ComputeAveragePhoto (DegCod,Sex,Rol_STD,
-                                  TypeOfAverage,DirAvgPhotosRelPath[TypeOfAverage],
-                                  &NumStds,&NumStdsWithPhoto,&PartialTimeToComputeAvgPhotoInMicroseconds);
-         TotalTimeToComputeAvgPhotoInMicroseconds += PartialTimeToComputeAvgPhotoInMicroseconds;
-        }
-
-      /***** Store stats in database *****/
-      Pho_UpdateDegStats (DegCod,Sex,NumStds,NumStdsWithPhoto,TotalTimeToComputeAvgPhotoInMicroseconds);
-     }
+      Pho_UpdateDegStats (DegCod,Sex,NumStds[Sex],NumStdsWithPhoto[Sex],
+                          TimeToComputeAvgPhotoInMicroseconds[Sex]);
 
    /***** Free memory for students list *****/
    Usr_FreeUsrsList (Rol_STD);
@@ -1546,99 +1750,222 @@ static long Pho_GetTimeToComputeAvgPhoto (long DegCod)
   }
 
 /*****************************************************************************/
-/********************** Compute the average photo of a list ******************/
+/************* Compute the average photos of the students of a degree ********/
 /*****************************************************************************/
-// Returns number of users in list with photo
+// The list of students is read only once, checking each photo only once,
+// and one file with the paths of the photos is written for each sex.
+// Then the programs that compute the average photos are run in parallel,
+// one process for each sex and type of average
 
-static void Pho_ComputeAveragePhoto (long DegCod,Usr_Sex_t Sex,Rol_Role_t Role,
-                                     Pho_AvgPhotoTypeOfAverage_t TypeOfAverage,const char *DirAvgPhotosRelPath,
-                                     unsigned *NumStds,unsigned *NumStdsWithPhoto,long *TimeToComputeAvgPhotoInMicroseconds)
+static void Pho_ComputeAveragePhotos (long DegCod,Rol_Role_t Role,
+                                      char DirAvgPhotosRelPath[Pho_NUM_AVERAGE_PHOTO_TYPES][PATH_MAX + 1],
+                                      unsigned NumStds[Usr_NUM_SEXS],
+                                      unsigned NumStdsWithPhoto[Usr_NUM_SEXS],
+                                      long TimeToComputeAvgPhotoInMicroseconds[Usr_NUM_SEXS])
   {
    extern const char *Usr_StringsSexDB[Usr_NUM_SEXS];
    unsigned NumUsr;
+   Usr_Sex_t Sex;
+   Usr_Sex_t UsrSex;
+   Pho_AvgPhotoTypeOfAverage_t TypeOfAverage;
    char PathPrivRelPhoto[PATH_MAX + 1];	// Relative path to private photo, to calculate average face
    char PathRelAvgPhoto[PATH_MAX + 1];
-   char FileNamePhotoNames[PATH_MAX + 1];
-   FILE *FilePhotoNames = NULL;	// Initialized to avoid warning
+   char FileNamePhotoNames[Usr_NUM_SEXS][PATH_MAX + 1];
+   FILE *FilePhotoNames[Usr_NUM_SEXS];
    char StrCallToProgram[256];	// Call to photo processing program
-   int ReturnCode;
-   /* To compute execution time of this function */
+   struct Pho_AvgPhotoProcess Processes[Cfg_MAX_PROCESSES_TO_COMPUTE_AVG_PHOTO];
+   unsigned NumProcesses = 0;
+   unsigned long NumProcessesToLaunch = 0;
+   unsigned long NumProcessesLaunched = 0;
+   bool Error = false;
+   /* To compute execution time of the lists of photos */
    struct timeval tvStartComputingStat;
-   struct timeval tvEndComputingStat;
-   struct timezone tz;
+   long TimeToBuildListsInMicroseconds;
 
    /***** Set start time to compute the stats of this degree *****/
-   gettimeofday (&tvStartComputingStat,&tz);
-
-   /***** Reset number of students in this degree *****/
-   *NumStds = *NumStdsWithPhoto = 0;
-
-   /***** Build name for file with average photo *****/
-   sprintf (PathRelAvgPhoto,"%s/%ld_%s.jpg",
-            DirAvgPhotosRelPath,DegCod,Usr_StringsSexDB[Sex]);
-
-   /***** Remove old file if exists *****/
-   if (Fil_CheckIfPathExists (PathRelAvgPhoto))  // If file exists
-      unlink (PathRelAvgPhoto);
+   gettimeofday (&tvStartComputingStat,NULL);
 
-   /***** Build names for text file with photo paths *****/
-   sprintf (FileNamePhotoNames,"%s/%s/%s/%ld.txt",
-	    Cfg_PATH_SWAD_PRIVATE,Cfg_FOLDER_PHOTO,Cfg_FOLDER_PHOTO_TMP,DegCod);
-   if ((FilePhotoNames = fopen (FileNamePhotoNames,"wb")) == NULL)
-      Lay_ShowErrorAndExit ("Can not open file to compute average photo.");
+   /***** Open one text file with photo paths for each sex *****/
+   for (Sex = (Usr_Sex_t) 0;
+	Sex < Usr_NUM_SEXS;
+	Sex++)
+     {
+      NumStds[Sex] = NumStdsWithPhoto[Sex] = 0;
+      sprintf (FileNamePhotoNames[Sex],"%s/%s/%s/%ld_%s.txt",
+	       Cfg_PATH_SWAD_PRIVATE,Cfg_FOLDER_PHOTO,Cfg_FOLDER_PHOTO_TMP,
+	       DegCod,Usr_StringsSexDB[Sex]);
+      if ((FilePhotoNames[Sex] = fopen (FileNamePhotoNames[Sex],"wb")) == NULL)
+	 Lay_ShowErrorAndExit ("Can not open file to compute average photo.");
+     }
 
-   /***** Loop writing file names in text file *****/
+   /***** Loop writing file names in text files,
+          checking the photo of each user only once *****/
    for (NumUsr = 0;
 	NumUsr < Gbl.Usrs.LstUsrs[Role].NumUsrs;
 	NumUsr++)
      {
-      Gbl.Usrs.Other.UsrDat.Sex = Gbl.Usrs.LstUsrs[Role].Lst[NumUsr].Sex;
-      if (Sex == Usr_SEX_ALL || Sex == Gbl.Usrs.Other.UsrDat.Sex)
-	{
-	 (*NumStds)++;
+      UsrSex = Gbl.Usrs.LstUsrs[Role].Lst[NumUsr].Sex;
+      NumStds[UsrSex]++;
+      if (UsrSex != Usr_SEX_ALL)
+	 NumStds[Usr_SEX_ALL]++;
 
-	 /***** Add photo to file for average face calculation *****/
-	 Gbl.Usrs.Other.UsrDat.UsrCod = Gbl.Usrs.LstUsrs[Role].Lst[NumUsr].UsrCod;
-	 if (Pho_CheckIfPrivPhotoExists (Gbl.Usrs.Other.UsrDat.UsrCod,PathPrivRelPhoto))
+      /***** Add photo to files for average face calculation *****/
+      if (Pho_CheckIfPrivPhotoExists (Gbl.Usrs.LstUsrs[Role].Lst[NumUsr].UsrCod,PathPrivRelPhoto))
+	{
+	 NumStdsWithPhoto[UsrSex]++;
+	 fprintf (FilePhotoNames[UsrSex],"%s\n",PathPrivRelPhoto);
+	 if (UsrSex != Usr_SEX_ALL)
 	   {
-	    (*NumStdsWithPhoto)++;
-	    fprintf (FilePhotoNames,"%s\n",PathPrivRelPhoto);
+	    NumStdsWithPhoto[Usr_SEX_ALL]++;
+	    fprintf (FilePhotoNames[Usr_SEX_ALL],"%s\n",PathPrivRelPhoto);
 	   }
 	}
      }
-   fclose (FilePhotoNames);
+   for (Sex = (Usr_Sex_t) 0;
+	Sex < Usr_NUM_SEXS;
+	Sex++)
+     {
+      fclose (FilePhotoNames[Sex]);
+      if (NumStdsWithPhoto[Sex])
+	 NumProcessesToLaunch += Pho_NUM_AVERAGE_PHOTO_TYPES;
+     }
 
-   /***** Call to program to calculate average photo *****/
-   if (*NumStdsWithPhoto)
+   /***** The time used to build the lists is shared among all sexs *****/
+   TimeToBuildListsInMicroseconds = Pho_GetElapsedMicroseconds (&tvStartComputingStat);
+   for (Sex = (Usr_Sex_t) 0;
+	Sex < Usr_NUM_SEXS;
+	Sex++)
+      TimeToComputeAvgPhotoInMicroseconds[Sex] = TimeToBuildListsInMicroseconds < 0 ? -1L :
+	                                         TimeToBuildListsInMicroseconds / Usr_NUM_SEXS;
+
+   /***** Launch programs to calculate average photos,
+          never running more than a maximum number of processes at a time *****/
+   for (Sex = (Usr_Sex_t) 0;
+	Sex < Usr_NUM_SEXS;
+	Sex++)
+      for (TypeOfAverage = (Pho_AvgPhotoTypeOfAverage_t) 0;
+	   TypeOfAverage < Pho_NUM_AVERAGE_PHOTO_TYPES;
+	   TypeOfAverage++)
+	{
+	 /***** Build name for file with average photo *****/
+	 sprintf (PathRelAvgPhoto,"%s/%ld_%s.jpg",
+		  DirAvgPhotosRelPath[TypeOfAverage],DegCod,Usr_StringsSexDB[Sex]);
+
+	 /***** Remove old file if exists *****/
+	 if (Fil_CheckIfPathExists (PathRelAvgPhoto))  // If file exists
+	    unlink (PathRelAvgPhoto);
+
+	 if (!NumStdsWithPhoto[Sex])
+	    continue;
+
+	 /***** Wait for a process to end if too many are running *****/
+	 if (NumProcesses == Cfg_MAX_PROCESSES_TO_COMPUTE_AVG_PHOTO)
+	   {
+	    Pho_WaitForAvgPhotoProcess (Processes,&NumProcesses,
+	                                TimeToComputeAvgPhotoInMicroseconds,&Error);
+	    Job_UpdateProgress (NumProcessesLaunched - NumProcesses,NumProcessesToLaunch);
+	   }
+
+	 /***** Launch a new process *****/
+	 sprintf (StrCallToProgram,"%s %s %s",
+		  Pho_StrAvgPhotoPrograms[TypeOfAverage],
+		  FileNamePhotoNames[Sex],PathRelAvgPhoto);
+	 Processes[NumProcesses].Sex = Sex;
+	 gettimeofday (&Processes[NumProcesses].tvStart,NULL);
+	 fflush (Gbl.F.Out);
+	 switch (Processes[NumProcesses].PID = fork ())
+	   {
+	    case -1:	// Error
+	       Error = true;
+	       break;
+	    case 0:	// Child
+	       execl ("/bin/sh","sh","-c",StrCallToProgram,(char *) NULL);
+	       _exit (127);	// Only reached when execl fails
+	       break;
+	    default:	// Parent
+	       NumProcesses++;
+	       NumProcessesLaunched++;
+	       break;
+	   }
+	}
+
+   /***** Wait for the rest of processes *****/
+   while (NumProcesses)
      {
-      sprintf (StrCallToProgram,"%s %s %s",
-	       Pho_StrAvgPhotoPrograms[TypeOfAverage],
-	       FileNamePhotoNames,PathRelAvgPhoto);
-      ReturnCode = system (StrCallToProgram);
-      if (ReturnCode == -1)
-	 Lay_ShowErrorAndExit ("Error when running program that computes the average photo.");
-
-      /* Write message depending on the return code */
-      if (WEXITSTATUS(ReturnCode))
-	 Lay_ShowErrorAndExit ("The average photo has not been computed successfully.");
+      Pho_WaitForAvgPhotoProcess (Processes,&NumProcesses,
+				  TimeToComputeAvgPhotoInMicroseconds,&Error);
+      Job_UpdateProgress (NumProcessesLaunched - NumProcesses,NumProcessesToLaunch);
      }
 
-   /***** Time used to compute the stats of this degree *****/
-   if (gettimeofday (&tvEndComputingStat, &tz))
-      // Error in gettimeofday
-      *TimeToComputeAvgPhotoInMicroseconds = -1L;
-   else
+   if (Error)
+      Lay_ShowErrorAndExit ("The average photo has not been computed successfully.");
+  }
+
+/*****************************************************************************/
+/******** Wait for the end of one of the processes computing a photo *********/
+/*****************************************************************************/
+
+static void Pho_WaitForAvgPhotoProcess (struct Pho_AvgPhotoProcess *Processes,
+                                        unsigned *NumProcesses,
+                                        long TimeToComputeAvgPhotoInMicroseconds[Usr_NUM_SEXS],
+                                        bool *Error)
+  {
+   pid_t PID;
+   int Status;
+   unsigned NumProcess;
+   long TimeInMicroseconds;
+
+   /***** Wait for any child *****/
+   if ((PID = waitpid (-1,&Status,0)) == -1)
      {
-      if (tvEndComputingStat.tv_usec < tvStartComputingStat.tv_usec)
+      // No more children to wait for
+      *Error = true;
+      *NumProcesses = 0;
+      return;
+     }
+
+   if (!WIFEXITED (Status) || WEXITSTATUS (Status))
+      *Error = true;
+
+   /***** Find the process and add its time to the time of its sex *****/
+   for (NumProcess = 0;
+	NumProcess < *NumProcesses;
+	NumProcess++)
+      if (Processes[NumProcess].PID == PID)
 	{
-	 tvEndComputingStat.tv_sec--;
-	 tvEndComputingStat.tv_usec += 1000000L;
+	 TimeInMicroseconds = Pho_GetElapsedMicroseconds (&Processes[NumProcess].tvStart);
+	 if (TimeInMicroseconds < 0 ||
+	     TimeToComputeAvgPhotoInMicroseconds[Processes[NumProcess].Sex] < 0)
+	    TimeToComputeAvgPhotoInMicroseconds[Processes[NumProcess].Sex] = -1L;
+	 else
+	    TimeToComputeAvgPhotoInMicroseconds[Processes[NumProcess].Sex] += TimeInMicroseconds;
+
+	 /* Remove the process from the list */
+	 Processes[NumProcess] = Processes[--(*NumProcesses)];
+	 break;
 	}
-      *TimeToComputeAvgPhotoInMicroseconds = (tvEndComputingStat.tv_sec -
-	                                      tvStartComputingStat.tv_sec) * 1000000L +
-	                                      tvEndComputingStat.tv_usec -
-	                                      tvStartComputingStat.tv_usec;
+  }
+
+/*****************************************************************************/
+/************** Get microseconds elapsed from a starting time ****************/
+/*****************************************************************************/
+// Return -1L on error
+
+static long Pho_GetElapsedMicroseconds (const struct timeval *tvStart)
+  {
+   struct timeval tvEnd;
+
+   if (gettimeofday (&tvEnd,NULL))
+      // Error in gettimeofday
+      return -1L;
+
+   if (tvEnd.tv_usec < tvStart->tv_usec)
+     {
+      tvEnd.tv_sec--;
+      tvEnd.tv_usec += 1000000L;
      }
+   return (tvEnd.tv_sec - tvStart->tv_sec) * 1000000L +
+	  tvEnd.tv_usec - tvStart->tv_usec;
   }
 
 /*****************************************************************************/
@@ -257,6 +257,12 @@ bool Pri_ShowingIsAllowed (Pri_Visibility_t Visibility,struct UsrData *UsrDat)
 					// by me and my teachers if I am a student
 					// or me and my students if I am a teacher
          // Do both users share the same course but whit different role?
+	 // Fast check: do both users belong to current course with different roles?
+	 if (Gbl.Usrs.Me.IBelongToCurrentCrs &&
+	     UsrDat->Roles.InCurrentCrs.Valid &&
+	     Usr_CheckIfUsrBelongsToCurrentCrs (UsrDat) &&
+	     UsrDat->Roles.InCurrentCrs.Role != Gbl.Usrs.Me.UsrDat.Roles.InCurrentCrs.Role)
+	    return true;
 	 return Usr_CheckIfUsrSharesAnyOfMyCrsWithDifferentRole (UsrDat->UsrCod);
       case Pri_VISIBILITY_COURSE:	// Visible by users sharing courses with me
 	 // Do both users share the same course?
@@ -25,6 +25,7 @@
 /*********************************** Headers *********************************/
 /*****************************************************************************/
 
+#include <ctype.h>	// For isalnum
 #include <stdio.h>	// For fprintf...
 #include <string.h>	// For string functions...
 
@@ -45,6 +46,11 @@
 #define Sch_MIN_LENGTH_LONGEST_WORD	  3
 #define Sch_MIN_LENGTH_TOTAL		  3	// "A An" is not valid; "A An Ann" is valid
 
+#define Sch_MIN_LENGTH_FULL_TEXT_WORD	  4	// Shorter words are not in MyISAM full-text indexes (ft_min_word_len)
+
+#define Sch_MAX_BYTES_FULL_TEXT_WORDS	(Sch_MAX_WORDS_IN_SEARCH * (Sch_MAX_BYTES_SEARCH_WORD + 2))	// "word1* word2* ..."
+#define Sch_MAX_BYTES_RANKING		(128 + Sch_MAX_BYTES_FULL_TEXT_WORDS)	// "MATCH (field) AGAINST ('word1* word2* ...' IN BOOLEAN MODE) DESC,"
+
 /*****************************************************************************/
 /****************************** Internal types *******************************/
 /*****************************************************************************/
@@ -77,6 +83,9 @@ static unsigned Sch_SearchOpenDocumentsInDB (const char *RangeQuery);
 static unsigned Sch_SearchDocumentsInMyCoursesInDB (const char *RangeQuery);
 static unsigned Sch_SearchMyDocumentsInDB (const char *RangeQuery);
 
+static void Sch_BuildFullTextRanking (char Ranking[Sch_MAX_BYTES_RANKING + 1],
+                                      const char *FullTextFieldNames);
+static bool Sch_CheckIfWordIsInFullTextIndex (const char *Word);
 static void Sch_SaveLastSearchIntoSession (void);
 
 /*****************************************************************************/
@@ -671,7 +680,7 @@ static unsigned Sch_SearchCountriesInDB (const char *RangeQuery)
 	{
 	 /***** Split countries string into words *****/
 	 sprintf (FieldName,"Name_%s",Txt_STR_LANG_ID[Gbl.Prefs.Language]);
-	 if (Sch_BuildSearchQuery (SearchQuery,FieldName,NULL,NULL))
+	 if (Sch_BuildSearchQuery (SearchQuery,FieldName,NULL,NULL,NULL))
 	   {
 	    /***** Query database and list institutions found *****/
 	    sprintf (Query,"SELECT CtyCod"
@@ -696,6 +705,7 @@ static unsigned Sch_SearchInstitutionsInDB (const char *RangeQuery)
   {
    extern const char *Txt_STR_LANG_ID[1 + Txt_NUM_LANGUAGES];
    char SearchQuery[Sch_MAX_BYTES_SEARCH_QUERY + 1];
+   char Ranking[Sch_MAX_BYTES_RANKING + 1];
    char Query[1024 + Sch_MAX_BYTES_SEARCH_QUERY * 2];
 
    /***** Check scope *****/
@@ -705,17 +715,20 @@ static unsigned Sch_SearchInstitutionsInDB (const char *RangeQuery)
       /***** Check user's permission *****/
       if (Sch_CheckIfIHavePermissionToSearch (Sch_SEARCH_INSTITS))
 	 /***** Split institutions string into words *****/
-	 if (Sch_BuildSearchQuery (SearchQuery,"institutions.FullName",NULL,NULL))
+	 if (Sch_BuildSearchQuery (SearchQuery,"institutions.FullName",NULL,NULL,NULL))
 	   {
+	    /***** Rank names by relevance of words found *****/
+	    Sch_BuildFullTextRanking (Ranking,"institutions.FullName");
+
 	    /***** Query database and list institutions found *****/
 	    sprintf (Query,"SELECT institutions.InsCod"
 			   " FROM institutions,countries"
 			   " WHERE %s"
 			   " AND institutions.CtyCod=countries.CtyCod"
 			   "%s"
-			   " ORDER BY institutions.FullName,countries.Name_%s",
+			   " ORDER BY %sinstitutions.FullName,countries.Name_%s",
 		     SearchQuery,RangeQuery,
-		     Txt_STR_LANG_ID[Gbl.Prefs.Language]);
+		     Ranking,Txt_STR_LANG_ID[Gbl.Prefs.Language]);
 	    return Ins_ListInssFound (Query);
 	   }
 
@@ -730,6 +743,7 @@ static unsigned Sch_SearchInstitutionsInDB (const char *RangeQuery)
 static unsigned Sch_SearchCentresInDB (const char *RangeQuery)
   {
    char SearchQuery[Sch_MAX_BYTES_SEARCH_QUERY + 1];
+   char Ranking[Sch_MAX_BYTES_RANKING + 1];
    char Query[1024 + Sch_MAX_BYTES_SEARCH_QUERY * 2];
 
    /***** Check scope *****/
@@ -738,8 +752,11 @@ static unsigned Sch_SearchCentresInDB (const char *RangeQuery)
       /***** Check user's permission *****/
       if (Sch_CheckIfIHavePermissionToSearch (Sch_SEARCH_CENTRES))
 	 /***** Split centre string into words *****/
-	 if (Sch_BuildSearchQuery (SearchQuery,"centres.FullName",NULL,NULL))
+	 if (Sch_BuildSearchQuery (SearchQuery,"centres.FullName",NULL,NULL,NULL))
 	   {
+	    /***** Rank names by relevance of words found *****/
+	    Sch_BuildFullTextRanking (Ranking,"centres.FullName");
+
 	    /***** Query database and list centres found *****/
 	    sprintf (Query,"SELECT centres.CtrCod"
 			   " FROM centres,institutions,countries"
@@ -747,8 +764,8 @@ static unsigned Sch_SearchCentresInDB (const char *RangeQuery)
 			   " AND centres.InsCod=institutions.InsCod"
 			   " AND institutions.CtyCod=countries.CtyCod"
 			   "%s"
-			   " ORDER BY centres.FullName,institutions.FullName",
-		     SearchQuery,RangeQuery);
+			   " ORDER BY %scentres.FullName,institutions.FullName",
+		     SearchQuery,RangeQuery,Ranking);
 	    return Ctr_ListCtrsFound (Query);
 	   }
 
@@ -763,6 +780,7 @@ static unsigned Sch_SearchCentresInDB (const char *RangeQuery)
 static unsigned Sch_SearchDegreesInDB (const char *RangeQuery)
   {
    char SearchQuery[Sch_MAX_BYTES_SEARCH_QUERY + 1];
+   char Ranking[Sch_MAX_BYTES_RANKING + 1];
    char Query[1024 + Sch_MAX_BYTES_SEARCH_QUERY * 2];
 
    /***** Check scope *****/
@@ -770,8 +788,11 @@ static unsigned Sch_SearchDegreesInDB (const char *RangeQuery)
       /***** Check user's permission *****/
       if (Sch_CheckIfIHavePermissionToSearch (Sch_SEARCH_DEGREES))
 	 /***** Split degree string into words *****/
-	 if (Sch_BuildSearchQuery (SearchQuery,"degrees.FullName",NULL,NULL))
+	 if (Sch_BuildSearchQuery (SearchQuery,"degrees.FullName",NULL,NULL,NULL))
 	   {
+	    /***** Rank names by relevance of words found *****/
+	    Sch_BuildFullTextRanking (Ranking,"degrees.FullName");
+
 	    /***** Query database and list degrees found *****/
 	    sprintf (Query,"SELECT degrees.DegCod"
 			   " FROM degrees,centres,institutions,countries"
@@ -780,8 +801,8 @@ static unsigned Sch_SearchDegreesInDB (const char *RangeQuery)
 			   " AND centres.InsCod=institutions.InsCod"
 			   " AND institutions.CtyCod=countries.CtyCod"
 			   "%s"
-			   " ORDER BY degrees.FullName,institutions.FullName",
-		     SearchQuery,RangeQuery);
+			   " ORDER BY %sdegrees.FullName,institutions.FullName",
+		     SearchQuery,RangeQuery,Ranking);
 	    return Deg_ListDegsFound (Query);
 	   }
 
@@ -796,13 +817,17 @@ static unsigned Sch_SearchDegreesInDB (const char *RangeQuery)
 static unsigned Sch_SearchCoursesInDB (const char *RangeQuery)
   {
    char SearchQuery[Sch_MAX_BYTES_SEARCH_QUERY + 1];
+   char Ranking[Sch_MAX_BYTES_RANKING + 1];
    char Query[1024 + Sch_MAX_BYTES_SEARCH_QUERY * 2];
 
    /***** Check user's permission *****/
    if (Sch_CheckIfIHavePermissionToSearch (Sch_SEARCH_COURSES))
       /***** Split course string into words *****/
-      if (Sch_BuildSearchQuery (SearchQuery,"courses.FullName",NULL,NULL))
+      if (Sch_BuildSearchQuery (SearchQuery,"courses.FullName",NULL,NULL,NULL))
 	{
+	 /***** Rank names by relevance of words found *****/
+	 Sch_BuildFullTextRanking (Ranking,"courses.FullName");
+
 	 /***** Query database and list courses found *****/
 	 sprintf (Query,"SELECT degrees.DegCod,courses.CrsCod,degrees.ShortName,degrees.FullName,"
 			"courses.Year,courses.FullName,centres.ShortName"
@@ -813,8 +838,8 @@ static unsigned Sch_SearchCoursesInDB (const char *RangeQuery)
 			" AND centres.InsCod=institutions.InsCod"
 			" AND institutions.CtyCod=countries.CtyCod"
 			"%s"
-			" ORDER BY courses.FullName,institutions.FullName,degrees.FullName,courses.Year",
-		  SearchQuery,RangeQuery);
+			" ORDER BY %scourses.FullName,institutions.FullName,degrees.FullName,courses.Year",
+		  SearchQuery,RangeQuery,Ranking);
 	 return Crs_ListCrssFound (Query);
 	}
 
@@ -835,6 +860,7 @@ static unsigned Sch_SearchUsrsInDB (Rol_Role_t Role)
    /***** Split user string into words *****/
    if (Sch_BuildSearchQuery (SearchQuery,
 			     "CONCAT_WS(' ',FirstName,Surname1,Surname2)",
+			     "FirstName,Surname1,Surname2",
 			     NULL,NULL))
       /***** Query database and list users found *****/
       return Usr_ListUsrsFound (Role,SearchQuery);
@@ -864,7 +890,7 @@ static unsigned Sch_SearchOpenDocumentsInDB (const char *RangeQuery)
    /***** Check user's permission *****/
    if (Sch_CheckIfIHavePermissionToSearch (Sch_SEARCH_OPEN_DOCUMENTS))
       /***** Split document string into words *****/
-      if (Sch_BuildSearchQuery (SearchQuery,"SUBSTRING_INDEX(files.Path,'/',-1)",
+      if (Sch_BuildSearchQuery (SearchQuery,"files.Name","files.Name",
 				"_latin1 "," COLLATE latin1_general_ci"))
 	{
 	 /***** Build the query *****/
@@ -977,7 +1003,7 @@ static unsigned Sch_SearchDocumentsInMyCoursesInDB (const char *RangeQuery)
    /***** Check user's permission *****/
    if (Sch_CheckIfIHavePermissionToSearch (Sch_SEARCH_DOCUM_IN_MY_COURSES))
       /***** Split document string into words *****/
-      if (Sch_BuildSearchQuery (SearchQuery,"SUBSTRING_INDEX(files.Path,'/',-1)",
+      if (Sch_BuildSearchQuery (SearchQuery,"files.Name","files.Name",
 				"_latin1 "," COLLATE latin1_general_ci"))
 	{
 	 /***** Create temporary table with codes of files in documents and shared areas accessible by me.
@@ -1104,7 +1130,7 @@ static unsigned Sch_SearchMyDocumentsInDB (const char *RangeQuery)
    /***** Check user's permission *****/
    if (Sch_CheckIfIHavePermissionToSearch (Sch_SEARCH_MY_DOCUMENTS))
       /***** Split document string into words *****/
-      if (Sch_BuildSearchQuery (SearchQuery,"SUBSTRING_INDEX(files.Path,'/',-1)",
+      if (Sch_BuildSearchQuery (SearchQuery,"files.Name","files.Name",
 				"_latin1 "," COLLATE latin1_general_ci"))
 	{
 	 /***** Build the query *****/
@@ -1245,11 +1271,16 @@ static unsigned Sch_SearchMyDocumentsInDB (const char *RangeQuery)
 /*****************************************************************************/
 /****** Build a search query by splitting a string to search into words ******/
 /*****************************************************************************/
+// If FullTextFieldNames is not NULL, a full-text index must exist on it,
+// and words that can be found in that index are searched with MATCH,
+// so the index is used to select the rows instead of scanning the table.
+// Other words (short, with symbols...) are searched with LIKE in FieldName.
 // Returns true if a valid search query is built
 // Returns false when no valid search query
 
 bool Sch_BuildSearchQuery (char SearchQuery[Sch_MAX_BYTES_SEARCH_QUERY + 1],
                            const char *FieldName,
+                           const char *FullTextFieldNames,
                            const char *CharSet,const char *Collate)
   {
    const char *Ptr;
@@ -1260,10 +1291,13 @@ bool Sch_BuildSearchQuery (char SearchQuery[Sch_MAX_BYTES_SEARCH_QUERY + 1],
    size_t MaxLengthWord = 0;
    char SearchWords[Sch_MAX_WORDS_IN_SEARCH][Sch_MAX_BYTES_SEARCH_WORD + 1];
    bool SearchWordIsValid = true;
+   char FullTextWords[Sch_MAX_BYTES_SEARCH_QUERY + 1];
+   char LikeConditions[Sch_MAX_BYTES_SEARCH_QUERY + 1];
 
    if (Gbl.Search.Str[0])
      {
-      SearchQuery[0] = '\0';
+      FullTextWords[0] = '\0';
+      LikeConditions[0] = '\0';
       Ptr = Gbl.Search.Str;
       for (NumWords = 0;
 	   NumWords < Sch_MAX_WORDS_IN_SEARCH && *Ptr;
@@ -1299,30 +1333,48 @@ bool Sch_BuildSearchQuery (char SearchQuery[Sch_MAX_BYTES_SEARCH_QUERY + 1],
 	    LengthTotal += LengthWord;
 	    if (LengthWord > MaxLengthWord)
 	       MaxLengthWord = LengthWord;
-	    if (strlen (SearchQuery) + 128 + LengthWord >
+	    if (strlen (FullTextWords) + strlen (LikeConditions) + 256 + LengthWord >
 	        Sch_MAX_BYTES_SEARCH_QUERY)	// Prevent string overflow
 	       break;
-	    if (NumWords)
-	       Str_Concat (SearchQuery," AND ",
-	                   Sch_MAX_BYTES_SEARCH_QUERY);
-	    Str_Concat (SearchQuery,FieldName,
-	                Sch_MAX_BYTES_SEARCH_QUERY);
-	    Str_Concat (SearchQuery," LIKE ",
-	                Sch_MAX_BYTES_SEARCH_QUERY);
-	    if (CharSet)
-	       if (CharSet[0])
-		  Str_Concat (SearchQuery,CharSet,
-		              Sch_MAX_BYTES_SEARCH_QUERY);
-	    Str_Concat (SearchQuery,"'%",
-	                Sch_MAX_BYTES_SEARCH_QUERY);
-	    Str_Concat (SearchQuery,SearchWords[NumWords],
-	                Sch_MAX_BYTES_SEARCH_QUERY);
-	    Str_Concat (SearchQuery,"%'",
-	                Sch_MAX_BYTES_SEARCH_QUERY);
-	    if (Collate)
-	       if (Collate[0])
-		  Str_Concat (SearchQuery,Collate,
-		              Sch_MAX_BYTES_SEARCH_QUERY);
+
+	    if (FullTextFieldNames &&
+		Sch_CheckIfWordIsInFullTextIndex (SearchWords[NumWords]))
+	      {
+	       /* All words must be present at the start of any word */
+	       if (FullTextWords[0])
+		  Str_Concat (FullTextWords," ",
+			      Sch_MAX_BYTES_SEARCH_QUERY);
+	       Str_Concat (FullTextWords,"+",
+			   Sch_MAX_BYTES_SEARCH_QUERY);
+	       Str_Concat (FullTextWords,SearchWords[NumWords],
+			   Sch_MAX_BYTES_SEARCH_QUERY);
+	       Str_Concat (FullTextWords,"*",
+			   Sch_MAX_BYTES_SEARCH_QUERY);
+	      }
+	    else
+	      {
+	       if (LikeConditions[0])
+		  Str_Concat (LikeConditions," AND ",
+			      Sch_MAX_BYTES_SEARCH_QUERY);
+	       Str_Concat (LikeConditions,FieldName,
+			   Sch_MAX_BYTES_SEARCH_QUERY);
+	       Str_Concat (LikeConditions," LIKE ",
+			   Sch_MAX_BYTES_SEARCH_QUERY);
+	       if (CharSet)
+		  if (CharSet[0])
+		     Str_Concat (LikeConditions,CharSet,
+				 Sch_MAX_BYTES_SEARCH_QUERY);
+	       Str_Concat (LikeConditions,"'%",
+			   Sch_MAX_BYTES_SEARCH_QUERY);
+	       Str_Concat (LikeConditions,SearchWords[NumWords],
+			   Sch_MAX_BYTES_SEARCH_QUERY);
+	       Str_Concat (LikeConditions,"%'",
+			   Sch_MAX_BYTES_SEARCH_QUERY);
+	       if (Collate)
+		  if (Collate[0])
+		     Str_Concat (LikeConditions,Collate,
+				 Sch_MAX_BYTES_SEARCH_QUERY);
+	      }
 	   }
 	}
 
@@ -1331,12 +1383,100 @@ bool Sch_BuildSearchQuery (char SearchQuery[Sch_MAX_BYTES_SEARCH_QUERY + 1],
 	  MaxLengthWord < Sch_MIN_LENGTH_LONGEST_WORD)
 	 return false;
 
+      /***** Build search query:
+             full-text condition first (using index), then LIKE conditions *****/
+      if (FullTextWords[0])
+	{
+	 if (snprintf (SearchQuery,Sch_MAX_BYTES_SEARCH_QUERY + 1,
+		       "MATCH (%s) AGAINST ('%s' IN BOOLEAN MODE)%s%s",
+		       FullTextFieldNames,FullTextWords,
+		       LikeConditions[0] ? " AND " :
+					   "",
+		       LikeConditions) > Sch_MAX_BYTES_SEARCH_QUERY)
+	    return false;	// Truncated
+	}
+      else
+	 Str_Copy (SearchQuery,LikeConditions,
+		   Sch_MAX_BYTES_SEARCH_QUERY);
+
       return true;
      }
 
    return false;
   }
 
+/*****************************************************************************/
+/************* Build ranking of results using a full-text index **************/
+/*****************************************************************************/
+// Names of institutions, centres, degrees and courses are few,
+// so they are selected with LIKE conditions built in Sch_BuildSearchQuery,
+// and names with words not in the full-text index are not lost.
+// Here the full-text index is only used to show first the most relevant names.
+// A full-text index must exist on FullTextFieldNames.
+// Ranking is empty or ends in a comma, to be put at the start of ORDER BY.
+
+static void Sch_BuildFullTextRanking (char Ranking[Sch_MAX_BYTES_RANKING + 1],
+                                      const char *FullTextFieldNames)
+  {
+   const char *Ptr;
+   unsigned NumWords;
+   char SearchWord[Sch_MAX_BYTES_SEARCH_WORD + 1];
+   char FullTextWords[Sch_MAX_BYTES_FULL_TEXT_WORDS + 1];
+
+   /***** Get words that can be found in full-text index *****/
+   FullTextWords[0] = '\0';
+   Ptr = Gbl.Search.Str;
+   for (NumWords = 0;
+	NumWords < Sch_MAX_WORDS_IN_SEARCH && *Ptr;
+	NumWords++)
+     {
+      /* Get next word */
+      Str_GetNextStringUntilSpace (&Ptr,SearchWord,Sch_MAX_BYTES_SEARCH_WORD);
+
+      /* Add word to full-text search,
+         as a word that may be present at the start of any word */
+      if (Sch_CheckIfWordIsInFullTextIndex (SearchWord))
+	{
+	 if (FullTextWords[0])
+	    Str_Concat (FullTextWords," ",
+			Sch_MAX_BYTES_FULL_TEXT_WORDS);
+	 Str_Concat (FullTextWords,SearchWord,
+		     Sch_MAX_BYTES_FULL_TEXT_WORDS);
+	 Str_Concat (FullTextWords,"*",
+		     Sch_MAX_BYTES_FULL_TEXT_WORDS);
+	}
+     }
+
+   /***** Build ranking *****/
+   Ranking[0] = '\0';
+   if (FullTextWords[0])
+      if (snprintf (Ranking,Sch_MAX_BYTES_RANKING + 1,
+		    "MATCH (%s) AGAINST ('%s' IN BOOLEAN MODE) DESC,",
+		    FullTextFieldNames,FullTextWords) > Sch_MAX_BYTES_RANKING)
+	 Ranking[0] = '\0';	// Truncated ==> don't rank
+  }
+
+/*****************************************************************************/
+/********* Check if a word to search can be found in full-text index *********/
+/*****************************************************************************/
+// Only words with letters and digits, and long enough, are in full-text indexes
+
+static bool Sch_CheckIfWordIsInFullTextIndex (const char *Word)
+  {
+   const char *Ptr;
+
+   if (strlen (Word) < Sch_MIN_LENGTH_FULL_TEXT_WORD)
+      return false;
+
+   for (Ptr = Word;
+	*Ptr;
+	Ptr++)
+      if (!isalnum ((int) (unsigned char) *Ptr))
+	 return false;
+
+   return true;
+  }
+
 /*****************************************************************************/
 /********************** Save last search into session ************************/
 /*****************************************************************************/
@@ -91,6 +91,7 @@ void Sch_CrsSearch (void);
 
 bool Sch_BuildSearchQuery (char SearchQuery[Sch_MAX_BYTES_SEARCH_QUERY + 1],
                            const char *FieldName,
+                           const char *FullTextFieldNames,
                            const char *CharSet,const char *Collate);
 
 #endif
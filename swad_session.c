@@ -34,6 +34,7 @@
 #include "swad_connected.h"
 #include "swad_database.h"
 #include "swad_global.h"
+#include "swad_MFU.h"
 #include "swad_parameter.h"
 #include "swad_social.h"
 
@@ -41,6 +42,8 @@
 /**************************** Internal constants *****************************/
 /*****************************************************************************/
 
+#define Ses_MAX_BYTES_CONDITION_EXPIRED (512 - 1)	// 511
+
 /*****************************************************************************/
 /************** External global variables from others modules ****************/
 /*****************************************************************************/
@@ -51,7 +54,11 @@ extern struct Globals Gbl;
 /***************************** Internal prototypes ***************************/
 /*****************************************************************************/
 
-static void Ses_RemoveSessionFromDB (void);
+static void Ses_SetStoredSession (time_t SecondsSinceLastTime,
+                                  time_t SecondsSinceLastRefresh);
+static bool Ses_CheckIfStoredSessionIsUpToDate (void);
+static bool Ses_RemoveSessionFromDB (void);
+static void Ses_BuildConditionOfExpiredSessions (char Expired[Ses_MAX_BYTES_CONDITION_EXPIRED + 1]);
 
 static bool Ses_CheckIfHiddenParIsAlreadyInDB (Act_Action_t NextAction,
                                                const char *ParamName);
@@ -124,7 +131,11 @@ void Ses_CloseSession (void)
    if (Gbl.Usrs.Me.Logged)
      {
       /***** Remove session from database *****/
-      Ses_RemoveSessionFromDB ();
+      if (Ses_RemoveSessionFromDB ())
+	 /***** Add pending clicks to my most frequently used actions *****/
+	 // Only if the session has been removed by this process,
+	 // so clicks are not added twice
+	 MFU_FlushMFUClicks (Gbl.Usrs.Me.UsrDat.UsrCod,Gbl.Session.MFUClicks);
       Gbl.Session.IsOpen = false;
       // Gbl.Session.HasBeenDisconnected = true;
       Gbl.Session.Id[0] = '\0';
@@ -181,6 +192,60 @@ void Ses_InsertSessionInDB (void)
             Gbl.CurrentCrs.Crs.CrsCod,
             Gbl.Search.WhatToSearch);
    DB_QueryINSERT (Query,"can not create session");
+
+   /***** The new session has not pending clicks *****/
+   Gbl.Session.MFUClicks[0] = '\0';
+
+   /***** The new session has just been stored without hidden parameters *****/
+   Ses_SetStoredSession (0,0);
+   Gbl.Session.Stored.NumHiddenParams = 0;
+  }
+
+/*****************************************************************************/
+/*********** Copy current session data to session stored in database *********/
+/*****************************************************************************/
+
+static void Ses_SetStoredSession (time_t SecondsSinceLastTime,
+                                  time_t SecondsSinceLastRefresh)
+  {
+   Gbl.Session.Stored.UsrCod  = Gbl.Usrs.Me.UsrDat.UsrCod;
+   Str_Copy (Gbl.Session.Stored.Password,Gbl.Usrs.Me.UsrDat.Password,
+             Pwd_BYTES_ENCRYPTED_PASSWORD);
+   Gbl.Session.Stored.Role    = Gbl.Usrs.Me.Role.Logged;
+   Gbl.Session.Stored.CtyCod  = Gbl.CurrentCty.Cty.CtyCod;
+   Gbl.Session.Stored.InsCod  = Gbl.CurrentIns.Ins.InsCod;
+   Gbl.Session.Stored.CtrCod  = Gbl.CurrentCtr.Ctr.CtrCod;
+   Gbl.Session.Stored.DegCod  = Gbl.CurrentDeg.Deg.DegCod;
+   Gbl.Session.Stored.CrsCod  = Gbl.CurrentCrs.Crs.CrsCod;
+   Gbl.Session.Stored.SecondsSinceLastTime    = SecondsSinceLastTime;
+   Gbl.Session.Stored.SecondsSinceLastRefresh = SecondsSinceLastRefresh;
+   Str_Copy (Gbl.Session.Stored.MFUClicks,Gbl.Session.MFUClicks,
+             Ses_MAX_BYTES_MFU_CLICKS);
+   Gbl.Session.Stored.Filled = true;
+  }
+
+/*****************************************************************************/
+/******* Check if session stored in database is equal to current session *****/
+/*****************************************************************************/
+// Return true if session in database has the same data than current session
+// and it has been updated recently, so it's not necessary to update it again
+
+static bool Ses_CheckIfStoredSessionIsUpToDate (void)
+  {
+   if (!Gbl.Session.Stored.Filled)
+      return false;
+
+   return Gbl.Session.Stored.UsrCod  == Gbl.Usrs.Me.UsrDat.UsrCod &&
+	  !strcmp (Gbl.Session.Stored.Password,Gbl.Usrs.Me.UsrDat.Password) &&
+	  Gbl.Session.Stored.Role    == Gbl.Usrs.Me.Role.Logged &&
+	  Gbl.Session.Stored.CtyCod  == Gbl.CurrentCty.Cty.CtyCod &&
+	  Gbl.Session.Stored.InsCod  == Gbl.CurrentIns.Ins.InsCod &&
+	  Gbl.Session.Stored.CtrCod  == Gbl.CurrentCtr.Ctr.CtrCod &&
+	  Gbl.Session.Stored.DegCod  == Gbl.CurrentDeg.Deg.DegCod &&
+	  Gbl.Session.Stored.CrsCod  == Gbl.CurrentCrs.Crs.CrsCod &&
+	  !strcmp (Gbl.Session.Stored.MFUClicks,Gbl.Session.MFUClicks) &&
+	  Gbl.Session.Stored.SecondsSinceLastTime    < Cfg_TIME_TO_UPDATE_SESSION_IN_DB &&
+	  Gbl.Session.Stored.SecondsSinceLastRefresh < Cfg_TIME_TO_UPDATE_SESSION_IN_DB;
   }
 
 /*****************************************************************************/
@@ -191,12 +256,19 @@ void Ses_UpdateSessionDataInDB (void)
   {
    char Query[1024 +
               Pwd_BYTES_ENCRYPTED_PASSWORD +
+              Ses_MAX_BYTES_MFU_CLICKS +
               Ses_BYTES_SESSION_ID];
 
+   /***** Clicks made quickly without changes in session
+          are not written in database *****/
+   if (Ses_CheckIfStoredSessionIsUpToDate ())
+      return;
+
    /***** Update session in database *****/
+   // Pending clicks in most frequently used actions are written in the same query
    sprintf (Query,"UPDATE sessions SET UsrCod=%ld,Password='%s',Role=%u,"
                   "CtyCod=%ld,InsCod=%ld,CtrCod=%ld,DegCod=%ld,CrsCod=%ld,"
-                  "LastTime=NOW(),LastRefresh=NOW()"
+                  "LastTime=NOW(),LastRefresh=NOW(),MFUClicks='%s'"
                   " WHERE SessionId='%s'",
             Gbl.Usrs.Me.UsrDat.UsrCod,
             Gbl.Usrs.Me.UsrDat.Password,
@@ -206,8 +278,12 @@ void Ses_UpdateSessionDataInDB (void)
             Gbl.CurrentCtr.Ctr.CtrCod,
             Gbl.CurrentDeg.Deg.DegCod,
             Gbl.CurrentCrs.Crs.CrsCod,
+            Gbl.Session.MFUClicks,
             Gbl.Session.Id);
    DB_QueryUPDATE (Query,"can not update session");
+
+   /***** Session in database is now equal to current session *****/
+   Ses_SetStoredSession (0,0);
   }
 
 /*****************************************************************************/
@@ -218,6 +294,14 @@ void Ses_UpdateSessionLastRefreshInDB (void)
   {
    char Query[128 + Ses_BYTES_SESSION_ID];
 
+   /***** Refreshes made quickly are coalesced in only one update *****/
+   if (Gbl.Session.Stored.Filled)
+     {
+      if (Gbl.Session.Stored.SecondsSinceLastRefresh < Cfg_TIME_TO_UPDATE_SESSION_IN_DB)
+	 return;
+      Gbl.Session.Stored.SecondsSinceLastRefresh = 0;
+     }
+
    /***** Update session in database *****/
    sprintf (Query,"UPDATE sessions SET LastRefresh=NOW() WHERE SessionId='%s'",
 	    Gbl.Session.Id);
@@ -227,42 +311,92 @@ void Ses_UpdateSessionLastRefreshInDB (void)
 /*****************************************************************************/
 /********************** Remove session from the database *********************/
 /*****************************************************************************/
+// Return true if the session has been removed by this process
 
-static void Ses_RemoveSessionFromDB (void)
+static bool Ses_RemoveSessionFromDB (void)
   {
    char Query[128 + Ses_BYTES_SESSION_ID];
+   bool Removed;
 
    /***** Remove current session *****/
    sprintf (Query,"DELETE FROM sessions WHERE SessionId='%s'",
             Gbl.Session.Id);
-   DB_QueryDELETE (Query,"can not remove a session");
+   Removed = (DB_QueryDELETEandReturnNumRows (Query,"can not remove a session") != 0);
 
    /***** Clear old unused social timelines in database *****/
    // This is necessary to prevent the table growing and growing
    Soc_ClearOldTimelinesDB ();
+
+   return Removed;
   }
 
 /*****************************************************************************/
-/*************************** Remove expired sessions *************************/
+/********** Build the condition of expired sessions for a query **************/
 /*****************************************************************************/
 
-void Ses_RemoveExpiredSessions (void)
+static void Ses_BuildConditionOfExpiredSessions (char Expired[Ses_MAX_BYTES_CONDITION_EXPIRED + 1])
   {
-   char Query[1024];
-
-   /***** Remove expired sessions *****/
    /* A session expire
       when last click (LastTime) is too old,
       or (when there was at least one refresh (navigator supports AJAX)
           and last refresh is too old (browser probably was closed)) */
-   sprintf (Query,"DELETE LOW_PRIORITY FROM sessions WHERE"
-                  " LastTime<FROM_UNIXTIME(UNIX_TIMESTAMP()-'%lu')"
-                  " OR "
-                  "(LastRefresh>LastTime+INTERVAL 1 SECOND"
-                  " AND"
-                  " LastRefresh<FROM_UNIXTIME(UNIX_TIMESTAMP()-'%lu'))",
+   sprintf (Expired,"(LastTime<FROM_UNIXTIME(UNIX_TIMESTAMP()-'%lu')"
+                    " OR "
+                    "(LastRefresh>LastTime+INTERVAL 1 SECOND"
+                    " AND"
+                    " LastRefresh<FROM_UNIXTIME(UNIX_TIMESTAMP()-'%lu')))",
             Cfg_TIME_TO_CLOSE_SESSION_FROM_LAST_CLICK,
             Cfg_TIME_TO_CLOSE_SESSION_FROM_LAST_REFRESH);
+  }
+
+/*****************************************************************************/
+/*************************** Remove expired sessions *************************/
+/*****************************************************************************/
+// Each expired session with pending clicks in most frequently used actions
+// is removed before adding its clicks, and clicks are added only
+// if this process has removed the session, so they are added only once
+
+void Ses_RemoveExpiredSessions (void)
+  {
+   char Expired[Ses_MAX_BYTES_CONDITION_EXPIRED + 1];
+   char Query[256 + Ses_MAX_BYTES_CONDITION_EXPIRED];
+   MYSQL_RES *mysql_res;
+   MYSQL_ROW row;
+   unsigned long NumRow;
+   unsigned long NumRows;
+
+   Ses_BuildConditionOfExpiredSessions (Expired);
+
+   /***** Get expired sessions with pending clicks *****/
+   sprintf (Query,"SELECT SessionId,UsrCod,MFUClicks FROM sessions"
+	          " WHERE %s AND MFUClicks<>''",
+            Expired);
+   NumRows = DB_QuerySELECT (Query,&mysql_res,"can not get expired sessions");
+
+   /***** Remove sessions with pending clicks and add their clicks *****/
+   for (NumRow = 0;
+	NumRow < NumRows;
+	NumRow++)
+     {
+      row = mysql_fetch_row (mysql_res);
+
+      /* Remove session (row[0]) */
+      sprintf (Query,"DELETE FROM sessions WHERE SessionId='%s'",
+               row[0]);
+      if (DB_QueryDELETEandReturnNumRows (Query,"can not remove expired session"))
+	 /* Add pending clicks (row[2]) of user (row[1]) */
+	 MFU_FlushMFUClicks (Str_ConvertStrCodToLongCod (row[1]),row[2]);
+     }
+
+   /***** Free structure that stores the query result *****/
+   DB_FreeMySQLResult (&mysql_res);
+
+   /***** Remove the rest of expired sessions *****/
+   // Sessions expired just now with pending clicks are not removed here,
+   // so their clicks are not lost, and they will be removed in next request
+   sprintf (Query,"DELETE LOW_PRIORITY FROM sessions"
+	          " WHERE %s AND MFUClicks=''",
+            Expired);
    DB_QueryDELETE (Query,"can not remove expired sessions");
   }
 
@@ -272,18 +406,27 @@ void Ses_RemoveExpiredSessions (void)
 
 bool Ses_GetSessionData (void)
   {
-   char Query[256 + Ses_BYTES_SESSION_ID];
+   char Expired[Ses_MAX_BYTES_CONDITION_EXPIRED + 1];
+   char Query[512 + Ses_MAX_BYTES_CONDITION_EXPIRED + Ses_BYTES_SESSION_ID];
    MYSQL_RES *mysql_res;
    MYSQL_ROW row;
    unsigned UnsignedNum;
    bool Result = false;
 
    /***** Query data of session from database *****/
+   // An expired session with pending clicks may be still in database
+   // if it expired after removing expired sessions, but it can not be used
+   Ses_BuildConditionOfExpiredSessions (Expired);
    sprintf (Query,"SELECT UsrCod,Password,Role,"
 	          "CtyCod,InsCod,CtrCod,DegCod,CrsCod,"
-	          "WhatToSearch,SearchStr"
-	          " FROM sessions WHERE SessionId='%s'",
-	    Gbl.Session.Id);
+	          "WhatToSearch,SearchStr,"
+	          "UNIX_TIMESTAMP()-UNIX_TIMESTAMP(LastTime),"
+	          "UNIX_TIMESTAMP()-UNIX_TIMESTAMP(LastRefresh),"
+	          "(SELECT COUNT(*) FROM hidden_params"
+	          " WHERE hidden_params.SessionId=sessions.SessionId),"
+	          "MFUClicks"
+	          " FROM sessions WHERE SessionId='%s' AND NOT %s",
+	    Gbl.Session.Id,Expired);
 
    /***** Check if the session existed in the database *****/
    if (DB_QuerySELECT (Query,&mysql_res,"can not get data of session"))
@@ -332,6 +475,36 @@ bool Ses_GetSessionData (void)
 	           Sch_MAX_BYTES_STRING_TO_FIND);
 	}
 
+      /***** Keep session as it is stored in database
+             in order to avoid unnecessary updates *****/
+      Gbl.Session.Stored.UsrCod = Gbl.Session.UsrCod;
+      Str_Copy (Gbl.Session.Stored.Password,Gbl.Usrs.Me.LoginEncryptedPassword,
+                Pwd_BYTES_ENCRYPTED_PASSWORD);
+      Gbl.Session.Stored.Role   = Gbl.Usrs.Me.Role.FromSession;
+      Gbl.Session.Stored.CtyCod = Gbl.CurrentCty.Cty.CtyCod;
+      Gbl.Session.Stored.InsCod = Gbl.CurrentIns.Ins.InsCod;
+      Gbl.Session.Stored.CtrCod = Gbl.CurrentCtr.Ctr.CtrCod;
+      Gbl.Session.Stored.DegCod = Gbl.CurrentDeg.Deg.DegCod;
+      Gbl.Session.Stored.CrsCod = Gbl.CurrentCrs.Crs.CrsCod;
+
+      /* Get seconds since last click (row[10]) */
+      Gbl.Session.Stored.SecondsSinceLastTime = Dat_GetUNIXTimeFromStr (row[10]);
+
+      /* Get seconds since last refresh (row[11]) */
+      Gbl.Session.Stored.SecondsSinceLastRefresh = Dat_GetUNIXTimeFromStr (row[11]);
+
+      /* Get number of hidden parameters of this session (row[12]) */
+      if (sscanf (row[12],"%u",&Gbl.Session.Stored.NumHiddenParams) != 1)
+         Gbl.Session.Stored.NumHiddenParams = 1;	// Unknown ==> don't skip queries on hidden params
+
+      /* Get clicks not yet added to most frequently used actions (row[13]) */
+      Str_Copy (Gbl.Session.MFUClicks,row[13],
+                Ses_MAX_BYTES_MFU_CLICKS);
+      Str_Copy (Gbl.Session.Stored.MFUClicks,row[13],
+                Ses_MAX_BYTES_MFU_CLICKS);
+
+      Gbl.Session.Stored.Filled = true;
+
       Result = true;
      }
 
@@ -386,6 +559,7 @@ void Ses_InsertHiddenParInDB (Act_Action_t NextAction,
 					"");
 	    DB_QueryINSERT (Query,"can not create hidden parameter");
 	    Gbl.HiddenParamsInsertedIntoDB = true;
+	    Gbl.Session.Stored.NumHiddenParams++;
 
 	    /***** Free query *****/
 	    free ((void *) Query);
@@ -403,10 +577,16 @@ void Ses_RemoveHiddenParFromThisSession (void)
    if (Gbl.Session.IsOpen &&			// There is an open session
        !Gbl.HiddenParamsInsertedIntoDB)		// No params just inserted
      {
+      /***** Don't try to remove anything if there are no hidden parameters *****/
+      if (Gbl.Session.Stored.Filled &&
+	  !Gbl.Session.Stored.NumHiddenParams)
+	 return;
+
       /***** Remove hidden parameters of this session *****/
       sprintf (Query,"DELETE FROM hidden_params WHERE SessionId='%s'",
                Gbl.Session.Id);
       DB_QueryDELETE (Query,"can not remove hidden parameters of current session");
+      Gbl.Session.Stored.NumHiddenParams = 0;
      }
   }
 
@@ -434,6 +614,11 @@ static bool Ses_CheckIfHiddenParIsAlreadyInDB (Act_Action_t NextAction,
   {
    char Query[512 + Ses_BYTES_SESSION_ID];
 
+   /***** Trivial check: there are no hidden parameters in this session *****/
+   if (Gbl.Session.Stored.Filled &&
+       !Gbl.Session.Stored.NumHiddenParams)
+      return false;
+
    /***** Get a hidden parameter from database *****/
    sprintf (Query,"SELECT COUNT(*) FROM hidden_params"
                   " WHERE SessionId='%s' AND Action=%ld AND ParamName='%s'",
@@ -459,7 +644,9 @@ unsigned Ses_GetHiddenParFromDB (Act_Action_t NextAction,
    const char *Ptr;
 
    ParamValue[0] = '\0';
-   if (Gbl.Session.IsOpen)	// If the session is open, get parameter from DB
+   if (Gbl.Session.IsOpen &&		// If the session is open, get parameter from DB
+       !(Gbl.Session.Stored.Filled &&
+	 !Gbl.Session.Stored.NumHiddenParams))
      {
       /***** Get a hidden parameter from database *****/
       sprintf (Query,"SELECT ParamValue FROM hidden_params"
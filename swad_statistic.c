@@ -69,6 +69,11 @@ extern struct Globals Gbl;
 
 #define Sta_SECONDS_IN_RECENT_LOG ((time_t) (Cfg_DAYS_IN_RECENT_LOG * 24UL * 60UL * 60UL))	// Remove entries in recent log oldest than this time
 
+#define Sta_DAYS_OF_PARTITIONS_AHEAD_IN_RECENT_LOG	7	// Daily partitions created in advance in recent log
+#define Sta_MONTHS_OF_PARTITIONS_AHEAD_IN_FULL_LOG	2	// Monthly partitions created in advance in historic log
+#define Sta_MAX_PARTITIONS_ADDED_AT_ONCE		64
+#define Sta_MAX_PARTITIONS_DROPPED_AT_ONCE		64
+
 const unsigned Sta_CellPadding[Sta_NUM_CLICKS_GROUPED_BY] =
   {
    2,	// Sta_CLICKS_CRS_DETAILED_LIST
@@ -130,10 +135,19 @@ typedef enum
    Sta_SHOW_COURSE_ACCESSES,
   } Sta_GlobalOrCourseAccesses_t;
 
+typedef enum
+  {
+   Sta_DAILY_PARTITIONS,	// Partitions pYYYYMMDD
+   Sta_MONTHLY_PARTITIONS,	// Partitions pYYYYMM
+  } Sta_LogPartitions_t;
+
 /*****************************************************************************/
 /***************************** Internal prototypes ***************************/
 /*****************************************************************************/
 
+static bool Sta_AddPartitionsToLogTable (const char *Table,Sta_LogPartitions_t Partitions);
+static void Sta_DropOldPartitionsFromRecentLog (void);
+
 static void Sta_WriteSelectorCountType (void);
 static void Sta_WriteSelectorAction (void);
 static void Sta_ShowHits (Sta_GlobalOrCourseAccesses_t GlobalOrCourse);
@@ -340,6 +354,33 @@ void Sta_LogAccess (const char *Comments)
    else
       DB_QueryINSERT (Query,"can not log access (recent)");
 
+   /* Log access in sample log (log_sample).
+      Bytes of the page before and after compression are stored only here,
+      to get the benefit and the cost (in time to send) of compression
+      for each action */
+   if (LogCod % Cfg_CLICKS_PER_SAMPLE_IN_LOG == 0)
+     {
+      sprintf (Query,"INSERT INTO log_sample "
+		     "(LogCod,ActCod,CtyCod,InsCod,CtrCod,DegCod,CrsCod,UsrCod,"
+		     "Role,ClickTime,TimeToGenerate,TimeToSend,"
+		     "PageBytes,SentBytes,IP)"
+		     " SELECT "
+		     "LogCod,ActCod,CtyCod,InsCod,CtrCod,DegCod,CrsCod,UsrCod,"
+		     "Role,ClickTime,TimeToGenerate,TimeToSend,"
+		     "%lu,%lu,IP"
+		     " FROM log_recent WHERE LogCod=%ld",
+	       Gbl.HTMLOutput.PageBytes,
+	       Gbl.HTMLOutput.SentBytes,
+	       LogCod);
+      if (Gbl.WebService.IsWebService)
+	{
+	 if (mysql_query (&Gbl.mysql,Query))
+	    Svc_Exit ("can not log access (sample)");
+	}
+      else
+	 DB_QueryINSERT (Query,"can not log access (sample)");
+     }
+
    if (Comments)
      {
       /* Log comments */
@@ -411,18 +452,288 @@ void Sta_LogAccess (const char *Comments)
   }
 
 /*****************************************************************************/
-/************ Sometimes, we delete old entries in recent log table ***********/
+/****************** Log automatic refresh via AJAX in database ***************/
+/*****************************************************************************/
+// Automatic refreshes are too frequent to be logged one by one.
+// Only a sample of them is accumulated, per action and day,
+// to get the times to generate and send each type of refresh
+
+void Sta_LogRefresh (void)
+  {
+   char Query[512];
+
+   if (Gbl.PID % Cfg_CLICKS_PER_SAMPLE_IN_LOG)
+      return;
+
+   sprintf (Query,"INSERT INTO log_refresh"
+	          " (ActCod,ClickDay,NumRefreshes,TimeToGenerate,TimeToSend)"
+                  " VALUES"
+                  " (%ld,CURDATE(),1,%ld,%ld)"
+                  " ON DUPLICATE KEY UPDATE"
+                  " NumRefreshes=NumRefreshes+1,"
+                  "TimeToGenerate=TimeToGenerate+VALUES(TimeToGenerate),"
+                  "TimeToSend=TimeToSend+VALUES(TimeToSend)",
+            Act_GetActCod (Gbl.Action.Act),
+            Gbl.TimeGenerationInMicroseconds,
+            Gbl.TimeSendInMicroseconds);
+   DB_QueryINSERT (Query,"can not log refresh");
+  }
+
+/*****************************************************************************/
+/*************** Sometimes, we rotate partitions of log tables ***************/
+/*****************************************************************************/
+// Log tables may be partitioned by date (see swad_convert_log.c):
+// recent log in daily partitions and historic log in monthly partitions
+
+void Sta_RotateLogTables (void)
+  {
+   char Query[512];
+   MYSQL_RES *mysql_res;
+
+   /***** Only one process rotates log tables at a time.
+          If another process is rotating them ==> do nothing *****/
+   // The lock is released by MySQL if this process exits on error
+   if (DB_QueryCOUNT ("SELECT COALESCE(GET_LOCK('swad_log_rotation',0),0)",
+		      "can not get lock to rotate log tables") == 0)
+      return;
+
+   /***** Recent log *****/
+   if (Sta_AddPartitionsToLogTable ("log_recent",Sta_DAILY_PARTITIONS))
+      /* Remove old entries dropping whole days */
+      Sta_DropOldPartitionsFromRecentLog ();
+   else	// Recent log is not partitioned
+     {
+      /* Remove old entries one by one (slow query) */
+      sprintf (Query,"DELETE LOW_PRIORITY FROM log_recent"
+		     " WHERE ClickTime<FROM_UNIXTIME(UNIX_TIMESTAMP()-'%lu')",
+	       Sta_SECONDS_IN_RECENT_LOG);
+      DB_QueryDELETE (Query,"can not remove old entries from recent log");
+     }
+
+   /***** Historic log *****/
+   // Entries in historic log are never removed
+   Sta_AddPartitionsToLogTable ("log_full",Sta_MONTHLY_PARTITIONS);
+
+   /***** Release lock *****/
+   DB_QuerySELECT ("SELECT RELEASE_LOCK('swad_log_rotation')",&mysql_res,
+		   "can not release lock to rotate log tables");
+   DB_FreeMySQLResult (&mysql_res);
+  }
+
+/*****************************************************************************/
+/************** Add partitions for next days or months to a log **************/
 /*****************************************************************************/
+// Partition pYYYYMMDD (or pYYYYMM) has the entries of that day (or month)
+// and the older ones not in previous partitions.
+// The last partition, pmax, has the entries not in other partitions.
+// New partitions are got reorganizing pmax, which is usually empty.
+// Return false if the table is not partitioned
 
-void Sta_RemoveOldEntriesRecentLog (void)
+static bool Sta_AddPartitionsToLogTable (const char *Table,Sta_LogPartitions_t Partitions)
   {
    char Query[512];
+   char *QueryReorganize;
+   MYSQL_RES *mysql_res;
+   MYSQL_ROW row;
+   unsigned long NumRows;
+   struct tm *tm_ptr;
+   struct tm tm;
+   struct tm tmNext;
+   time_t TimeFirst;
+   time_t TimeLast;
+   unsigned Year;
+   unsigned Month;
+   unsigned Day = 1;
+   bool LastPartitionFound = false;
+   unsigned NumPartitions;
+   size_t Length;
+
+   /***** Get the last partition before pmax *****/
+   sprintf (Query,"SELECT PARTITION_NAME FROM information_schema.PARTITIONS"
+		  " WHERE TABLE_SCHEMA=DATABASE() AND TABLE_NAME='%s'"
+		  " AND PARTITION_NAME IS NOT NULL"
+		  " ORDER BY PARTITION_ORDINAL_POSITION DESC LIMIT 2",
+	    Table);
+   if ((NumRows = DB_QuerySELECT (Query,&mysql_res,"can not get partitions of log")) == 2)
+     {
+      mysql_fetch_row (mysql_res);		// pmax
+      row = mysql_fetch_row (mysql_res);	// Last partition before pmax
+
+      /* Get date of last partition (row[0]) */
+      switch (Partitions)
+	{
+	 case Sta_DAILY_PARTITIONS:
+	    LastPartitionFound = (sscanf (row[0],"p%4u%2u%2u",&Year,&Month,&Day) == 3);
+	    break;
+	 case Sta_MONTHLY_PARTITIONS:
+	    LastPartitionFound = (sscanf (row[0],"p%4u%2u",&Year,&Month) == 2);
+	    break;
+	}
+     }
+
+   /***** Free structure that stores the query result *****/
+   DB_FreeMySQLResult (&mysql_res);
+
+   /***** Check if table is partitioned *****/
+   if (NumRows == 0)
+      return false;
+
+   /***** Get today (or this month) *****/
+   if ((tm_ptr = localtime (&Gbl.StartExecutionTimeUTC)) == NULL)
+      Lay_ShowErrorAndExit ("Can not get current date.");
+   tm = *tm_ptr;
+   tm.tm_hour = 12;	// Avoid problems with daylight saving time
+   tm.tm_min = tm.tm_sec = 0;
+   tm.tm_isdst = -1;
+   if (Partitions == Sta_MONTHLY_PARTITIONS)
+      tm.tm_mday = 1;
+
+   /***** Get last day (or month) of partitions to add *****/
+   tmNext = tm;
+   switch (Partitions)
+     {
+      case Sta_DAILY_PARTITIONS:
+	 tmNext.tm_mday += Sta_DAYS_OF_PARTITIONS_AHEAD_IN_RECENT_LOG;
+	 break;
+      case Sta_MONTHLY_PARTITIONS:
+	 tmNext.tm_mon += Sta_MONTHS_OF_PARTITIONS_AHEAD_IN_FULL_LOG;
+	 break;
+     }
+   TimeLast = mktime (&tmNext);
+
+   /***** Get first day (or month) of partitions to add *****/
+   if (LastPartitionFound)
+     {
+      /* Next day (or month) after the last partition */
+      tmNext = tm;
+      tmNext.tm_year = (int) Year - 1900;
+      tmNext.tm_mon  = (int) Month - 1;
+      tmNext.tm_mday = (int) Day;
+      switch (Partitions)
+	{
+	 case Sta_DAILY_PARTITIONS:
+	    tmNext.tm_mday++;
+	    break;
+	 case Sta_MONTHLY_PARTITIONS:
+	    tmNext.tm_mon++;
+	    break;
+	}
+      TimeFirst = mktime (&tmNext);
+
+      /* Days older than recent log will be removed, so they are not needed */
+      if (Partitions == Sta_DAILY_PARTITIONS)
+	{
+	 tm.tm_mday -= Cfg_DAYS_IN_RECENT_LOG;
+	 if (mktime (&tm) > TimeFirst)
+	    tmNext = tm;
+	}
+      tm = tmNext;
+     }
+   if (mktime (&tm) > TimeLast)
+      return true;	// Nothing to do
+
+   /***** Allocate space for query *****/
+   if ((QueryReorganize = (char *) malloc (256 + Sta_MAX_PARTITIONS_ADDED_AT_ONCE * 128)) == NULL)
+      Lay_ShowErrorAndExit ("Not enough memory for query.");
+
+   /***** Reorganize pmax into new partitions and pmax *****/
+   Length = sprintf (QueryReorganize,"ALTER TABLE %s REORGANIZE PARTITION pmax INTO (",
+		     Table);
+   for (NumPartitions = 0;
+	NumPartitions < Sta_MAX_PARTITIONS_ADDED_AT_ONCE &&
+	mktime (&tm) <= TimeLast;
+	NumPartitions++)
+     {
+      /* Get next day (or month) */
+      tmNext = tm;
+      switch (Partitions)
+	{
+	 case Sta_DAILY_PARTITIONS:
+	    tmNext.tm_mday++;
+	    mktime (&tmNext);
+	    Length += sprintf (QueryReorganize + Length,
+			       "PARTITION p%04d%02d%02d"
+			       " VALUES LESS THAN (TO_DAYS('%04d-%02d-%02d')),",
+			       1900 + tm.tm_year,1 + tm.tm_mon,tm.tm_mday,
+			       1900 + tmNext.tm_year,1 + tmNext.tm_mon,tmNext.tm_mday);
+	    break;
+	 case Sta_MONTHLY_PARTITIONS:
+	    tmNext.tm_mon++;
+	    mktime (&tmNext);
+	    Length += sprintf (QueryReorganize + Length,
+			       "PARTITION p%04d%02d"
+			       " VALUES LESS THAN (TO_DAYS('%04d-%02d-01')),",
+			       1900 + tm.tm_year,1 + tm.tm_mon,
+			       1900 + tmNext.tm_year,1 + tmNext.tm_mon);
+	    break;
+	}
+      tm = tmNext;
+     }
+   sprintf (QueryReorganize + Length,"PARTITION pmax VALUES LESS THAN MAXVALUE)");
+   DB_Query (QueryReorganize,"can not add partitions to log");
+
+   /***** Free memory used for query *****/
+   free ((void *) QueryReorganize);
+
+   return true;
+  }
+
+/*****************************************************************************/
+/************* Drop partitions of days older than the recent log *************/
+/*****************************************************************************/
+
+static void Sta_DropOldPartitionsFromRecentLog (void)
+  {
+   char Query[256 + Sta_MAX_PARTITIONS_DROPPED_AT_ONCE * 16];
+   MYSQL_RES *mysql_res;
+   MYSQL_ROW row;
+   unsigned long NumRow;
+   unsigned long NumRows;
+   time_t TimeOldest = Gbl.StartExecutionTimeUTC - Sta_SECONDS_IN_RECENT_LOG;
+   struct tm *tm_ptr;
+   char OldestPartition[1 + 8 + 1];
+
+   /***** Get the partition of the oldest day in recent log *****/
+   if ((tm_ptr = localtime (&TimeOldest)) == NULL)
+      Lay_ShowErrorAndExit ("Can not get date.");
+   if (snprintf (OldestPartition,sizeof (OldestPartition),"p%04d%02d%02d",
+		 1900 + tm_ptr->tm_year,1 + tm_ptr->tm_mon,tm_ptr->tm_mday) !=
+       (int) sizeof (OldestPartition) - 1)
+      Lay_ShowErrorAndExit ("Wrong date of partition.");
+
+   /***** Get partitions of older days *****/
+   // Names of partitions are ordered as dates
+   sprintf (Query,"SELECT PARTITION_NAME FROM information_schema.PARTITIONS"
+		  " WHERE TABLE_SCHEMA=DATABASE() AND TABLE_NAME='log_recent'"
+		  " AND PARTITION_NAME<>'pmax' AND PARTITION_NAME<'%s'"
+		  " ORDER BY PARTITION_ORDINAL_POSITION LIMIT %u",
+	    OldestPartition,
+	    Sta_MAX_PARTITIONS_DROPPED_AT_ONCE);
+   NumRows = DB_QuerySELECT (Query,&mysql_res,"can not get partitions of log");
+
+   /***** Drop them in only one query *****/
+   if (NumRows)
+     {
+      Str_Copy (Query,"ALTER TABLE log_recent DROP PARTITION ",
+                sizeof (Query) - 1);
+      for (NumRow = 0;
+	   NumRow < NumRows;
+	   NumRow++)
+	{
+	 row = mysql_fetch_row (mysql_res);
+
+	 /* Get partition name (row[0]) */
+	 if (NumRow)
+	    Str_Concat (Query,",",
+	                sizeof (Query) - 1);
+	 Str_Concat (Query,row[0],
+	             sizeof (Query) - 1);
+	}
+      DB_Query (Query,"can not remove old entries from recent log");
+     }
 
-   /***** Remove all expired clipboards *****/
-   sprintf (Query,"DELETE LOW_PRIORITY FROM log_recent"
-                  " WHERE ClickTime<FROM_UNIXTIME(UNIX_TIMESTAMP()-'%lu')",
-            Sta_SECONDS_IN_RECENT_LOG);
-   DB_QueryDELETE (Query,"can not remove old entries from recent log");
+   /***** Free structure that stores the query result *****/
+   DB_FreeMySQLResult (&mysql_res);
   }
 
 /*****************************************************************************/
@@ -645,9 +956,12 @@ void Sta_AskShowGblHits (void)
    extern const char *Txt_Show;
    extern const char *Txt_distributed_by;
    extern const char *Txt_STAT_CLICKS_GROUPED_BY[Sta_NUM_CLICKS_GROUPED_BY];
+   extern const char *Txt_Accuracy;
+   extern const char *Txt_STAT_EXACT_OR_APPROXIMATE[Sta_NUM_EXACT_OR_APPROXIMATE];
    extern const char *Txt_Show_hits;
    Sta_Role_t RoleStat;
    Sta_ClicksGroupedBy_t ClicksGroupedBy;
+   Sta_ExactOrApproximate_t ExactOrApproximate;
 
    /***** Contextual links *****/
    fprintf (Gbl.F.Out,"<div class=\"CONTEXT_MENU\">");
@@ -759,6 +1073,27 @@ void Sta_AskShowGblHits (void)
 		      "</td>"
 		      "</tr>");
 
+   /***** Exact or approximate (fast) statistic *****/
+   fprintf (Gbl.F.Out,"<tr>"
+                      "<td class=\"RIGHT_MIDDLE\">"
+                      "<label for=\"ExactOrApproximate\" class=\"%s\">%s:</label>"
+                      "</td>"
+                      "<td colspan=\"2\" class=\"LEFT_MIDDLE\">"
+                      "<select id=\"ExactOrApproximate\" name=\"ExactOrApproximate\">",
+            The_ClassForm[Gbl.Prefs.Theme],Txt_Accuracy);
+   for (ExactOrApproximate = (Sta_ExactOrApproximate_t) 0;
+	ExactOrApproximate < Sta_NUM_EXACT_OR_APPROXIMATE;
+	ExactOrApproximate++)
+     {
+      fprintf (Gbl.F.Out,"<option value=\"%u\"",(unsigned) ExactOrApproximate);
+      if (ExactOrApproximate == Gbl.Stat.ExactOrApproximate)
+	 fprintf (Gbl.F.Out," selected=\"selected\"");
+      fprintf (Gbl.F.Out,">%s",Txt_STAT_EXACT_OR_APPROXIMATE[ExactOrApproximate]);
+     }
+   fprintf (Gbl.F.Out,"</select>"
+	              "</td>"
+	              "</tr>");
+
    /***** End table *****/
    Tbl_EndTable ();
 
@@ -880,6 +1215,7 @@ static void Sta_ShowHits (Sta_GlobalOrCourseAccesses_t GlobalOrCourse)
    extern const char *Txt_List_of_detailed_clicks;
    extern const char *Txt_STAT_TYPE_COUNT_CAPS[Sta_NUM_COUNT_TYPES];
    extern const char *Txt_Time_zone_used_in_the_calculation_of_these_statistics;
+   extern const char *Txt_Approximate_values_estimated_from_a_sample_of_one_out_of_every_X_clicks;
    char Query[Sta_MAX_BYTES_QUERY_ACCESS + 1];
    char QueryAux[512];
    long LengthQuery;
@@ -895,6 +1231,7 @@ static void Sta_ShowHits (Sta_GlobalOrCourseAccesses_t GlobalOrCourse)
    char StrQueryCountType[Sta_MAX_BYTES_COUNT_TYPE + 1];
    unsigned NumDays;
    bool ICanQueryWholeRange;
+   bool Approximate;
 
    /***** Get initial and ending dates *****/
    Dat_GetIniEndDatesFromForm ();
@@ -950,6 +1287,13 @@ static void Sta_ShowHits (Sta_GlobalOrCourseAccesses_t GlobalOrCourse)
 					           Sta_NUM_ROLES_STAT - 1,
 				                   (unsigned long) Sta_ROLE_DEFAULT);
 
+	 /***** Get if the statistic must be exact or approximate *****/
+	 Gbl.Stat.ExactOrApproximate = (Sta_ExactOrApproximate_t)
+				       Par_GetParToUnsignedLong ("ExactOrApproximate",
+								 0,
+								 Sta_NUM_EXACT_OR_APPROXIMATE - 1,
+								 (unsigned long) Sta_EXACT_OR_APPROXIMATE_DEFAULT);
+
 	 /***** Get users range for access statistics *****/
 	 Gbl.Scope.Allowed = 1 << Sco_SCOPE_SYS |
 			     1 << Sco_SCOPE_CTY |
@@ -1041,12 +1385,26 @@ static void Sta_ShowHits (Sta_GlobalOrCourseAccesses_t GlobalOrCourse)
       return;
      }
 
+   /***** Approximate statistics are got from the sample of log *****/
+   /* Only the number of clicks can be estimated from the sample,
+      and only when the historic log would be used */
+   Approximate = GlobalOrCourse == Sta_SHOW_GLOBAL_ACCESSES &&
+		 Gbl.Stat.ExactOrApproximate == Sta_APPROXIMATE &&
+		 Gbl.Stat.CountType == Sta_TOTAL_CLICKS &&
+		 !strcmp (LogTable,"log_full");
+   if (Approximate)
+      LogTable = "log_sample";
+
    /***** Query depending on the type of count *****/
    switch (Gbl.Stat.CountType)
      {
       case Sta_TOTAL_CLICKS:
-         Str_Copy (StrQueryCountType,"COUNT(*)",
-                   Sta_MAX_BYTES_COUNT_TYPE);
+	 if (Approximate)
+	    sprintf (StrQueryCountType,"COUNT(*)*%u",
+		     Cfg_CLICKS_PER_SAMPLE_IN_LOG);
+	 else
+            Str_Copy (StrQueryCountType,"COUNT(*)",
+                      Sta_MAX_BYTES_COUNT_TYPE);
 	 break;
       case Sta_DISTINCT_USRS:
          sprintf (StrQueryCountType,"COUNT(DISTINCT(%s.UsrCod))",LogTable);
@@ -1169,6 +1527,9 @@ static void Sta_ShowHits (Sta_GlobalOrCourseAccesses_t GlobalOrCourse)
                   StrQueryCountType,LogTable);
 	 break;
      }
+   /* When log table is partitioned by date,
+      this range of ClickTime makes MySQL read only the partitions
+      of the selected days or months (partition pruning) */
    sprintf (QueryAux," WHERE %s.ClickTime"
 	             " BETWEEN FROM_UNIXTIME(%ld) AND FROM_UNIXTIME(%ld)",
             LogTable,
@@ -1554,6 +1915,20 @@ static void Sta_ShowHits (Sta_GlobalOrCourseAccesses_t GlobalOrCourse)
    if (Gbl.Action.Act == ActSeeAccCrs)
       Usr_FreeListsSelectedUsrsCods ();
 
+   /***** Write error bounds of approximate values *****/
+   /* If a value N is estimated from n = N/R clicks in the sample,
+      the standard deviation of the estimation is about sqrt(R*N) */
+   if (Approximate && NumRows)
+     {
+      fprintf (Gbl.F.Out,"<p class=\"DAT_SMALL CENTER_MIDDLE\">");
+      fprintf (Gbl.F.Out,Txt_Approximate_values_estimated_from_a_sample_of_one_out_of_every_X_clicks,
+	       Cfg_CLICKS_PER_SAMPLE_IN_LOG,
+	       Cfg_CLICKS_PER_SAMPLE_IN_LOG,
+	       (unsigned) (200.0 * sqrt ((double) Cfg_CLICKS_PER_SAMPLE_IN_LOG / 1E4) + 0.5),
+	       (unsigned) (200.0 * sqrt ((double) Cfg_CLICKS_PER_SAMPLE_IN_LOG / 1E6) + 0.5));
+      fprintf (Gbl.F.Out,"</p>");
+     }
+
    /***** Write time zone used in the calculation of these statistics *****/
    switch (Gbl.Stat.ClicksGroupedBy)
      {
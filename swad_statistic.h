@@ -72,6 +72,14 @@ typedef enum
   } Sta_ClicksDetailedOrGrouped_t;
 #define Sta_CLICKS_DETAILED_OR_GROUPED_DEFAULT Sta_CLICKS_GROUPED
 
+#define Sta_NUM_EXACT_OR_APPROXIMATE	2
+typedef enum
+  {
+   Sta_EXACT		= 0,	// Count all the clicks in log
+   Sta_APPROXIMATE	= 1,	// Estimate from the sample of log
+  } Sta_ExactOrApproximate_t;
+#define Sta_EXACT_OR_APPROXIMATE_DEFAULT Sta_EXACT
+
 #define Sta_NUM_CLICKS_GROUPED_BY	24
 typedef enum
   {
@@ -165,7 +173,8 @@ struct Sta_Hits
 
 void Sta_GetRemoteAddr (void);
 void Sta_LogAccess (const char *Comments);
-void Sta_RemoveOldEntriesRecentLog (void);
+void Sta_LogRefresh (void);
+void Sta_RotateLogTables (void);
 void Sta_AskShowCrsHits (void);
 void Sta_AskShowGblHits (void);
 void Sta_SetIniEndDates (void);
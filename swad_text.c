@@ -79,6 +79,7 @@
 #include "swad_forum.h"
 #include "swad_holiday.h"
 #include "swad_info.h"
+#include "swad_job.h"
 #include "swad_mail.h"
 #include "swad_menu.h"
 #include "swad_notification.h"
@@ -2038,6 +2039,27 @@ const char *Txt_accessible_only_for_reading_by_students_of_the_group_and_teacher
 	"acess&iacute;vel apenas para leitura pelos alunos do grupo e professores da disciplina";
 #endif
 
+const char *Txt_Accuracy =
+#if   L==1
+	"Precisi&oacute;";
+#elif L==2
+	"Genauigkeit";
+#elif L==3
+	"Accuracy";
+#elif L==4
+	"Precisi&oacute;n";
+#elif L==5
+	"Pr&eacute;cision";
+#elif L==6
+	"Precisi&oacute;n";	// Okoteve traduccin
+#elif L==7
+	"Precisione";
+#elif L==8
+	"Dokladnosc";
+#elif L==9
+	"Precis&atilde;o";
+#endif
+
 const char *Txt_Action =
 #if   L==1
 	"Acci&oacute;";
@@ -3181,6 +3203,54 @@ const char *Txt_Application_key =
 	"Application key";		// Necessita de traduo
 #endif
 
+const char *Txt_Approximate_values_estimated_from_a_sample_of_one_out_of_every_X_clicks =	// Warning: it is very important to include four %u in the following sentences
+#if   L==1
+	"Valors aproximats estimats a partir d'una mostra d'un de cada %u clics."
+	" Amb un 95%% de confian&ccedil;a, l'error d'un valor N &eacute;s menor que"
+	" &plusmn;2&middot;&radic;(%u&middot;N)"
+	" (&plusmn;%u%% per a N = 10000, &plusmn;%u%% per a N = 1000000).";
+#elif L==2
+	"Approximate values estimated from a sample of one out of every %u clicks."
+	" With 95%% confidence, the error of a value N is less than"
+	" &plusmn;2&middot;&radic;(%u&middot;N)"
+	" (&plusmn;%u%% for N = 10000, &plusmn;%u%% for N = 1000000).";	// Need bersetzung
+#elif L==3
+	"Approximate values estimated from a sample of one out of every %u clicks."
+	" With 95%% confidence, the error of a value N is less than"
+	" &plusmn;2&middot;&radic;(%u&middot;N)"
+	" (&plusmn;%u%% for N = 10000, &plusmn;%u%% for N = 1000000).";
+#elif L==4
+	"Valores aproximados estimados a partir de una muestra de uno de cada %u clics."
+	" Con un 95%% de confianza, el error de un valor N es menor que"
+	" &plusmn;2&middot;&radic;(%u&middot;N)"
+	" (&plusmn;%u%% para N = 10000, &plusmn;%u%% para N = 1000000).";
+#elif L==5
+	"Approximate values estimated from a sample of one out of every %u clicks."
+	" With 95%% confidence, the error of a value N is less than"
+	" &plusmn;2&middot;&radic;(%u&middot;N)"
+	" (&plusmn;%u%% for N = 10000, &plusmn;%u%% for N = 1000000).";	// Besoin de traduction
+#elif L==6
+	"Valores aproximados estimados a partir de una muestra de uno de cada %u clics."
+	" Con un 95%% de confianza, el error de un valor N es menor que"
+	" &plusmn;2&middot;&radic;(%u&middot;N)"
+	" (&plusmn;%u%% para N = 10000, &plusmn;%u%% para N = 1000000).";	// Okoteve traduccin
+#elif L==7
+	"Approximate values estimated from a sample of one out of every %u clicks."
+	" With 95%% confidence, the error of a value N is less than"
+	" &plusmn;2&middot;&radic;(%u&middot;N)"
+	" (&plusmn;%u%% for N = 10000, &plusmn;%u%% for N = 1000000).";	// Bisogno di traduzione
+#elif L==8
+	"Approximate values estimated from a sample of one out of every %u clicks."
+	" With 95%% confidence, the error of a value N is less than"
+	" &plusmn;2&middot;&radic;(%u&middot;N)"
+	" (&plusmn;%u%% for N = 10000, &plusmn;%u%% for N = 1000000).";	// Potrzebujesz tlumaczenie
+#elif L==9
+	"Approximate values estimated from a sample of one out of every %u clicks."
+	" With 95%% confidence, the error of a value N is less than"
+	" &plusmn;2&middot;&radic;(%u&middot;N)"
+	" (&plusmn;%u%% for N = 10000, &plusmn;%u%% for N = 1000000).";	// Necessita de traduo
+#endif
+
 const char *Txt_Assessment_criteria =
 #if   L==1
 	"Criteris d'avaluaci&oacute;";
@@ -3857,6 +3927,27 @@ const char *Txt_Average_type =
 	"Tipo de m&eacute;dia";
 #endif
 
+const char *Txt_Background_task =
+#if   L==1
+	"Tasca en segon pla";
+#elif L==2
+	"Background task";		// Need bersetzung
+#elif L==3
+	"Background task";
+#elif L==4
+	"Tarea en segundo plano";
+#elif L==5
+	"Background task";		// Besoin de traduction
+#elif L==6
+	"Tarea en segundo plano";	// Okoteve traduccin
+#elif L==7
+	"Background task";		// Bisogno di traduzione
+#elif L==8
+	"Background task";		// Potrzebujesz tlumaczenie
+#elif L==9
+	"Background task";		// Necessita de traduo
+#endif
+
 const char *Txt_Banned_users =
 #if   L==1
 	"Usuaris bloquejats";
@@ -17524,6 +17615,89 @@ const char *Txt_Its_me =
 	"Sou eu!";
 #endif
 
+const char *Txt_JOB_STATUS[Job_NUM_STATUS] =
+   {
+#if   L==1	// Job_PENDING
+	 "Pendent"
+#elif L==2
+	 "Pending"	// Need bersetzung
+#elif L==3
+	 "Pending"
+#elif L==4
+	 "Pendiente"
+#elif L==5
+	 "En attente"
+#elif L==6
+	 "Pendiente"
+#elif L==7
+	 "In attesa"
+#elif L==8
+	 "Pending"	// Potrzebujesz tlumaczenie
+#elif L==9
+	 "Pendente"
+#endif
+	 ,
+#if   L==1	// Job_RUNNING
+	 "Executant"
+#elif L==2
+	 "Running"	// Need bersetzung
+#elif L==3
+	 "Running"
+#elif L==4
+	 "Ejecutando"
+#elif L==5
+	 "Running"	// Besoin de traduction
+#elif L==6
+	 "Ejecutando"
+#elif L==7
+	 "Running"	// Bisogno di traduzione
+#elif L==8
+	 "Running"	// Potrzebujesz tlumaczenie
+#elif L==9
+	 "Executando"
+#endif
+	 ,
+#if   L==1	// Job_DONE
+	 "Acabat"
+#elif L==2
+	 "Finished"	// Need bersetzung
+#elif L==3
+	 "Finished"
+#elif L==4
+	 "Terminado"
+#elif L==5
+	 "Termin&eacute;"
+#elif L==6
+	 "Terminado"
+#elif L==7
+	 "Finished"	// Bisogno di traduzione
+#elif L==8
+	 "Finished"	// Potrzebujesz tlumaczenie
+#elif L==9
+	 "Terminado"
+#endif
+	 ,
+#if   L==1	// Job_FAILED
+	 "Error"
+#elif L==2
+	 "Error"	// Need bersetzung
+#elif L==3
+	 "Error"
+#elif L==4
+	 "Error"
+#elif L==5
+	 "Erreur"
+#elif L==6
+	 "Error"	// Okoteve traduccin
+#elif L==7
+	 "Errore"
+#elif L==8
+	 "Error"	// Potrzebujesz tlumaczenie
+#elif L==9
+	 "Erro"
+#endif
+   };
+
 const char *Txt_Language =
 #if   L==1
 	"Idioma";
@@ -38640,6 +38814,27 @@ const char *Txt_See_notifications =
 	"Veja notifica&ccedil;&otilde;es";
 #endif
 
+const char *Txt_See_result =
+#if   L==1
+	"Veure resultat";
+#elif L==2
+	"See result";			// Need bersetzung
+#elif L==3
+	"See result";
+#elif L==4
+	"Ver resultado";
+#elif L==5
+	"See result";			// Besoin de traduction
+#elif L==6
+	"Ver resultado";		// Okoteve traduccin
+#elif L==7
+	"See result";			// Bisogno di traduzione
+#elif L==8
+	"See result";			// Potrzebujesz tlumaczenie
+#elif L==9
+	"Ver resultado";
+#endif
+
 const char *Txt_Select_another_country =
 #if   L==1
 	"Seleccionar un altre pas";
@@ -41617,6 +41812,49 @@ const char *Txt_STAT_DEGREE_PHOTO_ORDER[Pho_NUM_HOW_ORDER_DEGREES] =
 #endif
 	};
 
+const char *Txt_STAT_EXACT_OR_APPROXIMATE[Sta_NUM_EXACT_OR_APPROXIMATE] =
+   {
+#if   L==1
+	 "exacta (lenta)"
+#elif L==2
+	 "genau (langsam)"
+#elif L==3
+	 "exact (slow)"
+#elif L==4
+	 "exacta (lenta)"
+#elif L==5
+	 "exacte (lente)"
+#elif L==6
+	 "exacta (lenta)"			// Okoteve traduccin
+#elif L==7
+	 "esatta (lenta)"
+#elif L==8
+	 "exact (slow)"			// Potrzebujesz tlumaczenie
+#elif L==9
+	 "exata (lenta)"
+#endif
+	 ,
+#if   L==1
+	 "aproximada (r&agrave;pida)"
+#elif L==2
+	 "ungef&auml;hr (schnell)"
+#elif L==3
+	 "approximate (fast)"
+#elif L==4
+	 "aproximada (r&aacute;pida)"
+#elif L==5
+	 "approximative (rapide)"
+#elif L==6
+	 "aproximada (r&aacute;pida)"		// Okoteve traduccin
+#elif L==7
+	 "approssimativa (veloce)"
+#elif L==8
+	 "approximate (fast)"			// Potrzebujesz tlumaczenie
+#elif L==9
+	 "aproximada (r&aacute;pida)"
+#endif
+   };
+
 const char *Txt_STAT_TYPE_COUNT_CAPS[Sta_NUM_COUNT_TYPES] =
    {
 #if   L==1
@@ -130,6 +130,8 @@ const char *Usr_UsrDatMainFieldNames[Usr_NUM_MAIN_FIELDS_DATA_USR];
 
 #define Usr_MAX_BYTES_QUERY_GET_LIST_USRS (16 * 1024 - 1)
 
+#define Usr_MAX_BYTES_USR_COD_IN_LIST (1 + 10)	// Comma and user's code
+
 /*****************************************************************************/
 /****************************** Internal types *******************************/
 /*****************************************************************************/
@@ -149,6 +151,7 @@ extern struct Globals Gbl;
 /*****************************************************************************/
 
 static void Usr_GetMyLastData (void);
+static void Usr_GetMainUsrDataFromRow (MYSQL_ROW row,struct UsrData *UsrDat);
 static void Usr_GetUsrCommentsFromString (char *Str,struct UsrData *UsrDat);
 static Usr_Sex_t Usr_GetSexFromStr (const char *Str);
 
@@ -161,10 +164,12 @@ static void Usr_GetParamOtherUsrIDNickOrEMail (void);
 
 static bool Usr_ChkUsrAndGetUsrDataFromDirectLogin (void);
 static bool Usr_ChkUsrAndGetUsrDataFromSession (void);
+static bool Usr_ChkUsrAndGetUsrDataFromSessionWhenRefreshing (void);
 static void Usr_ShowAlertUsrDoesNotExistsOrWrongPassword (void);
 static void Usr_ShowAlertThereAreMoreThanOneUsr (void);
 
 static void Usr_SetMyPrefsAndRoles (void);
+static void Usr_SetMyPrefs (void);
 
 static void Usr_InsertMyLastData (void);
 
@@ -185,6 +190,9 @@ static void Usr_BuildQueryToGetUsrsLstCrs (Rol_Role_t Role,
 static void Usr_GetAdmsLst (Sco_Scope_t Scope);
 static void Usr_GetGstsLst (Sco_Scope_t Scope);
 static void Usr_GetListUsrsFromQuery (const char *Query,Rol_Role_t Role,Sco_Scope_t Scope);
+static void Usr_GetListIDsOfUsrsInList (Rol_Role_t Role);
+static void Usr_CopyListIDsFromList (struct UsrData *UsrDat,Rol_Role_t Role,unsigned NumUsr);
+static void Usr_FreeListIDsOfUsrsInList (Rol_Role_t Role);
 static void Usr_AllocateUsrsList (Rol_Role_t Role);
 
 static void Usr_PutButtonToConfirmIWantToSeeBigList (unsigned NumUsrs,const char *OnSubmit);
@@ -480,25 +488,21 @@ void Usr_GetEncryptedUsrCodFromUsrCod (struct UsrData *UsrDat)	// TODO: Remove t
 
 void Usr_GetUsrDataFromUsrCod (struct UsrData *UsrDat)
   {
-   extern const char *Txt_STR_LANG_ID[1 + Txt_NUM_LANGUAGES];
-   extern const char *The_ThemeId[The_NUM_THEMES];
-   extern const char *Ico_IconSetId[Ico_NUM_ICON_SETS];
    char Query[1024];
    MYSQL_RES *mysql_res;
    MYSQL_ROW row;
    unsigned long NumRows;
-   The_Theme_t Theme;
-   Ico_IconSet_t IconSet;
-   Txt_Language_t Lan;
 
    /***** Get user's data from database *****/
+   // The first columns must be those read by Usr_GetMainUsrDataFromRow
    sprintf (Query,"SELECT EncryptedUsrCod,Password,Surname1,Surname2,FirstName,Sex,"
                   "Theme,IconSet,Language,FirstDayOfWeek,DateFormat,"
-                  "Photo,PhotoVisibility,ProfileVisibility,"
+                  "Photo,PhotoVisibility,Menu,SideCols,NotifNtfEvents,"
+                  "ProfileVisibility,"
                   "CtyCod,InsCtyCod,InsCod,DptCod,CtrCod,Office,OfficePhone,"
                   "LocalAddress,LocalPhone,FamilyAddress,FamilyPhone,OriginPlace,"
                   "DATE_FORMAT(Birthday,'%%Y%%m%%d'),Comments,"
-                  "Menu,SideCols,NotifNtfEvents,EmailNtfEvents"
+                  "EmailNtfEvents"
                   " FROM usr_data WHERE UsrCod=%ld",
             UsrDat->UsrCod);
    NumRows = DB_QuerySELECT (Query,&mysql_res,"can not get user's data");
@@ -510,13 +514,8 @@ void Usr_GetUsrDataFromUsrCod (struct UsrData *UsrDat)
    /***** Read user's data *****/
    row = mysql_fetch_row (mysql_res);
 
-   /* Get encrypted user's code */
-   Str_Copy (UsrDat->EncryptedUsrCod,row[0],
-            Cry_BYTES_ENCRYPTED_STR_SHA256_BASE64);
-
-   /* Get encrypted password */
-   Str_Copy (UsrDat->Password,row[1],
-             Pwd_BYTES_ENCRYPTED_PASSWORD);
+   /* Get main data and preferences (row[0]...row[15]) */
+   Usr_GetMainUsrDataFromRow (row,UsrDat);
 
    /* Get roles */
    UsrDat->Roles.InCurrentCrs.Role = Rol_GetRoleUsrInCrs (UsrDat->UsrCod,
@@ -525,6 +524,73 @@ void Usr_GetUsrDataFromUsrCod (struct UsrData *UsrDat)
    UsrDat->Roles.InCrss = -1;	// Force roles to be got from database
    Rol_GetRolesInAllCrssIfNotYetGot (UsrDat);
 
+   /* Get rest of data */
+   UsrDat->ProfileVisibility = Pri_GetVisibilityFromStr (row[16]);
+   UsrDat->CtyCod    = Str_ConvertStrCodToLongCod (row[17]);
+   UsrDat->InsCtyCod = Str_ConvertStrCodToLongCod (row[18]);
+   UsrDat->InsCod    = Str_ConvertStrCodToLongCod (row[19]);
+
+   UsrDat->Tch.DptCod = Str_ConvertStrCodToLongCod (row[20]);
+   UsrDat->Tch.CtrCod = Str_ConvertStrCodToLongCod (row[21]);
+   Str_Copy (UsrDat->Tch.Office,row[22],
+             Usr_MAX_BYTES_ADDRESS);
+   Str_Copy (UsrDat->Tch.OfficePhone,row[23],
+             Usr_MAX_BYTES_PHONE);
+
+   Str_Copy (UsrDat->LocalAddress,row[24],
+             Usr_MAX_BYTES_ADDRESS);
+   Str_Copy (UsrDat->LocalPhone,row[25],
+             Usr_MAX_BYTES_PHONE);
+   Str_Copy (UsrDat->FamilyAddress,row[26],
+             Usr_MAX_BYTES_ADDRESS);
+   Str_Copy (UsrDat->FamilyPhone,row[27],
+             Usr_MAX_BYTES_PHONE);
+   Str_Copy (UsrDat->OriginPlace,row[28],
+             Usr_MAX_BYTES_ADDRESS);
+
+   Dat_GetDateFromYYYYMMDD (&(UsrDat->Birthday),row[29]);
+
+   Usr_GetUsrCommentsFromString (row[30] ? row[30] :
+	                                   "",
+	                         UsrDat);        // Get the comments comunes a todas the courses
+
+   /* Get on which events I want to be notified by email */
+   if (sscanf (row[31],"%u",&UsrDat->Prefs.EmailNtfEvents) != 1)
+      UsrDat->Prefs.EmailNtfEvents = 0;
+   if (UsrDat->Prefs.EmailNtfEvents >= (1 << Ntf_NUM_NOTIFY_EVENTS))	// Maximum binary value for NotifyEvents is 000...0011...11
+      UsrDat->Prefs.EmailNtfEvents = 0;
+
+   Dat_ConvDateToDateStr (&(UsrDat->Birthday),UsrDat->StrBirthday);
+
+   /***** Free structure that stores the query result *****/
+   DB_FreeMySQLResult (&mysql_res);
+
+   /***** Get nickname and email *****/
+   Nck_GetNicknameFromUsrCod (UsrDat->UsrCod,UsrDat->Nickname);
+   Mai_GetEmailFromUsrCod (UsrDat);
+  }
+
+/*****************************************************************************/
+/********* Get main user's data and preferences from a row of usr_data *******/
+/*****************************************************************************/
+// row[0]...row[15] must hold, in this order:
+// EncryptedUsrCod,Password,Surname1,Surname2,FirstName,Sex,
+// Theme,IconSet,Language,FirstDayOfWeek,DateFormat,
+// Photo,PhotoVisibility,Menu,SideCols,NotifNtfEvents
+
+static void Usr_GetMainUsrDataFromRow (MYSQL_ROW row,struct UsrData *UsrDat)
+  {
+   extern const char *Txt_STR_LANG_ID[1 + Txt_NUM_LANGUAGES];
+   Txt_Language_t Lan;
+
+   /* Get encrypted user's code */
+   Str_Copy (UsrDat->EncryptedUsrCod,row[0],
+            Cry_BYTES_ENCRYPTED_STR_SHA256_BASE64);
+
+   /* Get encrypted password */
+   Str_Copy (UsrDat->Password,row[1],
+             Pwd_BYTES_ENCRYPTED_PASSWORD);
+
    /* Get name */
    Str_Copy (UsrDat->Surname1,row[2],
              Usr_MAX_BYTES_FIRSTNAME_OR_SURNAME);
@@ -532,31 +598,21 @@ void Usr_GetUsrDataFromUsrCod (struct UsrData *UsrDat)
              Usr_MAX_BYTES_FIRSTNAME_OR_SURNAME);
    Str_Copy (UsrDat->FirstName,row[4],
              Usr_MAX_BYTES_FIRSTNAME_OR_SURNAME);
+   Str_ConvertToTitleType (UsrDat->Surname1 );
+   Str_ConvertToTitleType (UsrDat->Surname2 );
+   Str_ConvertToTitleType (UsrDat->FirstName);
+   /* Create full name using FirstName, Surname1 and Surname2 */
+   Usr_BuildFullName (UsrDat);
 
    /* Get sex */
    UsrDat->Sex = Usr_GetSexFromStr (row[5]);
 
    /* Get theme */
-   UsrDat->Prefs.Theme = The_THEME_DEFAULT;
-   for (Theme = (The_Theme_t) 0;
-        Theme < The_NUM_THEMES;
-        Theme++)
-      if (!strcasecmp (row[6],The_ThemeId[Theme]))
-        {
-         UsrDat->Prefs.Theme = Theme;
-         break;
-        }
+   if ((UsrDat->Prefs.Theme = The_GetThemeFromStr (row[6])) == The_THEME_UNKNOWN)
+      UsrDat->Prefs.Theme = The_THEME_DEFAULT;
 
    /* Get icon set */
-   UsrDat->Prefs.IconSet = Ico_ICON_SET_DEFAULT;
-   for (IconSet = (Ico_IconSet_t) 0;
-        IconSet < Ico_NUM_ICON_SETS;
-        IconSet++)
-      if (!strcasecmp (row[7],Ico_IconSetId[IconSet]))
-        {
-         UsrDat->Prefs.IconSet = IconSet;
-         break;
-        }
+   UsrDat->Prefs.IconSet = Ico_GetIconSetFromStr (row[7]);
 
    /* Get language */
    UsrDat->Prefs.Language = Txt_LANGUAGE_UNKNOWN;	// Language unknown
@@ -575,44 +631,16 @@ void Usr_GetUsrDataFromUsrCod (struct UsrData *UsrDat)
    /* Get date format */
    UsrDat->Prefs.DateFormat = Dat_GetDateFormatFromStr (row[10]);
 
-   /* Get rest of data */
+   /* Get photo */
    Str_Copy (UsrDat->Photo,row[11],
              Cry_BYTES_ENCRYPTED_STR_SHA256_BASE64);
-   UsrDat->PhotoVisibility   = Pri_GetVisibilityFromStr (row[12]);
-   UsrDat->ProfileVisibility = Pri_GetVisibilityFromStr (row[13]);
-   UsrDat->CtyCod    = Str_ConvertStrCodToLongCod (row[14]);
-   UsrDat->InsCtyCod = Str_ConvertStrCodToLongCod (row[15]);
-   UsrDat->InsCod    = Str_ConvertStrCodToLongCod (row[16]);
-
-   UsrDat->Tch.DptCod = Str_ConvertStrCodToLongCod (row[17]);
-   UsrDat->Tch.CtrCod = Str_ConvertStrCodToLongCod (row[18]);
-   Str_Copy (UsrDat->Tch.Office,row[19],
-             Usr_MAX_BYTES_ADDRESS);
-   Str_Copy (UsrDat->Tch.OfficePhone,row[20],
-             Usr_MAX_BYTES_PHONE);
-
-   Str_Copy (UsrDat->LocalAddress,row[21],
-             Usr_MAX_BYTES_ADDRESS);
-   Str_Copy (UsrDat->LocalPhone,row[22],
-             Usr_MAX_BYTES_PHONE);
-   Str_Copy (UsrDat->FamilyAddress,row[23],
-             Usr_MAX_BYTES_ADDRESS);
-   Str_Copy (UsrDat->FamilyPhone,row[24],
-             Usr_MAX_BYTES_PHONE);
-   Str_Copy (UsrDat->OriginPlace,row[25],
-             Usr_MAX_BYTES_ADDRESS);
-
-   Dat_GetDateFromYYYYMMDD (&(UsrDat->Birthday),row[26]);
-
-   Usr_GetUsrCommentsFromString (row[27] ? row[27] :
-	                                   "",
-	                         UsrDat);        // Get the comments comunes a todas the courses
+   UsrDat->PhotoVisibility = Pri_GetVisibilityFromStr (row[12]);
 
    /* Get menu */
-   UsrDat->Prefs.Menu = Mnu_GetMenuFromStr (row[28]);
+   UsrDat->Prefs.Menu = Mnu_GetMenuFromStr (row[13]);
 
    /* Get if user wants to show side columns */
-   if (sscanf (row[29],"%u",&UsrDat->Prefs.SideCols) == 1)
+   if (sscanf (row[14],"%u",&UsrDat->Prefs.SideCols) == 1)
      {
       if (UsrDat->Prefs.SideCols > Lay_SHOW_BOTH_COLUMNS)
          UsrDat->Prefs.SideCols = Cfg_DEFAULT_COLUMNS;
@@ -621,29 +649,8 @@ void Usr_GetUsrDataFromUsrCod (struct UsrData *UsrDat)
       UsrDat->Prefs.SideCols = Cfg_DEFAULT_COLUMNS;
 
    /* Get on which events I want to be notified inside the platform */
-   if (sscanf (row[30],"%u",&UsrDat->Prefs.NotifNtfEvents) != 1)
+   if (sscanf (row[15],"%u",&UsrDat->Prefs.NotifNtfEvents) != 1)
       UsrDat->Prefs.NotifNtfEvents = (unsigned) -1;	// 0xFF..FF
-
-   /* Get on which events I want to be notified by email */
-   if (sscanf (row[31],"%u",&UsrDat->Prefs.EmailNtfEvents) != 1)
-      UsrDat->Prefs.EmailNtfEvents = 0;
-   if (UsrDat->Prefs.EmailNtfEvents >= (1 << Ntf_NUM_NOTIFY_EVENTS))	// Maximum binary value for NotifyEvents is 000...0011...11
-      UsrDat->Prefs.EmailNtfEvents = 0;
-
-   Str_ConvertToTitleType (UsrDat->Surname1 );
-   Str_ConvertToTitleType (UsrDat->Surname2 );
-   Str_ConvertToTitleType (UsrDat->FirstName);
-   /* Create full name using FirstName, Surname1 and Surname2 */
-   Usr_BuildFullName (UsrDat);
-
-   Dat_ConvDateToDateStr (&(UsrDat->Birthday),UsrDat->StrBirthday);
-
-   /***** Free structure that stores the query result *****/
-   DB_FreeMySQLResult (&mysql_res);
-
-   /***** Get nickname and email *****/
-   Nck_GetNicknameFromUsrCod (UsrDat->UsrCod,UsrDat->Nickname);
-   Mai_GetEmailFromUsrCod (UsrDat);
   }
 
 /*****************************************************************************/
@@ -2847,7 +2854,13 @@ void Usr_ChkUsrAndGetUsrData (void)
 	 /***** Check user and get user's data *****/
 	 if (Gbl.Session.IsOpen)
 	   {
-	    if (Usr_ChkUsrAndGetUsrDataFromSession ())	// User logged in
+	    if (Gbl.Action.IsAJAXAutoRefresh &&
+		Usr_ChkUsrAndGetUsrDataFromSessionWhenRefreshing ())	// User logged in (fast check)
+	      {
+	       Gbl.Usrs.Me.Logged = true;
+	       Ses_UpdateSessionLastRefreshInDB ();
+	      }
+	    else if (Usr_ChkUsrAndGetUsrDataFromSession ())	// User logged in
 	      {
 	       Gbl.Usrs.Me.Logged = true;
 	       Usr_SetMyPrefsAndRoles ();
@@ -2857,7 +2870,8 @@ void Usr_ChkUsrAndGetUsrData (void)
 	       else
 		 {
 		  Act_AdjustCurrentAction ();
-		  Ses_UpdateSessionDataInDB ();
+		  // Session is updated in database later,
+		  // together with clicks in most frequently used actions
 		  Con_UpdateMeInConnectedList ();
 		 }
 	      }
@@ -3121,6 +3135,110 @@ static bool Usr_ChkUsrAndGetUsrDataFromSession (void)
    return true;
   }
 
+/*****************************************************************************/
+/********* Check user and get user's data when refreshing via AJAX ***********/
+/*****************************************************************************/
+// Automatic refreshes only need my main data, my preferences and my role,
+// so they are got in only one query, and my role is the one got from session.
+// Returns true if user logged in successfully
+// Returns false if user not logged in or if the whole check is needed
+
+static bool Usr_ChkUsrAndGetUsrDataFromSessionWhenRefreshing (void)
+  {
+   char Query[1024];
+   MYSQL_RES *mysql_res;
+   MYSQL_ROW row;
+   Rol_Role_t RoleInCrs;
+   bool IBelongToCurrentCrs;
+   bool UsrLoggedIn = false;
+
+   /***** Administrators roles must be checked in the whole check *****/
+   if (Gbl.Usrs.Me.Role.FromSession == Rol_UNK ||
+       Gbl.Usrs.Me.Role.FromSession > Rol_TCH)
+      return false;
+
+   /***** Get my data, my last data and my role in current course *****/
+   // The first columns must be those read by Usr_GetMainUsrDataFromRow
+   sprintf (Query,"SELECT usr_data.EncryptedUsrCod,usr_data.Password,"
+		  "usr_data.Surname1,usr_data.Surname2,usr_data.FirstName,"
+		  "usr_data.Sex,usr_data.Theme,usr_data.IconSet,"
+		  "usr_data.Language,usr_data.FirstDayOfWeek,"
+		  "usr_data.DateFormat,usr_data.Photo,"
+		  "usr_data.PhotoVisibility,usr_data.Menu,"
+		  "usr_data.SideCols,usr_data.NotifNtfEvents,"
+		  "UNIX_TIMESTAMP(usr_last.LastAccNotif),"
+		  "crs_usr.Role,crs_usr.Accepted,"
+		  "(SELECT Nickname FROM usr_nicknames"
+		  " WHERE UsrCod=%ld ORDER BY CreatTime DESC LIMIT 1)"
+		  " FROM usr_data"
+		  " LEFT JOIN usr_last"
+		  " ON usr_last.UsrCod=usr_data.UsrCod"
+		  " LEFT JOIN crs_usr"
+		  " ON crs_usr.CrsCod=%ld AND crs_usr.UsrCod=usr_data.UsrCod"
+		  " WHERE usr_data.UsrCod=%ld",
+	    Gbl.Session.UsrCod,
+	    Gbl.CurrentCrs.Crs.CrsCod,
+	    Gbl.Session.UsrCod);
+   if (DB_QuerySELECT (Query,&mysql_res,"can not get user's data") == 1)
+     {
+      row = mysql_fetch_row (mysql_res);
+
+      /* Get my role in current course (row[17]) */
+      RoleInCrs = row[17] ? Rol_ConvertUnsignedStrToRole (row[17]) :
+			    Rol_UNK;
+      IBelongToCurrentCrs = (RoleInCrs == Rol_STD ||
+			     RoleInCrs == Rol_NET ||
+			     RoleInCrs == Rol_TCH);
+
+      /* Check password, and check that nothing must be updated */
+      if ((!row[1][0] ||
+	   !strcmp (Gbl.Usrs.Me.LoginEncryptedPassword,row[1])) &&	// Password is correct
+	  row[16] != NULL &&						// My last data exist
+	  (IBelongToCurrentCrs ? Gbl.Usrs.Me.Role.FromSession == RoleInCrs :
+				 (Gbl.Usrs.Me.Role.FromSession == Rol_GST ||
+				  Gbl.Usrs.Me.Role.FromSession == Rol_USR)))	// Role in session is valid
+	{
+	 Gbl.Usrs.Me.UsrDat.UsrCod = Gbl.Session.UsrCod;
+
+	 /* Get main data and preferences (row[0]...row[15]) */
+	 Usr_GetMainUsrDataFromRow (row,&Gbl.Usrs.Me.UsrDat);
+
+	 /* If I have not chosen language, it must be updated in the whole check */
+	 if (Gbl.Usrs.Me.UsrDat.Prefs.Language != Txt_LANGUAGE_UNKNOWN)
+	   {
+	    /* Get time of my last access to notifications (row[16]) */
+	    Gbl.Usrs.Me.UsrLast.LastAccNotif = Dat_GetUNIXTimeFromStr (row[16]);
+
+	    /* Get my nickname (row[19]) */
+	    if (row[19])
+	       Str_Copy (Gbl.Usrs.Me.UsrDat.Nickname,row[19],
+			 Nck_MAX_BYTES_NICKNAME_WITHOUT_ARROBA);
+	    else
+	       Gbl.Usrs.Me.UsrDat.Nickname[0] = '\0';
+
+	    /* Set my roles */
+	    Gbl.Usrs.Me.UsrDat.Roles.InCurrentCrs.Role = RoleInCrs;
+	    Gbl.Usrs.Me.UsrDat.Roles.InCurrentCrs.Valid = true;
+	    Gbl.Usrs.Me.Role.Logged = Gbl.Usrs.Me.Role.FromSession;
+	    Gbl.Usrs.Me.IBelongToCurrentCrs = IBelongToCurrentCrs;
+	    Gbl.Usrs.Me.UsrDat.Accepted = IBelongToCurrentCrs &&
+					  row[18][0] == 'Y';	// row[18]
+
+	    UsrLoggedIn = true;
+	   }
+	}
+     }
+
+   /***** Free structure that stores the query result *****/
+   DB_FreeMySQLResult (&mysql_res);
+
+   /***** Set my preferences *****/
+   if (UsrLoggedIn)
+      Usr_SetMyPrefs ();
+
+   return UsrLoggedIn;
+  }
+
 /*****************************************************************************/
 /** Show alert indicating that user does not exists or password is incorrect */
 /*****************************************************************************/
@@ -3155,9 +3273,6 @@ static void Usr_ShowAlertThereAreMoreThanOneUsr (void)
 
 static void Usr_SetMyPrefsAndRoles (void)
   {
-   extern const char *The_ThemeId[The_NUM_THEMES];
-   extern const char *Ico_IconSetId[Ico_NUM_ICON_SETS];
-
    // In this point I am logged
 
    /***** Set my language if unknown *****/
@@ -3165,26 +3280,7 @@ static void Usr_SetMyPrefsAndRoles (void)
       Lan_UpdateMyLanguageToCurrentLanguage ();	// Update my language in database
 
    /***** Set preferences from my preferences *****/
-   Gbl.Prefs.FirstDayOfWeek = Gbl.Usrs.Me.UsrDat.Prefs.FirstDayOfWeek;
-   Gbl.Prefs.DateFormat     = Gbl.Usrs.Me.UsrDat.Prefs.DateFormat;
-   Gbl.Prefs.Menu           = Gbl.Usrs.Me.UsrDat.Prefs.Menu;
-   Gbl.Prefs.SideCols       = Gbl.Usrs.Me.UsrDat.Prefs.SideCols;
-
-   Gbl.Prefs.Theme = Gbl.Usrs.Me.UsrDat.Prefs.Theme;
-   sprintf (Gbl.Prefs.PathTheme,"%s/%s/%s",
-	    Gbl.Prefs.IconsURL,Cfg_ICON_FOLDER_THEMES,
-	    The_ThemeId[Gbl.Prefs.Theme]);
-
-   Gbl.Prefs.IconSet = Gbl.Usrs.Me.UsrDat.Prefs.IconSet;
-   sprintf (Gbl.Prefs.PathIconSet,"%s/%s/%s",
-	    Gbl.Prefs.IconsURL,Cfg_ICON_FOLDER_ICON_SETS,
-	    Ico_IconSetId[Gbl.Prefs.IconSet]);
-
-   /***** Construct the path to my directory *****/
-   Usr_ConstructPathUsr (Gbl.Usrs.Me.UsrDat.UsrCod,Gbl.Usrs.Me.PathDir);
-
-   /***** Check if my photo exists and create a link to it ****/
-   Gbl.Usrs.Me.MyPhotoExists = Pho_BuildLinkToPhoto (&Gbl.Usrs.Me.UsrDat,Gbl.Usrs.Me.PhotoURL);
+   Usr_SetMyPrefs ();
 
    /***** Get my last data *****/
    Usr_GetMyLastData ();
@@ -3214,6 +3310,38 @@ static void Usr_SetMyPrefsAndRoles (void)
    Rol_SetMyRoles ();
   }
 
+/*****************************************************************************/
+/************************ Set my preferences and photo ***********************/
+/*****************************************************************************/
+
+static void Usr_SetMyPrefs (void)
+  {
+   extern const char *The_ThemeId[The_NUM_THEMES];
+   extern const char *Ico_IconSetId[Ico_NUM_ICON_SETS];
+
+   /***** Set preferences from my preferences *****/
+   Gbl.Prefs.FirstDayOfWeek = Gbl.Usrs.Me.UsrDat.Prefs.FirstDayOfWeek;
+   Gbl.Prefs.DateFormat     = Gbl.Usrs.Me.UsrDat.Prefs.DateFormat;
+   Gbl.Prefs.Menu           = Gbl.Usrs.Me.UsrDat.Prefs.Menu;
+   Gbl.Prefs.SideCols       = Gbl.Usrs.Me.UsrDat.Prefs.SideCols;
+
+   Gbl.Prefs.Theme = Gbl.Usrs.Me.UsrDat.Prefs.Theme;
+   sprintf (Gbl.Prefs.PathTheme,"%s/%s/%s",
+	    Gbl.Prefs.IconsURL,Cfg_ICON_FOLDER_THEMES,
+	    The_ThemeId[Gbl.Prefs.Theme]);
+
+   Gbl.Prefs.IconSet = Gbl.Usrs.Me.UsrDat.Prefs.IconSet;
+   sprintf (Gbl.Prefs.PathIconSet,"%s/%s/%s",
+	    Gbl.Prefs.IconsURL,Cfg_ICON_FOLDER_ICON_SETS,
+	    Ico_IconSetId[Gbl.Prefs.IconSet]);
+
+   /***** Construct the path to my directory *****/
+   Usr_ConstructPathUsr (Gbl.Usrs.Me.UsrDat.UsrCod,Gbl.Usrs.Me.PathDir);
+
+   /***** Check if my photo exists and create a link to it ****/
+   Gbl.Usrs.Me.MyPhotoExists = Pho_BuildLinkToPhoto (&Gbl.Usrs.Me.UsrDat,Gbl.Usrs.Me.PhotoURL);
+  }
+
 /*****************************************************************************/
 /************** Show forms to log out and to change my role ******************/
 /*****************************************************************************/
@@ -5233,6 +5361,148 @@ static void Usr_GetListUsrsFromQuery (const char *Query,Rol_Role_t Role,Sco_Scop
       Lay_ShowErrorAndExit (NULL);
   }
 
+/*****************************************************************************/
+/************** Get the IDs of all the users in a list at once ***************/
+/*****************************************************************************/
+// Only one query is made for all the users in the list,
+// instead of one query for each user
+
+static void Usr_GetListIDsOfUsrsInList (Rol_Role_t Role)
+  {
+   struct ListUsrs *LstUsrs = &Gbl.Usrs.LstUsrs[Role];
+   char *Query;
+   char *Ptr;
+   MYSQL_RES *mysql_res;
+   MYSQL_ROW row;
+   long *UsrCodOfID;
+   unsigned NumUsr;
+   unsigned NumID;
+   unsigned Lo;
+   unsigned Hi;
+   unsigned Mid;
+
+   /***** Free old list of IDs *****/
+   Usr_FreeListIDsOfUsrsInList (Role);
+   for (NumUsr = 0;
+	NumUsr < LstUsrs->NumUsrs;
+	NumUsr++)
+      LstUsrs->Lst[NumUsr].FirstID = LstUsrs->Lst[NumUsr].NumIDs = 0;
+   if (!LstUsrs->NumUsrs)
+      return;
+
+   /***** Build query with the codes of all the users *****/
+   if ((Query = (char *) malloc (256 + (size_t) LstUsrs->NumUsrs * Usr_MAX_BYTES_USR_COD_IN_LIST)) == NULL)
+      Lay_ShowErrorAndExit ("Not enough memory to store query.");
+   Ptr = Query + sprintf (Query,"SELECT UsrCod,UsrID,Confirmed FROM usr_IDs"
+			        " WHERE UsrCod IN (");
+   for (NumUsr = 0;
+	NumUsr < LstUsrs->NumUsrs;
+	NumUsr++)
+      Ptr += sprintf (Ptr,NumUsr ? ",%ld" :
+				   "%ld",
+		      LstUsrs->Lst[NumUsr].UsrCod);
+   // For each user, first the confirmed (Confirmed == 'Y')
+   // and then the unconfirmed (Confirmed == 'N')
+   sprintf (Ptr,") ORDER BY UsrCod,Confirmed DESC,UsrID");
+
+   /***** Get IDs of all the users from database *****/
+   LstUsrs->NumIDs = (unsigned) DB_QuerySELECT (Query,&mysql_res,"can not get users' IDs");
+   free ((void *) Query);
+
+   if (LstUsrs->NumIDs)
+     {
+      /***** Allocate space for the list of IDs
+             and for the user's code of each ID *****/
+      if ((LstUsrs->IDs = (struct ListIDs *) malloc (LstUsrs->NumIDs *
+						     sizeof (struct ListIDs))) == NULL)
+	 Lay_ShowErrorAndExit ("Not enough memory to store list of users' IDs.");
+      if ((UsrCodOfID = (long *) malloc (LstUsrs->NumIDs * sizeof (long))) == NULL)
+	 Lay_ShowErrorAndExit ("Not enough memory to store list of users' IDs.");
+
+      /***** Get list of IDs, sorted by user's code *****/
+      for (NumID = 0;
+	   NumID < LstUsrs->NumIDs;
+	   NumID++)
+	{
+	 row = mysql_fetch_row (mysql_res);
+
+	 /* Get user's code (row[0]) */
+	 UsrCodOfID[NumID] = Str_ConvertStrCodToLongCod (row[0]);
+
+	 /* Get ID (row[1]) */
+	 Str_Copy (LstUsrs->IDs[NumID].ID,row[1],
+		   ID_MAX_BYTES_USR_ID);
+
+	 /* Get if ID is confirmed (row[2]) */
+	 LstUsrs->IDs[NumID].Confirmed = (row[2][0] == 'Y');
+	}
+
+      /***** Set the range of IDs of each user,
+             searching the first ID of the user by binary search *****/
+      for (NumUsr = 0;
+	   NumUsr < LstUsrs->NumUsrs;
+	   NumUsr++)
+	{
+	 for (Lo = 0, Hi = LstUsrs->NumIDs;
+	      Lo < Hi;)
+	   {
+	    Mid = Lo + (Hi - Lo) / 2;
+	    if (UsrCodOfID[Mid] < LstUsrs->Lst[NumUsr].UsrCod)
+	       Lo = Mid + 1;
+	    else
+	       Hi = Mid;
+	   }
+	 LstUsrs->Lst[NumUsr].FirstID = Lo;
+	 for (NumID = Lo;
+	      NumID < LstUsrs->NumIDs &&
+	      UsrCodOfID[NumID] == LstUsrs->Lst[NumUsr].UsrCod;
+	      NumID++);
+	 LstUsrs->Lst[NumUsr].NumIDs = NumID - Lo;
+	}
+
+      free ((void *) UsrCodOfID);
+     }
+
+   /***** Free structure that stores the query result *****/
+   DB_FreeMySQLResult (&mysql_res);
+  }
+
+/*****************************************************************************/
+/********************* Copy the IDs of a user from a list ********************/
+/*****************************************************************************/
+// Usr_GetListIDsOfUsrsInList must have been called before
+
+static void Usr_CopyListIDsFromList (struct UsrData *UsrDat,Rol_Role_t Role,unsigned NumUsr)
+  {
+   const struct UsrInList *UsrInList = &Gbl.Usrs.LstUsrs[Role].Lst[NumUsr];
+   unsigned NumID;
+
+   if (UsrInList->NumIDs)
+     {
+      ID_ReallocateListIDs (UsrDat,UsrInList->NumIDs);
+      for (NumID = 0;
+	   NumID < UsrInList->NumIDs;
+	   NumID++)
+	 UsrDat->IDs.List[NumID] = Gbl.Usrs.LstUsrs[Role].IDs[UsrInList->FirstID + NumID];
+     }
+   else
+      ID_FreeListIDs (UsrDat);
+  }
+
+/*****************************************************************************/
+/************* Free the list with the IDs of the users in a list *************/
+/*****************************************************************************/
+
+static void Usr_FreeListIDsOfUsrsInList (Rol_Role_t Role)
+  {
+   if (Gbl.Usrs.LstUsrs[Role].IDs)
+     {
+      free ((void *) Gbl.Usrs.LstUsrs[Role].IDs);
+      Gbl.Usrs.LstUsrs[Role].IDs = NULL;
+     }
+   Gbl.Usrs.LstUsrs[Role].NumIDs = 0;
+  }
+
 /*****************************************************************************/
 /********************** Copy user's basic data from list *********************/
 /*****************************************************************************/
@@ -5255,6 +5525,7 @@ void Usr_CopyBasicUsrDataFromList (struct UsrData *UsrDat,const struct UsrInList
    UsrDat->CtyCod                  = UsrInList->CtyCod;
    UsrDat->InsCod                  = UsrInList->InsCod;
    UsrDat->Roles.InCurrentCrs.Role = UsrInList->RoleInCurrentCrsDB;
+   UsrDat->Roles.InCurrentCrs.Valid = (UsrInList->RoleInCurrentCrsDB != Rol_UNK);	// Role in current course is known if got in list
    UsrDat->Accepted                = UsrInList->Accepted;
   }
 
@@ -5282,6 +5553,9 @@ if (Gbl.Usrs.Me.Roles.LoggedRole == Rol_SYS_ADM)
 
 void Usr_FreeUsrsList (Rol_Role_t Role)
   {
+   /***** Free the list of IDs of the users *****/
+   Usr_FreeListIDsOfUsrsInList (Role);
+
    if (Gbl.Usrs.LstUsrs[Role].NumUsrs)
      {
       /***** Free the list itself *****/
@@ -6131,6 +6405,9 @@ static void Usr_ListMainDataStds (bool PutCheckBoxToSelectUsr)
       /***** Initialize structure with user's data *****/
       Usr_UsrDataConstructor (&UsrDat);
 
+      /***** Get IDs of all the students at once *****/
+      Usr_GetListIDsOfUsrsInList (Rol_STD);
+
       /***** List students' data *****/
       for (NumUsr = 0, Gbl.RowEvenOdd = 0;
            NumUsr < Gbl.Usrs.LstUsrs[Rol_STD].NumUsrs;
@@ -6139,8 +6416,8 @@ static void Usr_ListMainDataStds (bool PutCheckBoxToSelectUsr)
 	 /* Copy user's basic data from list */
          Usr_CopyBasicUsrDataFromList (&UsrDat,&Gbl.Usrs.LstUsrs[Rol_STD].Lst[NumUsr]);
 
-	 /* Get list of user's IDs */
-         ID_GetListIDsFromUsrCod (&UsrDat);
+	 /* Copy list of user's IDs from list */
+         Usr_CopyListIDsFromList (&UsrDat,Rol_STD,NumUsr);
 
          /* Show row for this student */
          Usr_WriteRowUsrMainData (NumUsr + 1,&UsrDat,
@@ -6206,6 +6483,9 @@ static void Usr_ListMainDataTchs (Rol_Role_t Role,bool PutCheckBoxToSelectUsr)
       /***** Initialize structure with user's data *****/
       Usr_UsrDataConstructor (&UsrDat);
 
+      /***** Get IDs of all the teachers at once *****/
+      Usr_GetListIDsOfUsrsInList (Role);
+
       /***** List teachers' data *****/
       for (NumUsr = 0, Gbl.RowEvenOdd = 0;
            NumUsr < Gbl.Usrs.LstUsrs[Role].NumUsrs;
@@ -6214,8 +6494,8 @@ static void Usr_ListMainDataTchs (Rol_Role_t Role,bool PutCheckBoxToSelectUsr)
 	 /* Copy user's basic data from list */
          Usr_CopyBasicUsrDataFromList (&UsrDat,&Gbl.Usrs.LstUsrs[Role].Lst[NumUsr]);
 
-	 /* Get list of user's IDs */
-         ID_GetListIDsFromUsrCod (&UsrDat);
+	 /* Copy list of user's IDs from list */
+         Usr_CopyListIDsFromList (&UsrDat,Role,NumUsr);
 
          /* Show row for this teacher */
 	 Usr_WriteRowUsrMainData (NumUsr + 1,&UsrDat,
@@ -8187,12 +8467,10 @@ static void Usr_DrawClassPhoto (Usr_ClassPhotoType_t ClassPhotoType,
 	    TRIsOpen = true;
 	   }
 
-	 /* Copy user's basic data from list */
+	 /* Copy user's basic data from list
+	    (users' IDs are not shown in class photo) */
 	 Usr_CopyBasicUsrDataFromList (&UsrDat,&Gbl.Usrs.LstUsrs[Role].Lst[NumUsr]);
 
-	 /* Get list of user's IDs */
-	 ID_GetListIDsFromUsrCod (&UsrDat);
-
 	 /***** Begin user's cell *****/
 	 fprintf (Gbl.F.Out,"<td class=\"CLASSPHOTO CENTER_BOTTOM");
 	 if (ClassPhotoType == Usr_CLASS_PHOTO_SEL &&
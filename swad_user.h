@@ -208,12 +208,16 @@ struct UsrInList
    Rol_Role_t RoleInCurrentCrsDB;	// Role in current course in database
    bool Accepted;	// User has accepted joining to one/all courses?
    bool Remove;		// A boolean associated with each user that indicates if it must be removed
+   unsigned FirstID;	// Index of the first user's ID in the list of IDs of the users
+   unsigned NumIDs;	// Number of user's IDs
   };
 
 struct ListUsrs
   {
    struct UsrInList *Lst;	// List of users
    unsigned NumUsrs;		// Number of users in the list
+   struct ListIDs *IDs;		// IDs of all the users in the list, sorted by user's code
+   unsigned NumIDs;		// Number of IDs of all the users in the list
   };
 
 struct ListUsrCods
@@ -1548,6 +1548,7 @@ int swad__findUsers (struct soap *soap,
 							    Sco_SCOPE_SYS;
       if (Sch_BuildSearchQuery (SearchQuery,
 				"CONCAT_WS(' ',FirstName,Surname1,Surname2)",
+				"FirstName,Surname1,Surname2",
 				NULL,NULL))
 	{
 	 /***** Create temporary table with candidate users *****/